@@ -32,6 +32,10 @@ export const NODE_TYPES = {
     verticalBlur:   { index: 11, name: 'VBlur',   nameJa: '垂直ぼかし',   category: 'filter',    showEfficiency: true },
     // 特殊ソース系
     ninepatch:   { index: 12, name: 'NinePatch',  nameJa: '9パッチ',      category: 'source',    showEfficiency: false },
+    // キャッシュ系
+    cache:       { index: 14, name: 'Cache',      nameJa: 'キャッシュ',   category: 'system',    showEfficiency: false },
+    // フィルタ系（追加）
+    gaussianBlur:   { index: 15, name: 'GBlur',   nameJa: 'ガウスぼかし', category: 'filter',    showEfficiency: true },
 };
 
 // ========================================
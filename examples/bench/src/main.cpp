@@ -15,7 +15,7 @@
  *   t [grp] [bytesPerPixel] : copyRowDDA benchmark (DDA scanline transform)
  *   m [pat]  : Matte composite benchmark (direct, no pipeline)
  *   p [pat]  : Matte pipeline benchmark (full node pipeline)
- *   o [N]    : Composite pipeline benchmark (N upstream nodes)
+ *   o [N]    : Composite pipeline benchmark (N upstream nodes, all | many | rows | N)
  *   d        : Analyze alpha distribution of test data
  *   s        : RenderResponse move cost benchmark
  *   r        : RenderResponse move count in pipeline
@@ -39,6 +39,7 @@
 #else
 // Native PC build
 #include <chrono>
+#include <cmath>
 #include <cstdarg>
 #include <cstdint>
 #include <cstring>
@@ -57,10 +58,13 @@
 #include "fleximg/image/pixel_format.h"
 #include "fleximg/image/viewport.h"
 #include "fleximg/nodes/composite_node.h"
+#include "fleximg/nodes/gaussian_blur_node.h"
+#include "fleximg/nodes/horizontal_blur_node.h"
 #include "fleximg/nodes/matte_node.h"
 #include "fleximg/nodes/renderer_node.h"
 #include "fleximg/nodes/sink_node.h"
 #include "fleximg/nodes/source_node.h"
+#include "fleximg/nodes/vertical_blur_node.h"
 
 using namespace fleximg;
 
@@ -69,17 +73,20 @@ using namespace fleximg;
 // =============================================================================
 
 // ViewPort から直接 copyRowDDA を呼び出すヘルパー
+// func を指定した場合はフォーマットの copyRowDDA の代わりに使用（スカラー版との比較用）
 static void benchCopyRowDDA(void *dst, const ViewPort &src, int count,
                             int_fixed srcX, int_fixed srcY, int_fixed incrX,
-                            int_fixed incrY) {
+                            int_fixed incrY, CopyRowDDA_Func func = nullptr) {
   if (!src.isValid() || count <= 0)
     return;
   DDAParam param = {src.stride, 0,     0,       srcX,   srcY,
                     incrX,      incrY, nullptr, nullptr};
-  if (src.formatID && src.formatID->copyRowDDA) {
-    src.formatID->copyRowDDA(static_cast<uint8_t *>(dst),
-                             static_cast<const uint8_t *>(src.data), count,
-                             &param);
+  if (!func && src.formatID) {
+    func = src.formatID->copyRowDDA;
+  }
+  if (func) {
+    func(static_cast<uint8_t *>(dst), static_cast<const uint8_t *>(src.data),
+         count, &param);
   }
 }
 
@@ -222,6 +229,11 @@ static constexpr int MATTE_ITERATIONS = 100;
 static constexpr int COMPOSITE_RENDER_WIDTH = 320;
 static constexpr int COMPOSITE_RENDER_HEIGHT = 200;
 static constexpr int COMPOSITE_ITERATIONS = 20;
+static constexpr int COMPOSITE_MAX_COUNT = 128; // SourceNode配列のヒープ制限
+// Blur pipeline benchmark
+static constexpr int BLUR_RENDER_WIDTH = 320;
+static constexpr int BLUR_RENDER_HEIGHT = 200;
+static constexpr int BLUR_ITERATIONS = 5;
 #else
 // PC is much faster, use larger pixel count for accurate measurement
 static constexpr int BENCH_PIXELS = 65536;
@@ -237,6 +249,11 @@ static constexpr int MATTE_ITERATIONS = 100;
 static constexpr int COMPOSITE_RENDER_WIDTH = 320;
 static constexpr int COMPOSITE_RENDER_HEIGHT = 200;
 static constexpr int COMPOSITE_ITERATIONS = 50;
+static constexpr int COMPOSITE_MAX_COUNT = 1000;
+// Blur pipeline benchmark
+static constexpr int BLUR_RENDER_WIDTH = 640;
+static constexpr int BLUR_RENDER_HEIGHT = 480;
+static constexpr int BLUR_ITERATIONS = 20;
 #endif
 
 static constexpr int COMPOSITE_SRC_SIZE = 32;
@@ -971,13 +988,17 @@ struct DDAFormatConfig {
   int bytesPerPixel;
   const char *label;
   PixelFormatID formatID;
+  CopyRowDDA_Func scalar; // SIMD版との比較用スカラー実装（nullptr: SIMD版なし）
 };
 
 static const DDAFormatConfig ddaFormatConfigs[] = {
-    {4, "BPP4", PixelFormatIDs::RGBA8_Straight},
-    {3, "BPP3", PixelFormatIDs::RGB888},
-    {2, "BPP2", PixelFormatIDs::RGB565_LE},
-    {1, "BPP1", PixelFormatIDs::RGB332},
+    {4, "BPP4", PixelFormatIDs::RGBA8_Straight,
+     pixel_format::detail::copyRowDDA_4ByteScalar},
+    {3, "BPP3", PixelFormatIDs::RGB888, nullptr},
+    {2, "BPP2", PixelFormatIDs::RGB565_LE,
+     pixel_format::detail::copyRowDDA_2ByteScalar},
+    {1, "BPP1", PixelFormatIDs::RGB332,
+     pixel_format::detail::copyRowDDA_1ByteScalar},
 };
 static constexpr int NUM_DDA_FORMATS =
     sizeof(ddaFormatConfigs) / sizeof(ddaFormatConfigs[0]);
@@ -997,7 +1018,7 @@ static uint8_t *getDDASourceBuffer(int bytesPerPixel) {
 
 // Run single DDA test, return ns/px
 static double runDDATest(const ViewPort &srcVP, int /*bytesPerPixel*/,
-                         int testIdx) {
+                         int testIdx, CopyRowDDA_Func func = nullptr) {
   const auto &test = ddaTests[testIdx];
 
   // 出力ピクセル数を計算（ソース範囲内に収まる最大数、ラインバッファ上限も考慮）
@@ -1024,7 +1045,8 @@ static double runDDATest(const ViewPort &srcVP, int /*bytesPerPixel*/,
       }
       // Diagonal: always start from (0, 0)
 
-      benchCopyRowDDA(dst, srcVP, count, srcX, srcY, test.incrX, test.incrY);
+      benchCopyRowDDA(dst, srcVP, count, srcX, srcY, test.incrX, test.incrY,
+                      func);
     }
   });
 
@@ -1133,9 +1155,13 @@ static void runDDABenchmark(const char *args) {
     benchPrintf("Format: %s\n", cfg.formatID->name);
     benchPrintln();
     if (showBilinear) {
-      benchPrintf("%-12s %8s %8s %6s\n", "Test", "Nearest", "Bilinear",
-                  "Ratio");
-      benchPrintln("------------ -------- -------- ------");
+      benchPrintf("%-12s %8s %8s %6s %8s %6s\n", "Test", "Scalar", "Nearest",
+                  "Speed", "Bilinear", "Ratio");
+      benchPrintln("------------ -------- -------- ------ -------- ------");
+    } else if (cfg.scalar) {
+      benchPrintf("%-12s %7s %7s %7s %6s\n", "Test", "us/frm", "ns/px",
+                  "Scalar", "Speed");
+      benchPrintln("------------ ------- ------- ------- ------");
     } else {
       benchPrintf("%-12s %7s %7s\n", "Test", "us/frm", "ns/px");
       benchPrintln("------------ ------- -------");
@@ -1151,12 +1177,22 @@ static void runDDABenchmark(const char *args) {
         int totalPixels = count * numRows;
 
         double nsNearest = runDDATest(srcVP, cfg.bytesPerPixel, i);
+        double nsScalar =
+            cfg.scalar ? runDDATest(srcVP, cfg.bytesPerPixel, i, cfg.scalar)
+                       : nsNearest;
 
         if (showBilinear) {
           double nsBilinear = runDDATestBilinear(srcVP, i);
           double ratio = nsBilinear / nsNearest;
-          benchPrintf("%-12s %8.2f %8.2f %5.1fx\n", ddaTests[i].name, nsNearest,
-                      nsBilinear, ratio);
+          benchPrintf("%-12s %8.2f %8.2f %5.1fx %8.2f %5.1fx\n",
+                      ddaTests[i].name, nsScalar, nsNearest,
+                      nsScalar / nsNearest, nsBilinear, ratio);
+        } else if (cfg.scalar) {
+          auto us =
+              static_cast<uint32_t>(nsNearest * totalPixels / 1000.0 + 0.5);
+          benchPrintf("%-12s %7u %7.2f %7.2f %5.1fx  (%d x %d rows)\n",
+                      ddaTests[i].name, us, nsNearest, nsScalar,
+                      nsScalar / nsNearest, count, numRows);
         } else {
           auto us =
               static_cast<uint32_t>(nsNearest * totalPixels / 1000.0 + 0.5);
@@ -1214,6 +1250,39 @@ static void runDDABenchmark(const char *args) {
       benchPrintln("Available: all | h | v | d");
     }
 
+    // スカラー版との比較（SIMD版のないフォーマットは "-"）
+    if (found) {
+      benchPrintln();
+      benchPrintln("[Nearest interpolation - scalar]");
+      benchPrintf("%-12s", "Test");
+      for (int b = 0; b < numActive; b++) {
+        benchPrintf(" %7s", ddaFormatConfigs[activeFormatIdx[b]].label);
+      }
+      benchPrintln();
+      benchPrint("------------");
+      for (int b = 0; b < numActive; b++) {
+        benchPrint(" -------");
+      }
+      benchPrintln();
+      for (int i = 0; i < NUM_DDA_TESTS; i++) {
+        if (allGroups || strcmp(ddaTests[i].group, groupStr) == 0) {
+          benchPrintf("%-12s", ddaTests[i].name);
+          for (int b = 0; b < numActive; b++) {
+            const auto &cfg = ddaFormatConfigs[activeFormatIdx[b]];
+            if (!cfg.scalar) {
+              benchPrintf(" %7s", "-");
+              continue;
+            }
+            ViewPort srcVP(getDDASourceBuffer(cfg.bytesPerPixel), DDA_SRC_SIZE,
+                           DDA_SRC_SIZE, cfg.formatID);
+            benchPrintf(" %7.2f",
+                        runDDATest(srcVP, cfg.bytesPerPixel, i, cfg.scalar));
+          }
+          benchPrintln();
+        }
+      }
+    }
+
     // 4BPPが含まれていればBilinear結果を追加
     if (has4BytesPerPixel && found) {
       benchPrintln();
@@ -1673,7 +1742,8 @@ static void initCompositeSourceBuffers() {
   }
 }
 
-static void runCompositeBenchmark(int count) {
+static void runCompositeBenchmark(int count, bool rowSpanTable = true,
+                                  bool measureRanges = false) {
   static constexpr int W = COMPOSITE_SRC_SIZE;
   static constexpr int H = COMPOSITE_SRC_SIZE;
   static constexpr int RW = COMPOSITE_RENDER_WIDTH;
@@ -1693,19 +1763,39 @@ static void runCompositeBenchmark(int count) {
   int_fixed pivotX = float_to_fixed(W / 2.0f);
   int_fixed pivotY = float_to_fixed(H / 2.0f);
 
+  // 多数配置時の格子（画面全体に散らばるスプライト群を想定）
+  int gridCols = 1;
+  while (gridCols * gridCols * RH < count * RW) {
+    ++gridCols;
+  }
+  int gridRows = (count + gridCols - 1) / gridCols;
+
   // ソースノード初期化（AffineNodeを使わず直接アフィン指定）
+  // 画像バッファはMAX_COMPOSITE_SOURCES枚を使い回す
   for (int i = 0; i < count; ++i) {
-    ViewPort vp(compositeSourceBufs[i], PixelFormatIDs::RGBA8_Straight, W * 4,
-                W, H);
+    ViewPort vp(compositeSourceBufs[i % MAX_COMPOSITE_SOURCES],
+                PixelFormatIDs::RGBA8_Straight, W * 4, W, H);
     sources[i] = SourceNode(vp, pivotX, pivotY);
+    sources[i].setRowSpanTableEnabled(rowSpanTable);
 
-    // 円周配置 + スケール拡大 + 回転（m5stack_basic相当）
     float angle = static_cast<float>(i) * 6.2832f / static_cast<float>(count);
-    float radius = static_cast<float>(RW) * 0.25f;
     sources[i].setScale(COMPOSITE_SCALE, COMPOSITE_SCALE);
     sources[i].setRotation(angle);
-    sources[i].setTranslation(radius * std::cos(angle),
-                              radius * std::sin(angle));
+    if (count <= MAX_COMPOSITE_SOURCES) {
+      // 円周配置 + スケール拡大 + 回転（m5stack_basic相当）
+      float radius = static_cast<float>(RW) * 0.25f;
+      sources[i].setTranslation(radius * std::cos(angle),
+                                radius * std::sin(angle));
+    } else {
+      // 格子配置（各行に掛かるのは全体の一部のみ）
+      float cellW = static_cast<float>(RW) / static_cast<float>(gridCols);
+      float cellH = static_cast<float>(RH) / static_cast<float>(gridRows);
+      sources[i].setTranslation(
+          (static_cast<float>(i % gridCols) + 0.5f) * cellW -
+              static_cast<float>(RW) * 0.5f,
+          (static_cast<float>(i / gridCols) + 0.5f) * cellH -
+              static_cast<float>(RH) * 0.5f);
+    }
   }
 
   // パイプライン構築
@@ -1740,6 +1830,27 @@ static void runCompositeBenchmark(int count) {
   uint32_t us =
       (benchMicros() - start) / static_cast<uint32_t>(COMPOSITE_ITERATIONS);
 
+  // 範囲計算のみの計測（全ソース × 全行の getDataRange、最終フレームの状態）
+  uint32_t rangeUs = 0;
+  int rangeRows = 0;
+  if (measureRanges) {
+    RenderRequest req;
+    req.width = static_cast<int16_t>(RW);
+    req.height = 1;
+    req.origin.x = -float_to_fixed(RW / 2.0f);
+    uint32_t rangeStart = benchMicros();
+    for (int i = 0; i < COMPOSITE_ITERATIONS; ++i) {
+      for (int y = 0; y < RH; ++y) {
+        req.origin.y = to_fixed(y) - float_to_fixed(RH / 2.0f);
+        for (int j = 0; j < count; ++j) {
+          rangeRows += sources[j].getDataRange(req).hasData() ? 1 : 0;
+        }
+      }
+    }
+    rangeUs = (benchMicros() - rangeStart) /
+              static_cast<uint32_t>(COMPOSITE_ITERATIONS);
+  }
+
   delete[] sources;
 
   int pixelsPerIteration = RW * RH;
@@ -1747,8 +1858,13 @@ static void runCompositeBenchmark(int count) {
       static_cast<float>(us) * 1000.0f / static_cast<float>(pixelsPerIteration);
   float mpps = static_cast<float>(pixelsPerIteration) / static_cast<float>(us);
 
-  benchPrintf("  N=%2d  %6u us  %5.1f ns/px  %5.2f Mpix/s\n", count, us,
+  benchPrintf("  N=%4d  %-9s %6u us  %5.1f ns/px  %5.2f Mpix/s\n", count,
+              rowSpanTable ? "rows:on" : "rows:off", us,
               static_cast<double>(nsPerPx), static_cast<double>(mpps));
+  if (measureRanges) {
+    benchPrintf("          getDataRange x%d: %6u us (%d rows with data)\n",
+                count * RH, rangeUs, rangeRows / COMPOSITE_ITERATIONS);
+  }
 }
 
 static void runCompositeBenchmarks(const char *arg) {
@@ -1768,18 +1884,163 @@ static void runCompositeBenchmarks(const char *arg) {
   benchPrintln();
 
   static const int counts[] = {4, 8, 16, 32};
+  // 多数入力（N > 32 は画面全体に格子配置）
+  static const int manyCounts[] = {64, 256, 1000};
+  static const int rowsCounts[] = {16, 64, 256, 1000};
 
   if (strcmp(arg, "all") == 0) {
     for (int c : counts) {
       runCompositeBenchmark(c);
     }
+  } else if (strcmp(arg, "many") == 0) {
+    for (int c : manyCounts) {
+      if (c <= COMPOSITE_MAX_COUNT) {
+        runCompositeBenchmark(c);
+      }
+    }
+  } else if (strcmp(arg, "rows") == 0) {
+    // SourceNode行範囲テーブルの有無を比較
+    for (int c : rowsCounts) {
+      if (c <= COMPOSITE_MAX_COUNT) {
+        runCompositeBenchmark(c, false, true);
+        runCompositeBenchmark(c, true, true);
+      }
+    }
   } else {
     int n = atoi(arg);
-    if (n >= 1 && n <= MAX_COMPOSITE_SOURCES) {
+    if (n >= 1 && n <= COMPOSITE_MAX_COUNT) {
       runCompositeBenchmark(n);
     } else {
       benchPrintf("Unknown count: %s\n", arg);
-      benchPrintln("Available: all | 4 | 8 | 16 | 32");
+      benchPrintf("Available: all | many | rows | 1..%d\n",
+                  COMPOSITE_MAX_COUNT);
+    }
+  }
+
+  benchPrintln();
+}
+
+// =============================================================================
+// Blur Pipeline Benchmark
+// =============================================================================
+
+enum class BlurMode { Horizontal, Vertical, Both, Gaussian };
+
+// 1フレームあたりの処理時間（us）を返す
+static uint32_t runBlurBenchmark(BlurMode mode, int radius, int passes) {
+  static constexpr int RW = BLUR_RENDER_WIDTH;
+  static constexpr int RH = BLUR_RENDER_HEIGHT;
+
+  ViewPort srcView(bufRGBA8, PixelFormatIDs::RGBA8_Straight, BENCH_WIDTH * 4,
+                   BENCH_WIDTH, BENCH_HEIGHT);
+  SourceNode src(srcView, float_to_fixed(BENCH_WIDTH / 2.0f),
+                 float_to_fixed(BENCH_HEIGHT / 2.0f));
+  src.setScale(static_cast<float>(RW) / BENCH_WIDTH,
+               static_cast<float>(RH) / BENCH_HEIGHT);
+
+  HorizontalBlurNode hblur;
+  hblur.setRadius(radius);
+  hblur.setPasses(passes);
+  VerticalBlurNode vblur;
+  vblur.setRadius(radius);
+  vblur.setPasses(passes);
+  // ボックス3回（radius）と同じ重み: sigma = sqrt(r^2 + r)
+  GaussianBlurNode gblur;
+  gblur.setSigma(std::sqrt(static_cast<float>(radius * radius + radius)));
+
+  RendererNode renderer;
+  NullSinkNode sink(static_cast<int16_t>(RW), static_cast<int16_t>(RH),
+                    float_to_fixed(RW / 2.0f), float_to_fixed(RH / 2.0f));
+
+  switch (mode) {
+  case BlurMode::Horizontal:
+    src >> hblur >> renderer >> sink;
+    break;
+  case BlurMode::Vertical:
+    src >> vblur >> renderer >> sink;
+    break;
+  case BlurMode::Both:
+    src >> hblur >> vblur >> renderer >> sink;
+    break;
+  case BlurMode::Gaussian:
+    src >> gblur >> renderer >> sink;
+    break;
+  }
+  renderer.setVirtualScreen(RW, RH);
+  renderer.setPivotCenter();
+
+  // ウォームアップ
+  renderer.exec();
+
+  uint32_t start = benchMicros();
+  for (int i = 0; i < BLUR_ITERATIONS; ++i) {
+    renderer.exec();
+  }
+  return (benchMicros() - start) / static_cast<uint32_t>(BLUR_ITERATIONS);
+}
+
+static void runBlurBenchmarkRow(int radius, int passes) {
+  uint32_t hUs = runBlurBenchmark(BlurMode::Horizontal, radius, passes);
+  uint32_t vUs = runBlurBenchmark(BlurMode::Vertical, radius, passes);
+  uint32_t bothUs = runBlurBenchmark(BlurMode::Both, radius, passes);
+
+  float pixels = static_cast<float>(BLUR_RENDER_WIDTH * BLUR_RENDER_HEIGHT);
+  benchPrintf("  r=%-3d p=%d  %7u us %7u us %7u us  %6.1f ns/px", radius,
+              passes, hUs, vUs, bothUs,
+              static_cast<double>(static_cast<float>(bothUs) * 1000.0f /
+                                  pixels));
+  // GaussianBlurNode は passes=3 の H + V と同じ重み
+  if (passes == 3) {
+    uint32_t gaussUs = runBlurBenchmark(BlurMode::Gaussian, radius, passes);
+    benchPrintf("  %7u us", gaussUs);
+  }
+  benchPrintln();
+}
+
+static void runBlurBenchmarks(const char *arg) {
+  if (!allocateBuffers())
+    return;
+  initForegroundBuffer();
+
+  benchPrintln();
+  benchPrintln("=== Blur Pipeline Benchmark ===");
+  benchPrintf("Source: %dx%d RGBA8 (scaled), Output: %dx%d, Itr: %d\n",
+              BENCH_WIDTH, BENCH_HEIGHT, BLUR_RENDER_WIDTH, BLUR_RENDER_HEIGHT,
+              BLUR_ITERATIONS);
+  benchPrintln();
+  benchPrintln("Pipeline: SourceNode -> HorizontalBlurNode / VerticalBlurNode");
+  benchPrintln("          (Gauss: GaussianBlurNode, p=3 only)");
+  benchPrintln("          -> RendererNode -> NullSinkNode");
+  benchPrintln();
+  benchPrintf("  %-11s%7s    %7s    %7s     %6s    %7s\n", "radius/pass",
+              "H only", "V only", "H + V", "H + V", "Gauss");
+
+  // 引数: [radius] [passes]（"all" は radius 1/5/20、passes 省略時は 1〜3）
+  static const int radii[] = {1, 5, 20};
+  int radius = 0;
+  int passes = 0;
+  if (strcmp(arg, "all") != 0) {
+    char *end = nullptr;
+    radius = static_cast<int>(strtol(arg, &end, 10));
+    passes = static_cast<int>(strtol(end, nullptr, 10));
+    if (radius < 1 || radius > HorizontalBlurNode::kMaxRadius || passes < 0 ||
+        passes > 3) {
+      benchPrintf("Invalid argument: %s\n", arg);
+      benchPrintf("Usage: g [radius 1..%d] [passes 1..3]\n",
+                  HorizontalBlurNode::kMaxRadius);
+      return;
+    }
+  }
+
+  for (int r : radii) {
+    int rr = (radius != 0) ? radius : r;
+    for (int p = 1; p <= 3; ++p) {
+      if (passes == 0 || p == passes) {
+        runBlurBenchmarkRow(rr, p);
+      }
+    }
+    if (radius != 0) {
+      break;
     }
   }
 
@@ -1803,6 +2064,7 @@ static void printHelp() {
   benchPrintln("  m [pat]  : Matte composite benchmark (direct, no pipeline)");
   benchPrintln("  p [pat]  : Matte pipeline benchmark (full node pipeline)");
   benchPrintln("  o [N]    : Composite pipeline benchmark (N upstream nodes)");
+  benchPrintln("  g [r] [p]: Blur pipeline benchmark (radius, passes)");
   benchPrintln("  d        : Analyze alpha distribution of test data");
   benchPrintln("  s        : RenderResponse move cost benchmark");
   benchPrintln("  r        : RenderResponse move count in pipeline");
@@ -1844,7 +2106,12 @@ static void printHelp() {
   benchPrintln("  p all     - Matte pipeline with all mask patterns");
   benchPrintln("  p grad    - Matte pipeline with gradient mask");
   benchPrintln("  o all     - Composite pipeline with N=4,8,16,32");
+  benchPrintln("  o many    - Composite pipeline with N=64,256,1000 (grid layout)");
+  benchPrintln("  o rows    - Composite pipeline, SourceNode row table off/on");
   benchPrintln("  o 16      - Composite pipeline with 16 upstream nodes");
+  benchPrintln("  g all     - Blur pipeline, radius 1/5/20 x passes 1..3");
+  benchPrintln("  g 20      - Blur pipeline, radius 20, passes 1..3");
+  benchPrintln("  g 20 3    - Blur pipeline, radius 20, 3 passes");
   benchPrintln("  d         - Show alpha distribution analysis");
   benchPrintln();
 }
@@ -2127,6 +2394,10 @@ static void processCommand(const char *cmd) {
   case 'O':
     runCompositeBenchmarks(arg);
     break;
+  case 'g':
+  case 'G':
+    runBlurBenchmarks(arg);
+    break;
   case 'd':
   case 'D':
     runAlphaDistributionAnalysis();
@@ -2140,6 +2411,7 @@ static void processCommand(const char *cmd) {
     runMatteCompositeBenchmarks("all");
     runMattePipelineBenchmarks("all");
     runCompositeBenchmarks("all");
+    runBlurBenchmarks("all");
     break;
   case 'l':
   case 'L':
@@ -156,6 +156,181 @@ size_t PoolAllocator::usedBlockCount() const
     return count;
 }
 
+// ========================================================================
+// SizeClassPoolAllocator
+// ========================================================================
+
+int_fast8_t SizeClassPoolAllocator::countTrailingZeros(uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<int_fast8_t>(__builtin_ctz(value));
+#else
+    int_fast8_t n = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+size_t SizeClassPoolAllocator::requiredMemory(const SizeClassConfig *configs, size_t count)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += alignedBlockSize(configs[i].blockSize) * configs[i].blockCount;
+    }
+    return total;
+}
+
+bool SizeClassPoolAllocator::initialize(void *memory, const SizeClassConfig *configs, size_t count, bool isPSRAM)
+{
+    if (initialized_ || !memory || !configs || count == 0 || count > kMaxSizeClasses) {
+        return false;
+    }
+
+    // 設定の検証（blockSize昇順、ブロック数上限）
+    for (size_t i = 0; i < count; ++i) {
+        if (configs[i].blockSize == 0 || configs[i].blockCount == 0 ||
+            configs[i].blockCount > kMaxBlocksPerClass) {
+            return false;
+        }
+        if (i > 0 && configs[i].blockSize <= configs[i - 1].blockSize) {
+            return false;
+        }
+    }
+
+    // 各クラスのブロック領域を連続配置し、全ブロックを空きに設定
+    uint8_t *p = static_cast<uint8_t *>(memory);
+    for (size_t i = 0; i < count; ++i) {
+        SizeClass &cls = classes_[i];
+        cls.base       = p;
+        cls.blockSize  = alignedBlockSize(configs[i].blockSize);
+        cls.blockCount = configs[i].blockCount;
+        cls.usedBlocks = 0;
+
+        size_t fullWords = cls.blockCount / kWordBits;
+        size_t remainder = cls.blockCount % kWordBits;
+        size_t words     = fullWords + (remainder ? 1 : 0);
+        for (size_t w = 0; w < kMaxWordsPerClass; ++w) {
+            if (w < fullWords) {
+                cls.freeBits[w] = ~0U;
+            } else if (w == fullWords && remainder) {
+                cls.freeBits[w] = (1U << remainder) - 1;
+            } else {
+                cls.freeBits[w] = 0;
+            }
+        }
+        cls.freeSummary = (words >= kWordBits) ? ~0U : ((1U << words) - 1);
+
+        p += cls.blockSize * cls.blockCount;
+    }
+
+    classCount_  = count;
+    isPSRAM_     = isPSRAM;
+    initialized_ = true;
+    return true;
+}
+
+void *SizeClassPoolAllocator::allocate(size_t size)
+{
+    if (!initialized_ || size == 0) {
+        return nullptr;
+    }
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    stats_.totalAllocations++;
+#endif
+
+    // 要求サイズが収まる最小のクラスから探索（満杯なら次のクラス）
+    for (size_t i = 0; i < classCount_; ++i) {
+        SizeClass &cls = classes_[i];
+        if (cls.blockSize < size || cls.freeSummary == 0) continue;
+
+        // 階層ビットマップ: サマリ → ワードの順に最下位の空きビットを取得
+        auto w      = static_cast<size_t>(countTrailingZeros(cls.freeSummary));
+        auto b      = static_cast<size_t>(countTrailingZeros(cls.freeBits[w]));
+        size_t slot = w * kWordBits + b;
+
+        cls.freeBits[w] &= ~(1U << b);
+        if (cls.freeBits[w] == 0) {
+            cls.freeSummary &= ~(1U << w);
+        }
+        cls.usedBlocks++;
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+        stats_.hits++;
+        stats_.allocatedBitmap = leadingUsedBitmap();
+        size_t currentUsed     = usedBlockCount();
+        if (currentUsed > stats_.peakUsedBlocks) {
+            stats_.peakUsedBlocks = currentUsed;
+        }
+#endif
+        return cls.base + slot * cls.blockSize;
+    }
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    stats_.misses++;
+#endif
+    return nullptr;
+}
+
+bool SizeClassPoolAllocator::deallocate(void *ptr)
+{
+    if (!initialized_ || !ptr) {
+        return false;
+    }
+
+    uint8_t *p = static_cast<uint8_t *>(ptr);
+    for (size_t i = 0; i < classCount_; ++i) {
+        SizeClass &cls = classes_[i];
+        uint8_t *end   = cls.base + cls.blockSize * cls.blockCount;
+        if (p < cls.base || p >= end) continue;
+
+        size_t offset = static_cast<size_t>(p - cls.base);
+        size_t slot   = offset / cls.blockSize;
+        if (slot * cls.blockSize != offset) {
+            return false;  // ブロック先頭以外
+        }
+
+        size_t w = slot / kWordBits;
+        size_t b = slot % kWordBits;
+        if (cls.freeBits[w] & (1U << b)) {
+            return false;  // 二重解放
+        }
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+        stats_.totalDeallocations++;
+#endif
+        cls.freeBits[w] |= (1U << b);
+        cls.freeSummary |= (1U << w);
+        cls.usedBlocks--;
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+        stats_.allocatedBitmap = leadingUsedBitmap();
+#endif
+        return true;
+    }
+    return false;  // プール外
+}
+
+size_t SizeClassPoolAllocator::blockCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < classCount_; ++i) {
+        count += classes_[i].blockCount;
+    }
+    return count;
+}
+
+size_t SizeClassPoolAllocator::usedBlockCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < classCount_; ++i) {
+        count += classes_[i].usedBlocks;
+    }
+    return count;
+}
+
 }  // namespace memory
 }  // namespace core
 }  // namespace FLEXIMG_NAMESPACE
@@ -0,0 +1,133 @@
+/**
+ * @file scanline_arena.inl
+ * @brief スキャンライン用アリーナアロケータ 実装
+ * @see src/fleximg/core/memory/scanline_arena.h
+ */
+
+namespace FLEXIMG_NAMESPACE {
+namespace core {
+namespace memory {
+
+void *ScanlineArenaAllocator::allocate(size_t bytes, size_t alignment)
+{
+    if (bytes == 0) {
+        return nullptr;
+    }
+    if (alignment == 0) {
+        alignment = 1;
+    }
+
+    // 現在のチャンクから切り出し（アライメント調整分を含めて収まるか判定）
+    if (head_) {
+        uintptr_t addr    = reinterpret_cast<uintptr_t>(chunkData(head_)) + offset_;
+        uintptr_t aligned = (addr + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        size_t pad        = static_cast<size_t>(aligned - addr);
+        if (offset_ + pad + bytes <= head_->size) {
+            offset_ += pad + bytes;
+            used_ += pad + bytes;
+            if (used_ > highWater_) highWater_ = used_;
+            ++liveCount_;
+            return reinterpret_cast<void *>(aligned);
+        }
+    }
+
+    // 収まらない: 追加チャンクを確保（残り領域は次回 reset() まで使わない）
+    size_t align = (alignment > kChunkAlign) ? alignment : kChunkAlign;
+    if (!pushChunk(bytes + align - kChunkAlign)) {
+        return nullptr;
+    }
+
+    uintptr_t addr    = reinterpret_cast<uintptr_t>(chunkData(head_));
+    uintptr_t aligned = (addr + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+    size_t pad        = static_cast<size_t>(aligned - addr);
+    offset_           = pad + bytes;
+    used_ += pad + bytes;
+    if (used_ > highWater_) highWater_ = used_;
+    ++liveCount_;
+    return reinterpret_cast<void *>(aligned);
+}
+
+void ScanlineArenaAllocator::deallocate(void *ptr)
+{
+    if (!ptr) return;
+    // メモリは reset() で一括して巻き戻すため、ここでは使用中カウントのみ更新
+    FLEXIMG_ASSERT(liveCount_ > 0, "ScanlineArenaAllocator: deallocate without allocate");
+    if (liveCount_ > 0) --liveCount_;
+}
+
+void ScanlineArenaAllocator::setBacking(IAllocator *backing)
+{
+    if (backing == backing_) return;
+    release();
+    backing_ = backing;
+}
+
+void ScanlineArenaAllocator::reserve(size_t bytes)
+{
+    if (bytes <= capacity_ || liveCount_ > 0) return;
+    release();
+    pushChunk(bytes);
+}
+
+bool ScanlineArenaAllocator::reset()
+{
+    if (liveCount_ > 0) {
+        // スキャンラインを跨いで保持されている確保がある: 巻き戻すと破壊するため継続使用
+        FLEXIMG_DEBUG_WARN("WARN: ScanlineArenaAllocator reset with %d live allocations", static_cast<int>(liveCount_));
+        return false;
+    }
+
+    // 追加チャンクが発生していれば、ハイウォーターマークを収める単一チャンクに統合
+    // （チャンク境界でのアライメント差を吸収するため少し余裕を持たせる）
+    if (head_ && head_->next) {
+        size_t size = highWater_ + highWater_ / 8 + kChunkAlign;
+        release();
+        pushChunk(size);
+    }
+
+    offset_ = 0;
+    used_   = 0;
+    return true;
+}
+
+void ScanlineArenaAllocator::release()
+{
+    FLEXIMG_ASSERT(liveCount_ == 0, "ScanlineArenaAllocator: release with live allocations");
+    IAllocator &alloc = backing();
+    Chunk *chunk      = head_;
+    while (chunk) {
+        Chunk *next = chunk->next;
+        alloc.deallocate(chunk);
+        chunk = next;
+    }
+    head_     = nullptr;
+    offset_   = 0;
+    capacity_ = 0;
+    used_     = 0;
+}
+
+bool ScanlineArenaAllocator::pushChunk(size_t minSize)
+{
+    // 容量が倍々になるよう、既存容量以上のサイズで確保
+    size_t size = (minSize > kMinChunkSize) ? minSize : kMinChunkSize;
+    if (size < capacity_) size = capacity_;
+    size = (size + kChunkAlign - 1) & ~(kChunkAlign - 1);
+
+    void *mem = backing().allocate(chunkHeaderSize() + size, kChunkAlign);
+    if (!mem) {
+        return false;
+    }
+
+    Chunk *chunk = static_cast<Chunk *>(mem);
+    chunk->next  = head_;
+    chunk->size  = size;
+    head_        = chunk;
+    offset_      = 0;
+    capacity_ += size;
+    ++chunkAllocations_;
+    return true;
+}
+
+}  // namespace memory
+}  // namespace core
+}  // namespace FLEXIMG_NAMESPACE
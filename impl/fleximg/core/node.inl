@@ -75,6 +75,83 @@ void Node::initPorts(int_fast16_t inputCount, int_fast16_t outputCount)
     }
 }
 
+// 差分prepare: 前回の準備結果の再利用
+// 自身の変更カウンタ・要求・上流の接続が前回と同じ場合、上流を前回と同じ要求で準備し、
+// いずれの上流も再準備されなかった（prepare世代が不変）なら前回の結果を復元する
+bool Node::reusePreparedState(const PrepareRequest &request)
+{
+    RenderContext *ctx = request.context;
+    if (!preparedValid_ || !ctx || !ctx->isIncrementalPrepareEnabled() || !isPrepareReusable()) {
+        return false;
+    }
+    if (preparedRevision_ != revision_ || preparedEpoch_ != ctx->prepareEpoch() ||
+        !request.sameAs(preparedRequest_)) {
+        return false;
+    }
+
+    // 接続の変化は上流を準備する前に判定（新しい上流を前回の要求で準備しないため）
+    if (preparedInputs_.size() != inputs_.size()) return false;
+    for (size_t i = 0; i < inputs_.size(); ++i) {
+        Node *upstream = inputs_[i].connectedNode();
+        if (upstream != preparedInputs_[i].node) return false;
+        if (upstream && !upstream->preparedValid_) return false;
+    }
+
+    // 自身と要求が不変なら上流への要求も前回と同じ
+    // 上流が再準備された場合は通常のprepareへ（上流は同じ要求で準備済みのため二重準備にはならない）
+    for (size_t i = 0; i < inputs_.size(); ++i) {
+        Node *upstream = inputs_[i].connectedNode();
+        if (!upstream) continue;
+        PrepareRequest upstreamRequest = upstream->preparedRequest_;
+        upstreamRequest.context        = ctx;
+        if (!upstream->pullPrepare(upstreamRequest).ok()) return false;
+        if (upstream->prepareGeneration_ != preparedInputs_[i].generation) return false;
+    }
+
+    prepareResponse_.status = PrepareStatus::Prepared;
+    return true;
+}
+
+void Node::recordPreparedState(const PrepareRequest &request)
+{
+    ++prepareGeneration_;
+    RenderContext *ctx = request.context;
+    preparedValid_     = prepareResponse_.ok() && ctx && ctx->isIncrementalPrepareEnabled();
+    if (!preparedValid_) return;
+
+    preparedRequest_  = request;
+    preparedRevision_ = revision_;
+    preparedEpoch_    = ctx->prepareEpoch();
+    preparedInputs_.resize(inputs_.size());
+    for (size_t i = 0; i < inputs_.size(); ++i) {
+        Node *upstream      = inputs_[i].connectedNode();
+        preparedInputs_[i] = PreparedInput{upstream, upstream ? upstream->prepareGeneration_ : 0};
+    }
+}
+
+// ストリップ処理可否（上流方向）
+// 全入力を辿り、1つでも非対応ノードがあればfalse
+bool Node::isPullStripCapable() const
+{
+    if (!canProcessStrip()) return false;
+    for (const auto &port : inputs_) {
+        Node *upstream = port.connectedNode();
+        if (upstream && !upstream->isPullStripCapable()) return false;
+    }
+    return true;
+}
+
+// ストリップ処理可否（下流方向）
+bool Node::isPushStripCapable() const
+{
+    if (!canProcessStrip()) return false;
+    for (const auto &port : outputs_) {
+        Node *downstream = port.connectedNode();
+        if (downstream && !downstream->isPushStripCapable()) return false;
+    }
+    return true;
+}
+
 // バッファ整理ヘルパー
 // フォーマット変換を行う
 void Node::consolidateIfNeeded(RenderResponse &input, PixelFormatID format)
@@ -101,8 +178,9 @@ void Node::consolidateIfNeeded(RenderResponse &input, PixelFormatID format)
 // RenderContext経由でResponseを取得し、バッファにワールド座標originを設定して追加
 RenderResponse &Node::makeResponse(ImageBuffer &&buf, Point origin)
 {
-    FLEXIMG_ASSERT(context_ != nullptr, "RenderContext required for makeResponse");
-    RenderResponse &resp = context_->acquireResponse();
+    RenderContext *ctx = context();
+    FLEXIMG_ASSERT(ctx != nullptr, "RenderContext required for makeResponse");
+    RenderResponse &resp = ctx->acquireResponse();
     if (buf.isValid()) {
         buf.setOrigin(origin);
         resp.addBuffer(std::move(buf));
@@ -114,8 +192,9 @@ RenderResponse &Node::makeResponse(ImageBuffer &&buf, Point origin)
 // 空のRenderResponseを構築
 RenderResponse &Node::makeEmptyResponse(Point origin)
 {
-    FLEXIMG_ASSERT(context_ != nullptr, "RenderContext required for makeEmptyResponse");
-    RenderResponse &resp = context_->acquireResponse();
+    RenderContext *ctx = context();
+    FLEXIMG_ASSERT(ctx != nullptr, "RenderContext required for makeEmptyResponse");
+    RenderResponse &resp = ctx->acquireResponse();
     resp.origin          = origin;
     return resp;
 }
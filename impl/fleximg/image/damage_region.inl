@@ -0,0 +1,177 @@
+/**
+ * @file damage_region.inl
+ * @brief DamageRegion 実装
+ * @see src/fleximg/image/damage_region.h
+ */
+
+namespace FLEXIMG_NAMESPACE {
+
+// ============================================================================
+// DamageRect
+// ============================================================================
+
+DamageRect DamageRect::united(const DamageRect &other) const
+{
+    if (empty()) return other;
+    if (other.empty()) return *this;
+    DamageRect r;
+    r.x0 = std::min(x0, other.x0);
+    r.y0 = std::min(y0, other.y0);
+    r.x1 = std::max(x1, other.x1);
+    r.y1 = std::max(y1, other.y1);
+    return r;
+}
+
+DamageRect DamageRect::intersected(const DamageRect &other) const
+{
+    DamageRect r;
+    r.x0 = std::max(x0, other.x0);
+    r.y0 = std::max(y0, other.y0);
+    r.x1 = std::min(x1, other.x1);
+    r.y1 = std::min(y1, other.y1);
+    if (r.empty()) return DamageRect{};
+    return r;
+}
+
+// ============================================================================
+// DamageRegion
+// ============================================================================
+
+void DamageRegion::add(const DamageRect &rect)
+{
+    if (rect.empty()) return;
+
+    // 重なる矩形を吸収して外接矩形に統合（統合後に新たな重なりが生じれば繰り返す）
+    DamageRect merged = rect;
+    for (int i = 0; i < count_;) {
+        if (rects_[i].contains(merged)) return;
+        if (merged.intersects(rects_[i])) {
+            merged = merged.united(rects_[i]);
+            removeAt(i);
+            i = 0;
+            continue;
+        }
+        ++i;
+    }
+
+    while (count_ >= MAX_RECTS) {
+        // 上限: 面積の増加が最小になる矩形と統合
+        int best           = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for (int i = 0; i < count_; ++i) {
+            DamageRect u   = merged.united(rects_[i]);
+            int32_t growth = u.area() - merged.area() - rects_[i].area();
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                best       = i;
+            }
+        }
+        merged = merged.united(rects_[best]);
+        removeAt(best);
+
+        // 統合で広がった分の重なりを吸収
+        for (int i = 0; i < count_;) {
+            if (merged.intersects(rects_[i])) {
+                merged = merged.united(rects_[i]);
+                removeAt(i);
+                i = 0;
+                continue;
+            }
+            ++i;
+        }
+    }
+    rects_[count_++] = merged;
+}
+
+void DamageRegion::add(const DamageRegion &other)
+{
+    for (int i = 0; i < other.count_; ++i) {
+        add(other.rects_[i]);
+    }
+}
+
+void DamageRegion::expand(int_fast16_t marginX, int_fast16_t marginY)
+{
+    if (marginX == 0 && marginY == 0) return;
+
+    // 拡張で重なりが生じるため、追加し直して統合する
+    DamageRect source[MAX_RECTS];
+    int n = count_;
+    for (int i = 0; i < n; ++i) {
+        source[i]    = rects_[i];
+        source[i].x0 = clampDamageCoord(static_cast<int32_t>(source[i].x0 - marginX));
+        source[i].y0 = clampDamageCoord(static_cast<int32_t>(source[i].y0 - marginY));
+        source[i].x1 = clampDamageCoord(static_cast<int32_t>(source[i].x1 + marginX));
+        source[i].y1 = clampDamageCoord(static_cast<int32_t>(source[i].y1 + marginY));
+    }
+    count_ = 0;
+    for (int i = 0; i < n; ++i) {
+        add(source[i]);
+    }
+}
+
+void DamageRegion::clip(const DamageRect &bounds)
+{
+    for (int i = 0; i < count_;) {
+        rects_[i] = rects_[i].intersected(bounds);
+        if (rects_[i].empty()) {
+            removeAt(i);
+            continue;
+        }
+        ++i;
+    }
+}
+
+DamageRect DamageRegion::bounds() const
+{
+    DamageRect r;
+    for (int i = 0; i < count_; ++i) {
+        r = r.united(rects_[i]);
+    }
+    return r;
+}
+
+int32_t DamageRegion::area() const
+{
+    int32_t total = 0;
+    for (int i = 0; i < count_; ++i) {
+        total += rects_[i].area();
+    }
+    return total;
+}
+
+int_fast16_t DamageRegion::spans(int_fast16_t y0, int_fast16_t y1, DataRange *out, int_fast16_t maxSpans) const
+{
+    // 行範囲と交差する矩形のX区間を収集
+    DataRange found[MAX_RECTS];
+    int n = 0;
+    for (int i = 0; i < count_; ++i) {
+        const DamageRect &r = rects_[i];
+        if (r.y0 < y1 && y0 < r.y1) {
+            found[n++] = DataRange{r.x0, r.x1};
+        }
+    }
+    if (n == 0) return 0;
+
+    // 開始位置で整列し（最大 MAX_RECTS 要素のため挿入ソート）、重なる・隣接する区間を統合
+    // 出力先が足りない場合は最後の区間に寄せる（範囲は狭めない）
+    for (int i = 1; i < n; ++i) {
+        const DataRange key = found[i];
+        int j               = i;
+        for (; j > 0 && found[j - 1].startX > key.startX; --j) {
+            found[j] = found[j - 1];
+        }
+        found[j] = key;
+    }
+    int_fast16_t count = 0;
+    for (int i = 0; i < n; ++i) {
+        if (count > 0 && (found[i].startX <= out[count - 1].endX || count >= maxSpans)) {
+            out[count - 1].endX = std::max(out[count - 1].endX, found[i].endX);
+        } else if (count < maxSpans) {
+            out[count++] = found[i];
+        }
+    }
+    return count;
+}
+
+}  // namespace FLEXIMG_NAMESPACE
@@ -0,0 +1,93 @@
+/**
+ * @file data_range.inl
+ * @brief DataRangeList 実装
+ * @see src/fleximg/image/data_range.h
+ */
+
+namespace FLEXIMG_NAMESPACE {
+
+// ============================================================================
+// DataRangeList
+// ============================================================================
+
+void DataRangeList::add(DataRange range)
+{
+    if (!range.hasData() || capacity <= 0) return;
+
+    // 挿入位置を探し、重なる・隣接する区間を吸収
+    int_fast16_t first = 0;
+    while (first < count && spans[first].endX < range.startX) ++first;
+    int_fast16_t last = first;
+    while (last < count && spans[last].startX <= range.endX) {
+        range.startX = std::min(range.startX, spans[last].startX);
+        range.endX   = std::max(range.endX, spans[last].endX);
+        ++last;
+    }
+
+    if (first < last) {
+        // [first, last) を1区間に置き換え
+        spans[first]         = range;
+        int_fast16_t removed = static_cast<int_fast16_t>(last - first - 1);
+        for (int_fast16_t i = first + 1; i + removed < count; ++i) {
+            spans[i] = spans[i + removed];
+        }
+        count = static_cast<int_fast16_t>(count - removed);
+        return;
+    }
+
+    if (count == capacity) {
+        // 満杯: 隙間が最小となる統合を行う（新区間を隣へ吸収するか、既存の隣接2区間を統合して空きを作る）
+        int_fast16_t leftGap  = INT16_MAX;
+        int_fast16_t rightGap = INT16_MAX;
+        if (first > 0) leftGap = static_cast<int_fast16_t>(range.startX - spans[first - 1].endX);
+        if (first < count) rightGap = static_cast<int_fast16_t>(spans[first].startX - range.endX);
+
+        int_fast16_t best    = -1;
+        int_fast16_t bestGap = std::min(leftGap, rightGap);
+        for (int_fast16_t i = 0; i + 1 < count; ++i) {
+            auto gap = static_cast<int_fast16_t>(spans[i + 1].startX - spans[i].endX);
+            if (gap < bestGap) {
+                bestGap = gap;
+                best    = i;
+            }
+        }
+
+        if (best < 0) {
+            if (leftGap <= rightGap) {
+                spans[first - 1].endX = range.endX;
+            } else {
+                spans[first].startX = range.startX;
+            }
+            return;
+        }
+        spans[best].endX = spans[best + 1].endX;
+        for (int_fast16_t i = best + 1; i + 1 < count; ++i) {
+            spans[i] = spans[i + 1];
+        }
+        --count;
+        if (first > best) --first;
+    }
+
+    // 新規区間を挿入
+    for (int_fast16_t i = count; i > first; --i) {
+        spans[i] = spans[i - 1];
+    }
+    spans[first] = range;
+    ++count;
+}
+
+void DataRangeList::closeGaps(int_fast16_t minGap)
+{
+    if (count <= 1) return;
+    int_fast16_t n = 1;
+    for (int_fast16_t i = 1; i < count; ++i) {
+        if (spans[i].startX - spans[n - 1].endX < minGap) {
+            spans[n - 1].endX = spans[i].endX;
+        } else {
+            spans[n++] = spans[i];
+        }
+    }
+    count = n;
+}
+
+}  // namespace FLEXIMG_NAMESPACE
@@ -4,6 +4,8 @@
  * @see src/fleximg/image/pixel_format/dda.h
  */
 
+#include "dda_simd.inl"
+
 namespace FLEXIMG_NAMESPACE {
 namespace pixel_format {
 namespace detail {
@@ -267,19 +269,49 @@ template void copyRowDDA_Byte<3>(uint8_t *, const uint8_t *, int_fast16_t, const
 template void copyRowDDA_Byte<4>(uint8_t *, const uint8_t *, int_fast16_t, const DDAParam *);
 
 // BytesPerPixel別の関数ポインタ取得用ラッパー（非テンプレート）
+// 1/2/4 バイトは初回呼び出し時にCPU機能を判定し、SIMD版を選択する
 inline void copyRowDDA_1Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param)
 {
+#ifdef FLEXIMG_SIMD_X86
+    static const auto copy = selectCopyRowDDA<1>();
+    copy(dst, srcData, count, param);
+#else
     copyRowDDA_Byte<1>(dst, srcData, count, param);
+#endif
 }
 inline void copyRowDDA_2Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param)
 {
+#ifdef FLEXIMG_SIMD_X86
+    static const auto copy = selectCopyRowDDA<2>();
+    copy(dst, srcData, count, param);
+#else
     copyRowDDA_Byte<2>(dst, srcData, count, param);
+#endif
 }
 inline void copyRowDDA_3Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param)
 {
     copyRowDDA_Byte<3>(dst, srcData, count, param);
 }
 inline void copyRowDDA_4Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param)
+{
+#ifdef FLEXIMG_SIMD_X86
+    static const auto copy = selectCopyRowDDA<4>();
+    copy(dst, srcData, count, param);
+#else
+    copyRowDDA_Byte<4>(dst, srcData, count, param);
+#endif
+}
+
+// スカラー版（SIMD版との比較・検証用）
+void copyRowDDA_1ByteScalar(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param)
+{
+    copyRowDDA_Byte<1>(dst, srcData, count, param);
+}
+void copyRowDDA_2ByteScalar(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param)
+{
+    copyRowDDA_Byte<2>(dst, srcData, count, param);
+}
+void copyRowDDA_4ByteScalar(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param)
 {
     copyRowDDA_Byte<4>(dst, srcData, count, param);
 }
@@ -0,0 +1,292 @@
+/**
+ * @file dda_simd.inl
+ * @brief DDA 行転写（最近傍）の SIMD 実装（x86: AVX2）
+ * @see impl/fleximg/image/pixel_format/dda.inl
+ *
+ * 共通部（有効判定・CPU機能判定）は simd_x86.inl
+ * 複数ピクセル分のソース座標をベクタで計算し、以下のいずれかでピクセルを取得する。
+ *   窓ロード: Y座標一定かつ |incrX| <= 1.0（平行移動・拡大・左右反転）の場合、
+ *             連続するピクセルが参照するソース列は隣接した範囲に収まる（拡大時は同じ列が連続する）。
+ *             その範囲を1回読み込み、ピクセル単位の並べ替え（permutevar8x32 / pshufb）で展開する
+ *   ギャザー: 縮小・回転は vpgatherdd で8ピクセルを個別に取得する。1/2バイトのピクセルは
+ *             4バイト境界に揃えた32bit単位で読み込み、シフトで取り出して詰める
+ *   X座標一定（90度回転等）はスカラー版のまま（行ごとのメモリアクセスが律速のため）
+ * 窓ロードは行内で参照する範囲の外を読まない。ギャザーも範囲外のページには触れない。
+ */
+
+#include "simd_x86.inl"
+
+#include <cstring>
+
+#ifdef FLEXIMG_SIMD_X86
+
+namespace FLEXIMG_NAMESPACE {
+namespace pixel_format {
+namespace detail {
+
+// スカラー版（dda.inl）: 端数処理・SIMD非対応CPU・座標範囲外用
+template <size_t BytesPerPixel>
+void copyRowDDA_Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param);
+
+// BytesPerPixel -> シフト量（1: 0, 2: 1, 4: 2）
+template <size_t BytesPerPixel>
+constexpr int ddaPixelShift()
+{
+    return BytesPerPixel == 4 ? 2 : (BytesPerPixel == 2 ? 1 : 0);
+}
+
+// ========================================================================
+// 8ピクセルのストア（32bitレーンの下位 BytesPerPixel バイトを詰める）
+// ========================================================================
+
+template <size_t BytesPerPixel>
+__attribute__((target("avx2"))) static inline void ddaStore8_avx2(uint8_t *d, __m256i v)
+{
+    if constexpr (BytesPerPixel == 4) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d), v);
+    } else {
+        // 各レーンは BytesPerPixel バイトでマスク済みのため、飽和packでも値は変わらない
+        __m128i p16 = _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        if constexpr (BytesPerPixel == 2) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(d), p16);
+        } else {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(d), _mm_packus_epi16(p16, p16));
+        }
+    }
+}
+
+// 4バイト単位で読み込んだ値から、バイトオフセット（下位2bit）位置のピクセルを取り出す
+template <size_t BytesPerPixel>
+__attribute__((target("avx2"))) static inline __m256i ddaExtract_avx2(__m256i dword, __m256i byteOffset)
+{
+    if constexpr (BytesPerPixel == 4) {
+        (void)byteOffset;
+        return dword;
+    } else {
+        const __m256i shift = _mm256_slli_epi32(_mm256_and_si256(byteOffset, _mm256_set1_epi32(3)), 3);
+        const __m256i mask  = _mm256_set1_epi32(BytesPerPixel == 2 ? 0xFFFF : 0xFF);
+        return _mm256_and_si256(_mm256_srlv_epi32(dword, shift), mask);
+    }
+}
+
+// ========================================================================
+// 窓ロード版（Y座標一定、|incrX| <= 1.0）
+//
+// 連続するNピクセルのソース列は [base, base + span]（span <= N - 1）に収まる。
+// その範囲を1回読み込み、ピクセル単位の並べ替えで各出力位置に配置する。
+//   4バイト: 8ピクセル、必要な分だけマスク付きロード（マスク外は読まない）+ permutevar8x32
+//   2バイト: 8ピクセル、16バイトロード + pshufb
+//   1バイト: 16ピクセル、16バイトロード + pshufb
+// 16バイトロードは行全体で参照するソース範囲 [lo, hi)（座標が単調なため両端のピクセルで決まる）
+// の内側から行い、範囲外（行の前後・確保領域外）のバイトは読まない。
+// 範囲の端で16バイトに満たないブロックは、必要なバイトのみ一時領域へコピーして読み込む。
+// 戻り値は処理したピクセル数（端数は呼び出し側でスカラー版により処理）。
+// ========================================================================
+
+// 必要なバイト [p, p + n)（n <= 16）を含む16バイトを読み込む（lead: 窓内での p の位置）
+// [lo, hi) からはみ出す場合は hi で終わる位置に寄せ、それも収まらなければ必要なバイトのみコピーする
+__attribute__((target("avx2"))) static inline __m128i ddaLoadWindow16(const uint8_t *p, int32_t n, const uint8_t *lo,
+                                                                      const uint8_t *hi, int32_t &lead)
+{
+    if (hi - p >= 16) {
+        lead = 0;
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    }
+    if (hi - lo >= 16) {
+        lead = static_cast<int32_t>(p - (hi - 16));
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(hi - 16));
+    }
+    alignas(16) uint8_t edge[16] = {};
+    std::memcpy(edge, p, static_cast<size_t>(n));
+    lead = 0;
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(edge));
+}
+
+template <size_t BytesPerPixel>
+__attribute__((target("avx2"))) static int_fast16_t copyRowDDA_Window_avx2(uint8_t *__restrict__ dst,
+                                                                           const uint8_t *__restrict__ srcRow,
+                                                                           int_fixed srcX, int_fixed incrX,
+                                                                           int_fast16_t count)
+{
+    constexpr int Pixels = BytesPerPixel == 1 ? 16 : 8;
+    const __m256i lane   = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const auto stepLast  = static_cast<uint32_t>(incrX) * static_cast<uint32_t>(Pixels - 1);
+    const auto stepBlock = static_cast<uint32_t>(incrX) * static_cast<uint32_t>(Pixels);
+    const __m256i vstep  = _mm256_set1_epi32(static_cast<int32_t>(stepBlock));
+    const __m256i vhalf  = _mm256_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(incrX) * 8u));
+    __m256i vx = _mm256_add_epi32(_mm256_set1_epi32(srcX), _mm256_mullo_epi32(_mm256_set1_epi32(incrX), lane));
+    auto x     = static_cast<uint32_t>(srcX);
+
+    const int_fast16_t blocks = count / Pixels;
+    if (blocks == 0) return 0;
+
+    // 処理する全ピクセルが参照するソース範囲 [lo, hi)（座標は単調なので両端のピクセルで決まる）
+    const auto xEnd   = x + static_cast<uint32_t>(incrX) * static_cast<uint32_t>(blocks * Pixels - 1);
+    int32_t colFirst  = static_cast<int32_t>(x) >> INT_FIXED_SHIFT;
+    int32_t colLast   = static_cast<int32_t>(xEnd) >> INT_FIXED_SHIFT;
+    int32_t colMin    = colFirst < colLast ? colFirst : colLast;
+    int32_t colMax    = colFirst < colLast ? colLast : colFirst;
+    const uint8_t *lo = srcRow + static_cast<ptrdiff_t>(colMin) * static_cast<ptrdiff_t>(BytesPerPixel);
+    const uint8_t *hi = srcRow + static_cast<ptrdiff_t>(colMax + 1) * static_cast<ptrdiff_t>(BytesPerPixel);
+
+    for (int_fast16_t i = 0; i < blocks; i++) {
+        // 座標は単調なので、先頭と末尾のピクセルが範囲の両端になる
+        int32_t sxFirst  = static_cast<int32_t>(x) >> INT_FIXED_SHIFT;
+        int32_t sxLast   = static_cast<int32_t>(x + stepLast) >> INT_FIXED_SHIFT;
+        int32_t base     = sxFirst < sxLast ? sxFirst : sxLast;
+        int32_t span     = sxFirst < sxLast ? sxLast - sxFirst : sxFirst - sxLast;
+        const uint8_t *p = srcRow + static_cast<ptrdiff_t>(base) * static_cast<ptrdiff_t>(BytesPerPixel);
+        __m256i rel      = _mm256_sub_epi32(_mm256_srai_epi32(vx, INT_FIXED_SHIFT), _mm256_set1_epi32(base));
+
+        if constexpr (BytesPerPixel == 4) {
+            __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(span + 1), lane);
+            __m256i win  = _mm256_maskload_epi32(reinterpret_cast<const int *>(p), mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_permutevar8x32_epi32(win, rel));
+        } else {
+            int32_t offset;
+            const __m128i win  = ddaLoadWindow16(p, (span + 1) * static_cast<int32_t>(BytesPerPixel), lo, hi, offset);
+            const __m128i lead = _mm_set1_epi8(static_cast<char>(offset));
+            __m128i ctrl;
+            if constexpr (BytesPerPixel == 2) {
+                // ピクセル位置 r -> バイト [2r, 2r + 1]
+                __m128i r16 = _mm_packus_epi32(_mm256_castsi256_si128(rel), _mm256_extracti128_si256(rel, 1));
+                ctrl        = _mm_add_epi16(_mm_mullo_epi16(r16, _mm_set1_epi16(0x0202)), _mm_set1_epi16(0x0100));
+            } else {
+                __m256i rel2 = _mm256_sub_epi32(_mm256_srai_epi32(_mm256_add_epi32(vx, vhalf), INT_FIXED_SHIFT),
+                                                _mm256_set1_epi32(base));
+                // packは128bitレーン単位のため、64bit単位で並べ替えてピクセル順に戻す
+                __m256i r16 = _mm256_permute4x64_epi64(_mm256_packus_epi32(rel, rel2), 0xD8);
+                ctrl        = _mm_packus_epi16(_mm256_castsi256_si128(r16), _mm256_extracti128_si256(r16, 1));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(win, _mm_add_epi8(ctrl, lead)));
+        }
+        dst += BytesPerPixel * Pixels;
+        x += stepBlock;
+        vx = _mm256_add_epi32(vx, vstep);
+    }
+    return blocks * Pixels;
+}
+
+// ========================================================================
+// ギャザー版（汎用: 縮小・回転を含む）
+//
+// オフセット = sy * srcStride + sx * BytesPerPixel（呼び出し側で int32 に収まることを確認済み）
+// 1/2バイトは4バイト境界に揃えた基点からのオフセットで、32bit単位に切り下げて取得する。
+// 戻り値は処理したピクセル数（8ピクセル単位）。
+// ========================================================================
+
+template <size_t BytesPerPixel>
+__attribute__((target("avx2"))) static int_fast16_t copyRowDDA_Gather_avx2(uint8_t *__restrict__ dst,
+                                                                           const uint8_t *__restrict__ srcData,
+                                                                           const DDAParam *param, int_fast16_t count)
+{
+    constexpr int Shift = ddaPixelShift<BytesPerPixel>();
+    const __m256i lane  = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const auto lead     = static_cast<int32_t>(BytesPerPixel == 4 ? 0 : reinterpret_cast<uintptr_t>(srcData) & 3);
+    const auto *base    = reinterpret_cast<const int *>(srcData - lead);
+    __m256i vx          = _mm256_add_epi32(_mm256_set1_epi32(param->srcX),
+                                           _mm256_mullo_epi32(_mm256_set1_epi32(param->incrX), lane));
+    __m256i vy          = _mm256_add_epi32(_mm256_set1_epi32(param->srcY),
+                                           _mm256_mullo_epi32(_mm256_set1_epi32(param->incrY), lane));
+    const __m256i stepX = _mm256_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(param->incrX) * 8u));
+    const __m256i stepY = _mm256_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(param->incrY) * 8u));
+    const __m256i strd  = _mm256_set1_epi32(param->srcStride);
+    const __m256i vlead = _mm256_set1_epi32(lead);
+
+    const int_fast16_t blocks = count >> 3;
+    for (int_fast16_t i = 0; i < blocks; i++) {
+        __m256i sx  = _mm256_srai_epi32(vx, INT_FIXED_SHIFT);
+        __m256i sy  = _mm256_srai_epi32(vy, INT_FIXED_SHIFT);
+        __m256i off = _mm256_add_epi32(_mm256_mullo_epi32(sy, strd), _mm256_slli_epi32(sx, Shift));
+        __m256i v;
+        if constexpr (BytesPerPixel == 4) {
+            v = _mm256_i32gather_epi32(base, off, 1);
+        } else {
+            off        = _mm256_add_epi32(off, vlead);
+            __m256i dw = _mm256_i32gather_epi32(base, _mm256_andnot_si256(_mm256_set1_epi32(3), off), 1);
+            v          = ddaExtract_avx2<BytesPerPixel>(dw, off);
+        }
+        ddaStore8_avx2<BytesPerPixel>(dst, v);
+        dst += BytesPerPixel * 8;
+        vx = _mm256_add_epi32(vx, stepX);
+        vy = _mm256_add_epi32(vy, stepY);
+    }
+    return blocks * 8;
+}
+
+// ========================================================================
+// 行転写（窓ロード版・ギャザー版を選択、端数はスカラー版）
+// ========================================================================
+
+// ギャザーのオフセット（sy * srcStride + sx * BytesPerPixel + 3）と
+// 終端座標が int32 に収まるか判定（収まらない場合はスカラー版を使用）
+template <size_t BytesPerPixel>
+static bool ddaOffsetsFitInt32(int_fast16_t count, const DDAParam *param)
+{
+    const int64_t last  = static_cast<int64_t>(count) - 1;
+    const int64_t xLast = static_cast<int64_t>(param->srcX) + static_cast<int64_t>(param->incrX) * last;
+    const int64_t yLast = static_cast<int64_t>(param->srcY) + static_cast<int64_t>(param->incrY) * last;
+    if (xLast < INT32_MIN || xLast > INT32_MAX || yLast < INT32_MIN || yLast > INT32_MAX) return false;
+
+    // 座標は単調なので、各項の範囲は両端の値で決まる
+    const int64_t stride = param->srcStride;
+    int64_t x0           = static_cast<int64_t>(param->srcX >> INT_FIXED_SHIFT) * static_cast<int64_t>(BytesPerPixel);
+    int64_t x1           = (xLast >> INT_FIXED_SHIFT) * static_cast<int64_t>(BytesPerPixel);
+    int64_t y0           = static_cast<int64_t>(param->srcY >> INT_FIXED_SHIFT) * stride;
+    int64_t y1           = (yLast >> INT_FIXED_SHIFT) * stride;
+    int64_t minOff       = (x0 < x1 ? x0 : x1) + (y0 < y1 ? y0 : y1);
+    int64_t maxOff       = (x0 < x1 ? x1 : x0) + (y0 < y1 ? y1 : y0) + 3;
+    return minOff >= INT32_MIN && maxOff <= INT32_MAX;
+}
+
+template <size_t BytesPerPixel>
+__attribute__((target("avx2"))) static void copyRowDDA_avx2(uint8_t *dst, const uint8_t *srcData, int_fast16_t count,
+                                                            const DDAParam *param)
+{
+    const int_fixed srcX  = param->srcX;
+    const int_fixed srcY  = param->srcY;
+    const int_fixed incrX = param->incrX;
+    const int_fixed incrY = param->incrY;
+
+    int_fast16_t done = 0;
+    // スカラー版と同じ判定でソース行が同一か確認する
+    const bool constY = 0 == (((srcY & ((1 << INT_FIXED_SHIFT) - 1)) + incrY * count) >> INT_FIXED_SHIFT);
+    if (constY && incrX >= -INT_FIXED_ONE && incrX <= INT_FIXED_ONE) {
+        const uint8_t *srcRow =
+            srcData + static_cast<ptrdiff_t>(srcY >> INT_FIXED_SHIFT) * static_cast<ptrdiff_t>(param->srcStride);
+        done = copyRowDDA_Window_avx2<BytesPerPixel>(dst, srcRow, srcX, incrX, count);
+    } else {
+        // X座標一定（90度回転等）は1ピクセルごとに別の行を読むメモリ律速となり、
+        // ギャザーの利点がないためスカラー版（copyRowDDA_ConstX）を使用する
+        const bool constX = 0 == (((srcX & ((1 << INT_FIXED_SHIFT) - 1)) + incrX * count) >> INT_FIXED_SHIFT);
+        // 2バイトはピクセルが4バイト境界を跨がないこと（先頭・ストライドが偶数）を前提とする
+        const bool misaligned =
+            (BytesPerPixel == 2) &&
+            ((reinterpret_cast<uintptr_t>(srcData) | static_cast<uint32_t>(param->srcStride)) & 1u) != 0;
+        if (!constX && !misaligned && ddaOffsetsFitInt32<BytesPerPixel>(count, param)) {
+            done = copyRowDDA_Gather_avx2<BytesPerPixel>(dst, srcData, param, count);
+        }
+    }
+
+    if (done < count) {
+        DDAParam tail = *param;
+        tail.srcX = static_cast<int_fixed>(static_cast<uint32_t>(srcX) + static_cast<uint32_t>(incrX * done));
+        tail.srcY = static_cast<int_fixed>(static_cast<uint32_t>(srcY) + static_cast<uint32_t>(incrY * done));
+        copyRowDDA_Byte<BytesPerPixel>(dst + done * static_cast<int_fast16_t>(BytesPerPixel), srcData, count - done,
+                                       &tail);
+    }
+}
+
+// CPU機能に応じた実装を選択（AVX2 > スカラー）
+template <size_t BytesPerPixel>
+static CopyRowDDA_Func selectCopyRowDDA()
+{
+    if (cpuFeatures().avx2) return copyRowDDA_avx2<BytesPerPixel>;
+    return copyRowDDA_Byte<BytesPerPixel>;
+}
+
+}  // namespace detail
+}  // namespace pixel_format
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_SIMD_X86
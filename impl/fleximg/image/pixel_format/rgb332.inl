@@ -5,6 +5,7 @@
  */
 
 #include "../../../../src/fleximg/core/format_metrics.h"
+#include "rgb332_simd.inl"
 
 namespace FLEXIMG_NAMESPACE {
 
@@ -41,9 +42,8 @@ alignas(64) static const uint32_t rgb332ToRgba8[256] = {
 
 }  // namespace
 
-static void rgb332_toStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+static void rgb332_toStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGB332, ToStraight, pixelCount);
     pixel_format::detail::lut8to32(static_cast<uint32_t *>(dst), static_cast<const uint8_t *>(src), pixelCount,
                                    rgb332ToRgba8);
 }
@@ -52,9 +52,8 @@ static void rgb332_toStraight(void *dst, const void *src, size_t pixelCount, con
 // (((r << 3) + g) << 2) + b の形式でESP32のシフト+加算命令を活用
 #define RGBA8_TO_RGB332(rgba) (((((rgba) >> 5) << 3) + (((rgba) >> 13) & 0x07)) << 2) + (((rgba) >> 22) & 0x03)
 
-static void rgb332_fromStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+static void rgb332_fromStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGB332, FromStraight, pixelCount);
     uint8_t *d        = static_cast<uint8_t *>(dst);
     const uint32_t *s = static_cast<const uint32_t *>(src);
 
@@ -79,6 +78,31 @@ static void rgb332_fromStraight(void *dst, const void *src, size_t pixelCount, c
 }
 #undef RGBA8_TO_RGB332
 
+// 変換関数（フォーマット記述子に登録する関数）
+// SIMD対応環境では起動後の初回呼び出し時にCPU機能を判定して実装を選択
+// （rgb332_simd.inl、結果はスカラー版と一致）
+static void rgb332_toStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGB332, ToStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGB332ToRGBA8();
+    convert(dst, src, pixelCount);
+#else
+    rgb332_toStraightScalar(dst, src, pixelCount);
+#endif
+}
+
+static void rgb332_fromStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGB332, FromStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGBA8ToRGB332();
+    convert(dst, src, pixelCount);
+#else
+    rgb332_fromStraightScalar(dst, src, pixelCount);
+#endif
+}
+
 // ------------------------------------------------------------------------
 // フォーマット定義
 // ------------------------------------------------------------------------
@@ -0,0 +1,163 @@
+/**
+ * @file rgb332_simd.inl
+ * @brief RGB332 toStraight/fromStraight の SIMD 実装（x86: SSE2 / AVX2）
+ * @see impl/fleximg/image/pixel_format/rgb332.inl
+ *
+ * 共通部（有効判定・CPU機能判定）は simd_x86.inl
+ */
+
+#include "simd_x86.inl"
+
+#ifdef FLEXIMG_SIMD_X86
+
+namespace FLEXIMG_NAMESPACE {
+
+// スカラー版（rgb332.inl）: 端数処理・SIMD非対応CPU用
+static void rgb332_toStraightScalar(void *dst, const void *src, size_t pixelCount);
+static void rgb332_fromStraightScalar(void *dst, const void *src, size_t pixelCount);
+
+namespace pixel_format {
+namespace detail {
+
+// ========================================================================
+// RGB332 -> RGBA8（16bitレーン、8ピクセル/128bit）
+//
+// ルックアップテーブル版と同じ式を乗算+シフトで計算:
+//   R8 = (R3 * 0x49) >> 1, G8 = (G3 * 0x49) >> 1, B8 = B2 * 0x55
+// [R8 | G8 << 8] と [B8 | 0xFF00] を16bit単位で交互に並べるとRGBA8になる
+// ========================================================================
+
+__attribute__((target("sse2"))) static inline void rgb332ToRGBA8_sse2_block(uint8_t *d, __m128i v)
+{
+    const __m128i mul3 = _mm_set1_epi16(0x49);
+    __m128i r8         = _mm_srli_epi16(_mm_mullo_epi16(_mm_srli_epi16(v, 5), mul3), 1);
+    __m128i g8         = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 2), _mm_set1_epi16(7)), mul3), 1);
+    __m128i b8         = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi16(3)), _mm_set1_epi16(0x55));
+    __m128i rg         = _mm_or_si128(r8, _mm_slli_epi16(g8, 8));
+    __m128i ba         = _mm_or_si128(b8, _mm_set1_epi16(static_cast<short>(0xFF00)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d), _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 16), _mm_unpackhi_epi16(rg, ba));
+}
+
+__attribute__((target("avx2"))) static inline void rgb332ToRGBA8_avx2_block(uint8_t *d, __m256i v)
+{
+    const __m256i mul3 = _mm256_set1_epi16(0x49);
+    __m256i r8         = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_srli_epi16(v, 5), mul3), 1);
+    __m256i g8 =
+        _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(v, 2), _mm256_set1_epi16(7)), mul3), 1);
+    __m256i b8 = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi16(3)), _mm256_set1_epi16(0x55));
+    __m256i rg = _mm256_or_si256(r8, _mm256_slli_epi16(g8, 8));
+    __m256i ba = _mm256_or_si256(b8, _mm256_set1_epi16(static_cast<short>(0xFF00)));
+    // unpackは128bitレーン単位のため、レーンを組み替えてピクセル順に戻す
+    __m256i lo = _mm256_unpacklo_epi16(rg, ba);  // 0-3, 8-11
+    __m256i hi = _mm256_unpackhi_epi16(rg, ba);  // 4-7, 12-15
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(d), _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+// ========================================================================
+// RGBA8 -> RGB332（32bitレーンで計算し、8bitにパック）
+//
+//   v = (R & 0xE0) | ((G >> 5) << 2) | (B >> 6)
+// ========================================================================
+
+__attribute__((target("sse2"))) static inline __m128i rgba8ToRGB332_sse2_4px(__m128i x)
+{
+    return _mm_or_si128(_mm_or_si128(_mm_and_si128(x, _mm_set1_epi32(0xE0)),
+                                     _mm_and_si128(_mm_srli_epi32(x, 11), _mm_set1_epi32(0x1C))),
+                        _mm_and_si128(_mm_srli_epi32(x, 22), _mm_set1_epi32(0x03)));
+}
+
+__attribute__((target("avx2"))) static inline __m256i rgba8ToRGB332_avx2_8px(__m256i x)
+{
+    return _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(x, _mm256_set1_epi32(0xE0)),
+                                           _mm256_and_si256(_mm256_srli_epi32(x, 11), _mm256_set1_epi32(0x1C))),
+                           _mm256_and_si256(_mm256_srli_epi32(x, 22), _mm256_set1_epi32(0x03)));
+}
+
+// ========================================================================
+// 行処理（16ピクセル単位: SSE2 / 32ピクセル単位: AVX2、端数はスカラー版）
+//
+// in-place変換に対応するため __restrict__ は付けない。各ブロックは全ロード後にストアするため、
+// 末尾詰め（src が dst の末尾）の展開、dst == src の縮小のいずれも安全
+// ========================================================================
+
+__attribute__((target("sse2"))) static void rgb332ToRGBA8_sse2(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d         = static_cast<uint8_t *>(dst);
+    const uint8_t *s   = static_cast<const uint8_t *>(src);
+    const __m128i zero = _mm_setzero_si128();
+    for (; pixelCount >= 16; pixelCount -= 16, s += 16, d += 64) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        rgb332ToRGBA8_sse2_block(d, _mm_unpacklo_epi8(v, zero));
+        rgb332ToRGBA8_sse2_block(d + 32, _mm_unpackhi_epi8(v, zero));
+    }
+    if (pixelCount) rgb332_toStraightScalar(d, s, pixelCount);
+}
+
+__attribute__((target("avx2"))) static void rgb332ToRGBA8_avx2(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    for (; pixelCount >= 32; pixelCount -= 32, s += 32, d += 128) {
+        __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16));
+        rgb332ToRGBA8_avx2_block(d, _mm256_cvtepu8_epi16(v0));
+        rgb332ToRGBA8_avx2_block(d + 64, _mm256_cvtepu8_epi16(v1));
+    }
+    if (pixelCount) rgb332ToRGBA8_sse2(d, s, pixelCount);
+}
+
+__attribute__((target("sse2"))) static void rgba8ToRGB332_sse2(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    for (; pixelCount >= 16; pixelCount -= 16, s += 64, d += 16) {
+        // 各値は0〜255のため、符号付きのpackでも値は変わらない
+        __m128i v0 = rgba8ToRGB332_sse2_4px(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s)));
+        __m128i v1 = rgba8ToRGB332_sse2_4px(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16)));
+        __m128i v2 = rgba8ToRGB332_sse2_4px(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 32)));
+        __m128i v3 = rgba8ToRGB332_sse2_4px(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 48)));
+        __m128i v  = _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d), v);
+    }
+    if (pixelCount) rgb332_fromStraightScalar(d, s, pixelCount);
+}
+
+__attribute__((target("avx2"))) static void rgba8ToRGB332_avx2(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    // packは128bitレーン単位のため、最後にピクセル順へ並べ替える
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (; pixelCount >= 32; pixelCount -= 32, s += 128, d += 32) {
+        __m256i v0 = rgba8ToRGB332_avx2_8px(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s)));
+        __m256i v1 = rgba8ToRGB332_avx2_8px(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + 32)));
+        __m256i v2 = rgba8ToRGB332_avx2_8px(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + 64)));
+        __m256i v3 = rgba8ToRGB332_avx2_8px(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + 96)));
+        __m256i v  = _mm256_packus_epi16(_mm256_packs_epi32(v0, v1), _mm256_packs_epi32(v2, v3));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d), _mm256_permutevar8x32_epi32(v, order));
+    }
+    if (pixelCount) rgba8ToRGB332_sse2(d, s, pixelCount);
+}
+
+// CPU機能に応じた実装を選択（AVX2 > SSE2 > スカラー）
+static RowFunc selectRGB332ToRGBA8()
+{
+    if (cpuFeatures().avx2) return rgb332ToRGBA8_avx2;
+    if (cpuFeatures().sse2) return rgb332ToRGBA8_sse2;
+    return rgb332_toStraightScalar;
+}
+
+static RowFunc selectRGBA8ToRGB332()
+{
+    if (cpuFeatures().avx2) return rgba8ToRGB332_avx2;
+    if (cpuFeatures().sse2) return rgba8ToRGB332_sse2;
+    return rgb332_fromStraightScalar;
+}
+
+}  // namespace detail
+}  // namespace pixel_format
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_SIMD_X86
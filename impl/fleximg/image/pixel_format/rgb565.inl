@@ -5,6 +5,7 @@
  */
 
 #include "../../../../src/fleximg/core/format_metrics.h"
+#include "rgb565_simd.inl"
 
 namespace FLEXIMG_NAMESPACE {
 
@@ -107,12 +108,10 @@ alignas(64) static const uint16_t rgb565LowTable[256] = {
         d[d_off + 7]                                 = 255;                                             \
     } while (0)
 
-static void rgb565le_toStraight(void *__restrict__ dst, const void *__restrict__ src, size_t pixelCount,
-                                const PixelAuxInfo *)
+static void rgb565le_toStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGB565_LE, ToStraight, pixelCount);
-    const uint8_t *__restrict__ s = static_cast<const uint8_t *>(src);
-    uint8_t *__restrict__ d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    uint8_t *d       = static_cast<uint8_t *>(dst);
 
     // 端数処理（1ピクセル）
     if (pixelCount & 1) {
@@ -135,12 +134,10 @@ static void rgb565le_toStraight(void *__restrict__ dst, const void *__restrict__
 // RGBA8 -> RGB565 変換マクロ（32bitロードした値から変換）
 #define RGBA8_TO_RGB565_LE(rgba) (((((rgba) >> 3) << 6) + (((rgba) >> 10) & 0x3F)) << 5) + (((rgba) >> 19) & 0x1F)
 
-static void rgb565le_fromStraight(void *__restrict__ dst, const void *__restrict__ src, size_t pixelCount,
-                                  const PixelAuxInfo *)
+static void rgb565le_fromStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGB565_LE, FromStraight, pixelCount);
-    uint16_t *__restrict__ d       = static_cast<uint16_t *>(dst);
-    const uint32_t *__restrict__ s = static_cast<const uint32_t *>(src);
+    uint16_t *d       = static_cast<uint16_t *>(dst);
+    const uint32_t *s = static_cast<const uint32_t *>(src);
 
     // 端数処理（1ピクセル）
     if (pixelCount & 1) {
@@ -196,12 +193,10 @@ static void rgb565le_fromStraight(void *__restrict__ dst, const void *__restrict
         d[d_off + 7]                                 = 255;                                             \
     } while (0)
 
-static void rgb565be_toStraight(void *__restrict__ dst, const void *__restrict__ src, size_t pixelCount,
-                                const PixelAuxInfo *)
+static void rgb565be_toStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGB565_BE, ToStraight, pixelCount);
-    const uint8_t *__restrict__ s = static_cast<const uint8_t *>(src);
-    uint8_t *__restrict__ d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    uint8_t *d       = static_cast<uint8_t *>(dst);
 
     // 端数処理（1ピクセル）
     if (pixelCount & 1) {
@@ -221,12 +216,10 @@ static void rgb565be_toStraight(void *__restrict__ dst, const void *__restrict__
 #undef RGB565BE_TO_STRAIGHT_PIXEL
 #undef RGB565BE_TO_STRAIGHT_PIXEL_x2
 
-static void rgb565be_fromStraight(void *__restrict__ dst, const void *__restrict__ src, size_t pixelCount,
-                                  const PixelAuxInfo *)
+static void rgb565be_fromStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGB565_BE, FromStraight, pixelCount);
-    uint8_t *__restrict__ d        = static_cast<uint8_t *>(dst);
-    const uint32_t *__restrict__ s = static_cast<const uint32_t *>(src);
+    uint8_t *d        = static_cast<uint8_t *>(dst);
+    const uint32_t *s = static_cast<const uint32_t *>(src);
 
     // 端数処理（1ピクセル）
     if (pixelCount & 1) {
@@ -252,6 +245,56 @@ static void rgb565be_fromStraight(void *__restrict__ dst, const void *__restrict
     }
 }
 
+// ========================================================================
+// 変換関数（フォーマット記述子に登録する関数）
+// SIMD対応環境では起動後の初回呼び出し時にCPU機能を判定して実装を選択
+// （rgb565_simd.inl、結果はスカラー版と一致）
+// ========================================================================
+
+static void rgb565le_toStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGB565_LE, ToStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGB565ToRGBA8<false>();
+    convert(dst, src, pixelCount);
+#else
+    rgb565le_toStraightScalar(dst, src, pixelCount);
+#endif
+}
+
+static void rgb565le_fromStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGB565_LE, FromStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGBA8ToRGB565<false>();
+    convert(dst, src, pixelCount);
+#else
+    rgb565le_fromStraightScalar(dst, src, pixelCount);
+#endif
+}
+
+static void rgb565be_toStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGB565_BE, ToStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGB565ToRGBA8<true>();
+    convert(dst, src, pixelCount);
+#else
+    rgb565be_toStraightScalar(dst, src, pixelCount);
+#endif
+}
+
+static void rgb565be_fromStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGB565_BE, FromStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGBA8ToRGB565<true>();
+    convert(dst, src, pixelCount);
+#else
+    rgb565be_fromStraightScalar(dst, src, pixelCount);
+#endif
+}
+
 // ========================================================================
 // 16bit用バイトスワップ（RGB565_LE <-> RGB565_BE）
 // ========================================================================
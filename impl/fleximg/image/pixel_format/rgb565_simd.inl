@@ -0,0 +1,205 @@
+/**
+ * @file rgb565_simd.inl
+ * @brief RGB565_LE/BE toStraight/fromStraight の SIMD 実装（x86: SSE2 / AVX2）
+ * @see impl/fleximg/image/pixel_format/rgb565.inl
+ *
+ * 共通部（有効判定・CPU機能判定）は simd_x86.inl
+ */
+
+#include "simd_x86.inl"
+
+#ifdef FLEXIMG_SIMD_X86
+
+namespace FLEXIMG_NAMESPACE {
+
+// スカラー版（rgb565.inl）: 端数処理・SIMD非対応CPU用
+static void rgb565le_toStraightScalar(void *dst, const void *src, size_t pixelCount);
+static void rgb565le_fromStraightScalar(void *dst, const void *src, size_t pixelCount);
+static void rgb565be_toStraightScalar(void *dst, const void *src, size_t pixelCount);
+static void rgb565be_fromStraightScalar(void *dst, const void *src, size_t pixelCount);
+
+namespace pixel_format {
+namespace detail {
+
+// ========================================================================
+// RGB565 -> RGBA8（16bitレーン、8ピクセル/128bit）
+//
+// ビット複製を乗算+シフトで計算（ルックアップテーブル版と同じ結果）:
+//   R8 = (R5 << 3) | (R5 >> 2) = (R5 * 33) >> 2
+//   G8 = (G6 << 2) | (G6 >> 4) = (G6 * 65) >> 4
+//   B8 = (B5 << 3) | (B5 >> 2) = (B5 * 33) >> 2
+// [R8 | G8 << 8] と [B8 | 0xFF00] を16bit単位で交互に並べるとRGBA8になる
+// ========================================================================
+
+__attribute__((target("sse2"))) static inline void rgb565ToRGBA8_sse2_block(uint8_t *d, __m128i v)
+{
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+    __m128i r8 = _mm_srli_epi16(_mm_mullo_epi16(_mm_srli_epi16(v, 11), _mm_set1_epi16(33)), 2);
+    __m128i g8 = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 5), mask6), _mm_set1_epi16(65)), 4);
+    __m128i b8 = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(v, mask5), _mm_set1_epi16(33)), 2);
+    __m128i rg = _mm_or_si128(r8, _mm_slli_epi16(g8, 8));
+    __m128i ba = _mm_or_si128(b8, _mm_set1_epi16(static_cast<short>(0xFF00)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d), _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 16), _mm_unpackhi_epi16(rg, ba));
+}
+
+__attribute__((target("avx2"))) static inline void rgb565ToRGBA8_avx2_block(uint8_t *d, __m256i v)
+{
+    const __m256i mask5 = _mm256_set1_epi16(0x1F);
+    const __m256i mask6 = _mm256_set1_epi16(0x3F);
+    __m256i r8          = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_srli_epi16(v, 11), _mm256_set1_epi16(33)), 2);
+    __m256i g8          = _mm256_srli_epi16(
+        _mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(v, 5), mask6), _mm256_set1_epi16(65)), 4);
+    __m256i b8 = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_and_si256(v, mask5), _mm256_set1_epi16(33)), 2);
+    __m256i rg = _mm256_or_si256(r8, _mm256_slli_epi16(g8, 8));
+    __m256i ba = _mm256_or_si256(b8, _mm256_set1_epi16(static_cast<short>(0xFF00)));
+    // unpackは128bitレーン単位のため、レーンを組み替えてピクセル順に戻す
+    __m256i lo = _mm256_unpacklo_epi16(rg, ba);  // 0-3, 8-11
+    __m256i hi = _mm256_unpackhi_epi16(rg, ba);  // 4-7, 12-15
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(d), _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+// ========================================================================
+// RGBA8 -> RGB565（32bitレーンで計算し、16bitにパック）
+//
+//   v = ((R & 0xF8) << 8) | ((G & 0xFC) << 3) | (B >> 3)
+// SSE2にはunsignedのpack（packus_epi32）がないため、符号拡張してからpacks_epi32を使用
+// ========================================================================
+
+__attribute__((target("sse2"))) static inline __m128i rgba8ToRGB565_sse2_block(const uint8_t *s)
+{
+    const __m128i maskR = _mm_set1_epi32(0xF8);
+    const __m128i maskG = _mm_set1_epi32(0x07E0);
+    const __m128i maskB = _mm_set1_epi32(0x1F);
+    __m128i x0          = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+    __m128i x1          = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16));
+    __m128i v0          = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(x0, maskR), 8),
+                                                    _mm_and_si128(_mm_srli_epi32(x0, 5), maskG)),
+                                       _mm_and_si128(_mm_srli_epi32(x0, 19), maskB));
+    __m128i v1          = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(x1, maskR), 8),
+                                                    _mm_and_si128(_mm_srli_epi32(x1, 5), maskG)),
+                                       _mm_and_si128(_mm_srli_epi32(x1, 19), maskB));
+    v0                  = _mm_srai_epi32(_mm_slli_epi32(v0, 16), 16);
+    v1                  = _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16);
+    return _mm_packs_epi32(v0, v1);
+}
+
+__attribute__((target("avx2"))) static inline __m256i rgba8ToRGB565_avx2_block(const uint8_t *s)
+{
+    const __m256i maskR = _mm256_set1_epi32(0xF8);
+    const __m256i maskG = _mm256_set1_epi32(0x07E0);
+    const __m256i maskB = _mm256_set1_epi32(0x1F);
+    __m256i x0          = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s));
+    __m256i x1          = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + 32));
+    __m256i v0          = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(x0, maskR), 8),
+                                                          _mm256_and_si256(_mm256_srli_epi32(x0, 5), maskG)),
+                                          _mm256_and_si256(_mm256_srli_epi32(x0, 19), maskB));
+    __m256i v1          = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(x1, maskR), 8),
+                                                          _mm256_and_si256(_mm256_srli_epi32(x1, 5), maskG)),
+                                          _mm256_and_si256(_mm256_srli_epi32(x1, 19), maskB));
+    // packus_epi32は128bitレーン単位のため、64bit単位で並べ替えてピクセル順に戻す
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(v0, v1), 0xD8);
+}
+
+// 16bit単位のバイトスワップ（RGB565_BE <-> RGB565_LE）
+__attribute__((target("sse2"))) static inline __m128i swapBytes16_sse2(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+__attribute__((target("avx2"))) static inline __m256i swapBytes16_avx2(__m256i v)
+{
+    return _mm256_or_si256(_mm256_slli_epi16(v, 8), _mm256_srli_epi16(v, 8));
+}
+
+// ========================================================================
+// 行処理（8ピクセル単位: SSE2 / 16ピクセル単位: AVX2、端数はスカラー版）
+//
+// in-place変換に対応するため __restrict__ は付けない。各ブロックは全ロード後にストアするため、
+// 末尾詰め（src が dst の末尾）の展開、dst == src の縮小のいずれも安全
+// ========================================================================
+
+template <bool BigEndian>
+__attribute__((target("sse2"))) static void rgb565ToRGBA8_sse2(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    for (; pixelCount >= 8; pixelCount -= 8, s += 16, d += 32) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        rgb565ToRGBA8_sse2_block(d, BigEndian ? swapBytes16_sse2(v) : v);
+    }
+    if (pixelCount) {
+        if (BigEndian) {
+            rgb565be_toStraightScalar(d, s, pixelCount);
+        } else {
+            rgb565le_toStraightScalar(d, s, pixelCount);
+        }
+    }
+}
+
+template <bool BigEndian>
+__attribute__((target("avx2"))) static void rgb565ToRGBA8_avx2(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    for (; pixelCount >= 16; pixelCount -= 16, s += 32, d += 64) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s));
+        rgb565ToRGBA8_avx2_block(d, BigEndian ? swapBytes16_avx2(v) : v);
+    }
+    if (pixelCount) rgb565ToRGBA8_sse2<BigEndian>(d, s, pixelCount);
+}
+
+template <bool BigEndian>
+__attribute__((target("sse2"))) static void rgba8ToRGB565_sse2(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    for (; pixelCount >= 8; pixelCount -= 8, s += 32, d += 16) {
+        __m128i v = rgba8ToRGB565_sse2_block(s);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d), BigEndian ? swapBytes16_sse2(v) : v);
+    }
+    if (pixelCount) {
+        if (BigEndian) {
+            rgb565be_fromStraightScalar(d, s, pixelCount);
+        } else {
+            rgb565le_fromStraightScalar(d, s, pixelCount);
+        }
+    }
+}
+
+template <bool BigEndian>
+__attribute__((target("avx2"))) static void rgba8ToRGB565_avx2(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d       = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    for (; pixelCount >= 16; pixelCount -= 16, s += 64, d += 32) {
+        __m256i v = rgba8ToRGB565_avx2_block(s);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d), BigEndian ? swapBytes16_avx2(v) : v);
+    }
+    if (pixelCount) rgba8ToRGB565_sse2<BigEndian>(d, s, pixelCount);
+}
+
+// CPU機能に応じた実装を選択（AVX2 > SSE2 > スカラー）
+template <bool BigEndian>
+static RowFunc selectRGB565ToRGBA8()
+{
+    if (cpuFeatures().avx2) return rgb565ToRGBA8_avx2<BigEndian>;
+    if (cpuFeatures().sse2) return rgb565ToRGBA8_sse2<BigEndian>;
+    return BigEndian ? rgb565be_toStraightScalar : rgb565le_toStraightScalar;
+}
+
+template <bool BigEndian>
+static RowFunc selectRGBA8ToRGB565()
+{
+    if (cpuFeatures().avx2) return rgba8ToRGB565_avx2<BigEndian>;
+    if (cpuFeatures().sse2) return rgba8ToRGB565_sse2<BigEndian>;
+    return BigEndian ? rgb565be_fromStraightScalar : rgb565le_fromStraightScalar;
+}
+
+}  // namespace detail
+}  // namespace pixel_format
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_SIMD_X86
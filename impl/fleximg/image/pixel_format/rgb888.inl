@@ -5,6 +5,7 @@
  */
 
 #include "../../../../src/fleximg/core/format_metrics.h"
+#include "rgb888_simd.inl"
 
 namespace FLEXIMG_NAMESPACE {
 
@@ -12,9 +13,8 @@ namespace FLEXIMG_NAMESPACE {
 // RGB888: 24bit RGB (mem[0]=R, mem[1]=G, mem[2]=B)
 // ========================================================================
 
-static void rgb888_toStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+static void rgb888_toStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGB888, ToStraight, pixelCount);
     const uint8_t *s = static_cast<const uint8_t *>(src);
     uint8_t *d       = static_cast<uint8_t *>(dst);
 
@@ -53,9 +53,8 @@ static void rgb888_toStraight(void *dst, const void *src, size_t pixelCount, con
     }
 }
 
-static void rgb888_fromStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+static void rgb888_fromStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGB888, FromStraight, pixelCount);
     uint8_t *d       = static_cast<uint8_t *>(dst);
     const uint8_t *s = static_cast<const uint8_t *>(src);
 
@@ -93,19 +92,24 @@ static void rgb888_fromStraight(void *dst, const void *src, size_t pixelCount, c
 // BGR888: 24bit BGR (mem[0]=B, mem[1]=G, mem[2]=R)
 // ========================================================================
 
-static void bgr888_toStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+// R,Bの入れ替えがあるため、各ピクセルは読み出してから書き込む
+// （in-place変換で書き込みが未読のソースを上書きしないように）
+
+static void bgr888_toStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(BGR888, ToStraight, pixelCount);
     const uint8_t *s = static_cast<const uint8_t *>(src);
     uint8_t *d       = static_cast<uint8_t *>(dst);
 
     // 端数処理（1〜3ピクセル）
     size_t remainder = pixelCount & 3;
     while (remainder--) {
-        d[0] = s[2];  // R (src の B 位置)
-        d[1] = s[1];  // G
-        d[2] = s[0];  // B (src の R 位置)
-        d[3] = 255;
+        uint8_t b = s[0];
+        uint8_t g = s[1];
+        uint8_t r = s[2];
+        d[0]      = r;  // R (src の B 位置)
+        d[1]      = g;  // G
+        d[2]      = b;  // B (src の R 位置)
+        d[3]      = 255;
         s += 3;
         d += 4;
     }
@@ -113,39 +117,34 @@ static void bgr888_toStraight(void *dst, const void *src, size_t pixelCount, con
     // 4ピクセル単位でループ
     pixelCount >>= 2;
     while (pixelCount--) {
-        d[0]  = s[2];
-        d[1]  = s[1];
-        d[2]  = s[0];
-        d[3]  = 255;
-        d[4]  = s[5];
-        d[5]  = s[4];
-        d[6]  = s[3];
-        d[7]  = 255;
-        d[8]  = s[8];
-        d[9]  = s[7];
-        d[10] = s[6];
-        d[11] = 255;
-        d[12] = s[11];
-        d[13] = s[10];
-        d[14] = s[9];
-        d[15] = 255;
+        for (int i = 0; i < 4; ++i) {
+            uint8_t b    = s[i * 3 + 0];
+            uint8_t g    = s[i * 3 + 1];
+            uint8_t r    = s[i * 3 + 2];
+            d[i * 4 + 0] = r;
+            d[i * 4 + 1] = g;
+            d[i * 4 + 2] = b;
+            d[i * 4 + 3] = 255;
+        }
         s += 12;
         d += 16;
     }
 }
 
-static void bgr888_fromStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+static void bgr888_fromStraightScalar(void *dst, const void *src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(BGR888, FromStraight, pixelCount);
     uint8_t *d       = static_cast<uint8_t *>(dst);
     const uint8_t *s = static_cast<const uint8_t *>(src);
 
     // 端数処理（1〜3ピクセル）
     size_t remainder = pixelCount & 3;
     while (remainder--) {
-        d[0] = s[2];  // B
-        d[1] = s[1];  // G
-        d[2] = s[0];  // R
+        uint8_t r = s[0];
+        uint8_t g = s[1];
+        uint8_t b = s[2];
+        d[0]      = b;  // B
+        d[1]      = g;  // G
+        d[2]      = r;  // R
         s += 4;
         d += 3;
     }
@@ -153,23 +152,69 @@ static void bgr888_fromStraight(void *dst, const void *src, size_t pixelCount, c
     // 4ピクセル単位でループ
     pixelCount >>= 2;
     while (pixelCount--) {
-        d[0]  = s[2];
-        d[1]  = s[1];
-        d[2]  = s[0];
-        d[3]  = s[6];
-        d[4]  = s[5];
-        d[5]  = s[4];
-        d[6]  = s[10];
-        d[7]  = s[9];
-        d[8]  = s[8];
-        d[9]  = s[14];
-        d[10] = s[13];
-        d[11] = s[12];
+        for (int i = 0; i < 4; ++i) {
+            uint8_t r    = s[i * 4 + 0];
+            uint8_t g    = s[i * 4 + 1];
+            uint8_t b    = s[i * 4 + 2];
+            d[i * 3 + 0] = b;
+            d[i * 3 + 1] = g;
+            d[i * 3 + 2] = r;
+        }
         s += 16;
         d += 12;
     }
 }
 
+// ========================================================================
+// 変換関数（フォーマット記述子に登録する関数）
+// SIMD対応環境では起動後の初回呼び出し時にCPU機能を判定して実装を選択
+// （rgb888_simd.inl、in-place変換を含めて結果はスカラー版と一致）
+// ========================================================================
+
+static void rgb888_toStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGB888, ToStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGB888ToRGBA8<false>();
+    convert(dst, src, pixelCount);
+#else
+    rgb888_toStraightScalar(dst, src, pixelCount);
+#endif
+}
+
+static void rgb888_fromStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGB888, FromStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGBA8ToRGB888<false>();
+    convert(dst, src, pixelCount);
+#else
+    rgb888_fromStraightScalar(dst, src, pixelCount);
+#endif
+}
+
+static void bgr888_toStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(BGR888, ToStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGB888ToRGBA8<true>();
+    convert(dst, src, pixelCount);
+#else
+    bgr888_toStraightScalar(dst, src, pixelCount);
+#endif
+}
+
+static void bgr888_fromStraight(void *dst, const void *src, size_t pixelCount, const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(BGR888, FromStraight, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto convert = pixel_format::detail::selectRGBA8ToRGB888<true>();
+    convert(dst, src, pixelCount);
+#else
+    bgr888_fromStraightScalar(dst, src, pixelCount);
+#endif
+}
+
 // ========================================================================
 // エンディアン・バイトスワップ関数
 // ========================================================================
@@ -0,0 +1,117 @@
+/**
+ * @file rgb888_simd.inl
+ * @brief RGB888/BGR888 toStraight/fromStraight の SIMD 実装（x86: SSSE3）
+ * @see impl/fleximg/image/pixel_format/rgb888.inl
+ *
+ * 共通部（有効判定・CPU機能判定）は simd_x86.inl
+ * 3バイト⇔4バイトの並べ替えはバイトシャッフル（pshufb）で行う。
+ * AVX2のシャッフルは128bitレーンを跨げず、24bitの並べ替えでは利点が小さいためSSSE3版のみ。
+ */
+
+#include "simd_x86.inl"
+
+#ifdef FLEXIMG_SIMD_X86
+
+namespace FLEXIMG_NAMESPACE {
+
+// スカラー版（rgb888.inl）: 端数処理・SIMD非対応CPU用
+static void rgb888_toStraightScalar(void *dst, const void *src, size_t pixelCount);
+static void rgb888_fromStraightScalar(void *dst, const void *src, size_t pixelCount);
+static void bgr888_toStraightScalar(void *dst, const void *src, size_t pixelCount);
+static void bgr888_fromStraightScalar(void *dst, const void *src, size_t pixelCount);
+
+namespace pixel_format {
+namespace detail {
+
+// ========================================================================
+// 行処理（16ピクセル単位、端数はスカラー版）
+//
+// toStraight:   48バイトを3回ロードし、alignrで4ピクセル（12バイト）ずつ取り出して
+//               [c0 c1 c2 A] に並べ替え（A = 255）
+// fromStraight: 4ピクセルずつ12バイトに詰め、3回の16バイトストアにまとめる
+// Swap = true でR,Bを入れ替える（BGR888）
+//
+// in-place変換に対応するため __restrict__ は付けない。各ブロックは全ロード後にストアするため、
+// 末尾詰め（src が dst の末尾）の展開、dst == src の縮小のいずれも安全
+// ========================================================================
+
+template <bool Swap>
+__attribute__((target("ssse3"))) static void rgb888ToRGBA8_ssse3(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d            = static_cast<uint8_t *>(dst);
+    const uint8_t *s      = static_cast<const uint8_t *>(src);
+    const __m128i shuffle = Swap ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+                                 : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha   = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+    for (; pixelCount >= 16; pixelCount -= 16, s += 48, d += 64) {
+        __m128i a  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        __m128i b  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16));
+        __m128i c  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 32));
+        __m128i p0 = a;                         // バイト 0〜11
+        __m128i p1 = _mm_alignr_epi8(b, a, 12);  // バイト 12〜23
+        __m128i p2 = _mm_alignr_epi8(c, b, 8);   // バイト 24〜35
+        __m128i p3 = _mm_srli_si128(c, 4);       // バイト 36〜47
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d), _mm_or_si128(_mm_shuffle_epi8(p0, shuffle), alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 16), _mm_or_si128(_mm_shuffle_epi8(p1, shuffle), alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 32), _mm_or_si128(_mm_shuffle_epi8(p2, shuffle), alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 48), _mm_or_si128(_mm_shuffle_epi8(p3, shuffle), alpha));
+    }
+    if (pixelCount) {
+        if (Swap) {
+            bgr888_toStraightScalar(d, s, pixelCount);
+        } else {
+            rgb888_toStraightScalar(d, s, pixelCount);
+        }
+    }
+}
+
+template <bool Swap>
+__attribute__((target("ssse3"))) static void rgba8ToRGB888_ssse3(void *dst, const void *src, size_t pixelCount)
+{
+    uint8_t *d            = static_cast<uint8_t *>(dst);
+    const uint8_t *s      = static_cast<const uint8_t *>(src);
+    const __m128i shuffle = Swap ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+                                 : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+    for (; pixelCount >= 16; pixelCount -= 16, s += 64, d += 48) {
+        // 各ベクタの下位12バイトに4ピクセル分を詰める
+        __m128i p0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s)), shuffle);
+        __m128i p1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16)), shuffle);
+        __m128i p2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 32)), shuffle);
+        __m128i p3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 48)), shuffle);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d), _mm_or_si128(p0, _mm_slli_si128(p1, 12)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 16),
+                         _mm_or_si128(_mm_srli_si128(p1, 4), _mm_slli_si128(p2, 8)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 32),
+                         _mm_or_si128(_mm_srli_si128(p2, 8), _mm_slli_si128(p3, 4)));
+    }
+    if (pixelCount) {
+        if (Swap) {
+            bgr888_fromStraightScalar(d, s, pixelCount);
+        } else {
+            rgb888_fromStraightScalar(d, s, pixelCount);
+        }
+    }
+}
+
+// CPU機能に応じた実装を選択（SSSE3 > スカラー）
+template <bool Swap>
+static RowFunc selectRGB888ToRGBA8()
+{
+    if (cpuFeatures().ssse3) return rgb888ToRGBA8_ssse3<Swap>;
+    return Swap ? bgr888_toStraightScalar : rgb888_toStraightScalar;
+}
+
+template <bool Swap>
+static RowFunc selectRGBA8ToRGB888()
+{
+    if (cpuFeatures().ssse3) return rgba8ToRGB888_ssse3<Swap>;
+    return Swap ? bgr888_fromStraightScalar : rgb888_fromStraightScalar;
+}
+
+}  // namespace detail
+}  // namespace pixel_format
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_SIMD_X86
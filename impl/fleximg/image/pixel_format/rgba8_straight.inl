@@ -5,6 +5,7 @@
  */
 
 #include "../../../../src/fleximg/core/format_metrics.h"
+#include "rgba8_straight_simd.inl"
 
 namespace FLEXIMG_NAMESPACE {
 
@@ -47,10 +48,12 @@ static void rgba8Straight_fromStraight(void *dst, const void *src, size_t pixelC
 //    - dstW = (dstA * 255 * 256) / total, srcW = 256 - dstW
 //    - 色計算: (d * dstW + s * srcW) >> 8
 //    - R,Bチャンネルを32ビット演算でまとめて処理
-static void rgba8Straight_blendUnderStraight(void *__restrict__ dst, const void *__restrict__ src, size_t pixelCount,
-                                             const PixelAuxInfo *)
+//
+// x86（GCC/Clang）ではAVX2/SSE4.1版を実行時に選択する（rgba8_straight_simd.inl）
+// dst・srcともに透明(0)のピクセルは、経路によりスキップ/コピーのどちらにもなる（結果は透明）
+// （SIMD版は常にスキップ）
+static void rgba8Straight_blendUnderScalar(void *__restrict__ dst, const void *__restrict__ src, size_t pixelCount)
 {
-    FLEXIMG_FMT_METRICS(RGBA8_Straight, BlendUnder, pixelCount);
     if (pixelCount <= 0) return;
 
     const uint8_t *__restrict__ s = static_cast<const uint8_t *>(src);
@@ -129,22 +132,24 @@ handle_dstA_255: {
     s += 4;
 
     // 4ピクセル単位でスキップ
+    // （範囲末尾の次のピクセルを読まないよう、アルファはブロック先頭で読む）
     auto plimit = pixelCount >> 2;
     if (plimit && dstA == 255) {
         auto d_start = d;
         do {
+            uint_fast8_t a0 = d[3];
             uint_fast8_t a1 = d[7];
             uint_fast8_t a2 = d[11];
             uint_fast8_t a3 = d[15];
-            if ((dstA & a1 & a2 & a3) != 255) break;
+            if ((a0 & a1 & a2 & a3) != 255) break;
             d += 16;
-            dstA = d[3];
         } while (--plimit);
         auto pindex = static_cast<size_t>(d - d_start);
         if (d != d_start) {
             pixelCount -= pindex >> 2;
             if (pixelCount <= 0) return;
             s += pindex;
+            dstA = d[3];
         }
     }
     srcA = s[3];
@@ -170,22 +175,23 @@ handle_dstA_0: {
     if (plimit && dstA == 0) {
         auto s_start = s;
         do {
+            uint_fast8_t a0 = d[3];
             uint_fast8_t a1 = d[7];
             uint_fast8_t a2 = d[11];
             uint_fast8_t a3 = d[15];
-            if ((dstA | a1 | a2 | a3) != 0) break;
+            if ((a0 | a1 | a2 | a3) != 0) break;
             reinterpret_cast<uint32_t *>(d)[0] = reinterpret_cast<const uint32_t *>(s)[0];
             reinterpret_cast<uint32_t *>(d)[1] = reinterpret_cast<const uint32_t *>(s)[1];
             reinterpret_cast<uint32_t *>(d)[2] = reinterpret_cast<const uint32_t *>(s)[2];
             reinterpret_cast<uint32_t *>(d)[3] = reinterpret_cast<const uint32_t *>(s)[3];
             d += 16;
-            dstA = d[3];
             s += 16;
         } while (--plimit);
         auto pindex = static_cast<size_t>(s - s_start);
         if (pindex) {
             pixelCount -= pindex >> 2;
             if (pixelCount <= 0) return;
+            dstA = d[3];
         }
     }
 
@@ -211,18 +217,19 @@ handle_srcA_0: {
     if (plimit && srcA == 0) {
         auto s_start = s;
         do {
+            uint_fast8_t a0 = s[3];
             uint_fast8_t a1 = s[7];
             uint_fast8_t a2 = s[11];
             uint_fast8_t a3 = s[15];
-            if ((srcA | a1 | a2 | a3) != 0) break;
+            if ((a0 | a1 | a2 | a3) != 0) break;
             s += 16;
-            srcA = s[3];
         } while (--plimit);
         auto pindex = static_cast<size_t>(s - s_start);
         if (pindex) {
             pixelCount -= pindex >> 2;
             if (pixelCount <= 0) return;
             d += pindex;
+            srcA = s[3];
         }
     }
     dstA = d[3];
@@ -233,6 +240,20 @@ handle_srcA_0: {
 }
 }
 
+// blendUnderStraight（フォーマット記述子に登録する関数）
+// SIMD対応環境では起動後の初回呼び出し時にCPU機能を判定して実装を選択
+static void rgba8Straight_blendUnderStraight(void *__restrict__ dst, const void *__restrict__ src, size_t pixelCount,
+                                             const PixelAuxInfo *)
+{
+    FLEXIMG_FMT_METRICS(RGBA8_Straight, BlendUnder, pixelCount);
+#ifdef FLEXIMG_SIMD_X86
+    static const auto blendUnder = pixel_format::detail::selectBlendUnderRGBA8();
+    blendUnder(dst, src, pixelCount);
+#else
+    rgba8Straight_blendUnderScalar(dst, src, pixelCount);
+#endif
+}
+
 // ------------------------------------------------------------------------
 // フォーマット定義
 // ------------------------------------------------------------------------
@@ -0,0 +1,201 @@
+/**
+ * @file rgba8_straight_simd.inl
+ * @brief RGBA8_Straight blendUnderStraight の SIMD 実装（x86: SSE4.1 / AVX2）
+ * @see impl/fleximg/image/pixel_format/rgba8_straight.inl
+ *
+ * 共通部（有効判定・CPU機能判定）は simd_x86.inl
+ */
+
+#include "simd_x86.inl"
+
+#ifdef FLEXIMG_SIMD_X86
+
+namespace FLEXIMG_NAMESPACE {
+
+// スカラー版（rgba8_straight.inl）: SSE4.1非対応CPU用
+static void rgba8Straight_blendUnderScalar(void *__restrict__ dst, const void *__restrict__ src, size_t pixelCount);
+
+namespace pixel_format {
+namespace detail {
+
+// ========================================================================
+// ブレンド計算（スカラー版の正規化重み方式と同じ式、結果はビット単位で一致）
+//
+//   total = dstA * 255 + srcA * (255 - dstA)            // 0〜65025（16bitに収まる）
+//   dstW  = (dstA * 65280 + (total >> 1)) / total       // floatの除算で代替
+//   srcW  = 256 - dstW
+//   color = (d * dstW + s * srcW) >> 8                  // 16bitレーンで計算（最大65280）
+//   A     = (total + 127) / 255 = ((total + 127) * 0x8081) >> 23
+//
+// - 被除数は2^24未満、商は256.5未満のため、floatの除算結果を切り捨てると整数除算と一致する
+// - dstA == 255 / srcA == 0 のピクセルは dst、dstA == 0 のピクセルは src がそのまま得られる
+//   （スカラー版のスキップ・コピーと同じ結果になるため、ピクセル単位の分岐は不要）
+// - dst・srcともに透明（total == 0）のピクセルは dst のまま（スカラー版の srcA == 0 のスキップと同じ）
+// ========================================================================
+
+__attribute__((target("sse4.1"))) static inline __m128i blendUnderRGBA8_sse41_block(__m128i d, __m128i s)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c255 = _mm_set1_epi32(255);
+    __m128i dA         = _mm_srli_epi32(d, 24);
+    __m128i sA         = _mm_srli_epi32(s, 24);
+
+    // 各32bitレーンの上位16bitは0のため、16bit乗算で32bitの積が得られる
+    __m128i total = _mm_add_epi32(_mm_mullo_epi16(dA, c255), _mm_mullo_epi16(sA, _mm_sub_epi32(c255, dA)));
+    __m128 num    = _mm_cvtepi32_ps(_mm_add_epi32(_mm_mullo_epi32(dA, _mm_set1_epi32(65280)), _mm_srli_epi32(total, 1)));
+    __m128i dstW  = _mm_cvttps_epi32(_mm_div_ps(num, _mm_cvtepi32_ps(total)));
+    __m128i srcW  = _mm_sub_epi32(_mm_set1_epi32(256), dstW);
+
+    // 重みを4チャンネル分の16bitレーンに展開
+    __m128i dW2 = _mm_or_si128(dstW, _mm_slli_epi32(dstW, 16));
+    __m128i sW2 = _mm_or_si128(srcW, _mm_slli_epi32(srcW, 16));
+
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi32(dW2, dW2)),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi32(sW2, sW2)));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi32(dW2, dW2)),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi32(sW2, sW2)));
+    __m128i color = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+
+    __m128i alpha =
+        _mm_srli_epi32(_mm_mulhi_epu16(_mm_add_epi32(total, _mm_set1_epi32(127)), _mm_set1_epi32(0x8081)), 7);
+    __m128i result = _mm_or_si128(_mm_and_si128(color, _mm_set1_epi32(0x00FFFFFF)), _mm_slli_epi32(alpha, 24));
+    return _mm_blendv_epi8(result, d, _mm_cmpeq_epi32(total, zero));
+}
+
+__attribute__((target("avx2"))) static inline __m256i blendUnderRGBA8_avx2_block(__m256i d, __m256i s)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i c255 = _mm256_set1_epi32(255);
+    __m256i dA         = _mm256_srli_epi32(d, 24);
+    __m256i sA         = _mm256_srli_epi32(s, 24);
+
+    __m256i total = _mm256_add_epi32(_mm256_mullo_epi16(dA, c255), _mm256_mullo_epi16(sA, _mm256_sub_epi32(c255, dA)));
+    __m256 num    = _mm256_cvtepi32_ps(
+        _mm256_add_epi32(_mm256_mullo_epi32(dA, _mm256_set1_epi32(65280)), _mm256_srli_epi32(total, 1)));
+    __m256i dstW = _mm256_cvttps_epi32(_mm256_div_ps(num, _mm256_cvtepi32_ps(total)));
+    __m256i srcW = _mm256_sub_epi32(_mm256_set1_epi32(256), dstW);
+
+    // unpack/packは128bitレーン単位で対になるため、ピクセル順は保たれる
+    __m256i dW2 = _mm256_or_si256(dstW, _mm256_slli_epi32(dstW, 16));
+    __m256i sW2 = _mm256_or_si256(srcW, _mm256_slli_epi32(srcW, 16));
+
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi32(dW2, dW2)),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi32(sW2, sW2)));
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi32(dW2, dW2)),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi32(sW2, sW2)));
+    __m256i color = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+
+    __m256i alpha = _mm256_srli_epi32(
+        _mm256_mulhi_epu16(_mm256_add_epi32(total, _mm256_set1_epi32(127)), _mm256_set1_epi32(0x8081)), 7);
+    __m256i result =
+        _mm256_or_si256(_mm256_and_si256(color, _mm256_set1_epi32(0x00FFFFFF)), _mm256_slli_epi32(alpha, 24));
+    return _mm256_blendv_epi8(result, d, _mm256_cmpeq_epi32(total, zero));
+}
+
+// ========================================================================
+// 行処理
+// 8ピクセル（SSE4.1）/ 16ピクセル（AVX2）単位で連続区間を判定:
+// - dst全て不透明 / src全て透明: スキップ
+// - dst全て透明: srcをコピー
+// - それ以外: ブレンド計算
+// ========================================================================
+
+__attribute__((target("sse4.1"))) static void blendUnderRGBA8_sse41(void *__restrict__ dst,
+                                                                    const void *__restrict__ src, size_t pixelCount)
+{
+    uint8_t *__restrict__ d       = static_cast<uint8_t *>(dst);
+    const uint8_t *__restrict__ s = static_cast<const uint8_t *>(src);
+    const __m128i alphaMask       = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+    for (; pixelCount >= 8; pixelCount -= 8, d += 32, s += 32) {
+        __m128i d0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(d));
+        __m128i d1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(d + 16));
+        __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16));
+
+        __m128i dAnd = _mm_and_si128(_mm_and_si128(d0, d1), alphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(dAnd, alphaMask)) == 0xFFFF) continue;
+        if (_mm_testz_si128(_mm_or_si128(s0, s1), alphaMask)) continue;
+        if (_mm_testz_si128(_mm_or_si128(d0, d1), alphaMask)) {
+            const __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(d),
+                             _mm_blendv_epi8(s0, d0, _mm_cmpeq_epi32(_mm_and_si128(s0, alphaMask), zero)));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 16),
+                             _mm_blendv_epi8(s1, d1, _mm_cmpeq_epi32(_mm_and_si128(s1, alphaMask), zero)));
+            continue;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d), blendUnderRGBA8_sse41_block(d0, s0));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 16), blendUnderRGBA8_sse41_block(d1, s1));
+    }
+    if (pixelCount >= 4) {
+        __m128i d0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(d));
+        __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d), blendUnderRGBA8_sse41_block(d0, s0));
+        pixelCount -= 4;
+        d += 16;
+        s += 16;
+    }
+    if (pixelCount) {
+        // 端数（1〜3ピクセル）: 一時領域経由で4ピクセル分を処理
+        uint8_t dTmp[16] = {};
+        uint8_t sTmp[16] = {};
+        std::memcpy(dTmp, d, pixelCount * 4);
+        std::memcpy(sTmp, s, pixelCount * 4);
+        __m128i d0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dTmp));
+        __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(sTmp));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dTmp), blendUnderRGBA8_sse41_block(d0, s0));
+        std::memcpy(d, dTmp, pixelCount * 4);
+    }
+}
+
+__attribute__((target("avx2"))) static void blendUnderRGBA8_avx2(void *__restrict__ dst, const void *__restrict__ src,
+                                                                 size_t pixelCount)
+{
+    uint8_t *__restrict__ d       = static_cast<uint8_t *>(dst);
+    const uint8_t *__restrict__ s = static_cast<const uint8_t *>(src);
+    const __m256i alphaMask       = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+
+    for (; pixelCount >= 16; pixelCount -= 16, d += 64, s += 64) {
+        __m256i d0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(d));
+        __m256i d1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(d + 32));
+        __m256i s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s));
+        __m256i s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + 32));
+
+        __m256i dAnd = _mm256_and_si256(_mm256_and_si256(d0, d1), alphaMask);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(dAnd, alphaMask)) == -1) continue;
+        if (_mm256_testz_si256(_mm256_or_si256(s0, s1), alphaMask)) continue;
+        if (_mm256_testz_si256(_mm256_or_si256(d0, d1), alphaMask)) {
+            const __m256i zero = _mm256_setzero_si256();
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(d),
+                                _mm256_blendv_epi8(s0, d0, _mm256_cmpeq_epi32(_mm256_and_si256(s0, alphaMask), zero)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + 32),
+                                _mm256_blendv_epi8(s1, d1, _mm256_cmpeq_epi32(_mm256_and_si256(s1, alphaMask), zero)));
+            continue;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d), blendUnderRGBA8_avx2_block(d0, s0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + 32), blendUnderRGBA8_avx2_block(d1, s1));
+    }
+    if (pixelCount >= 8) {
+        __m256i d0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(d));
+        __m256i s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d), blendUnderRGBA8_avx2_block(d0, s0));
+        pixelCount -= 8;
+        d += 32;
+        s += 32;
+    }
+    if (pixelCount) blendUnderRGBA8_sse41(d, s, pixelCount);
+}
+
+// CPU機能に応じた実装を選択（AVX2 > SSE4.1 > スカラー）
+static RowFunc selectBlendUnderRGBA8()
+{
+    if (cpuFeatures().avx2) return blendUnderRGBA8_avx2;
+    if (cpuFeatures().sse41) return blendUnderRGBA8_sse41;
+    return rgba8Straight_blendUnderScalar;
+}
+
+}  // namespace detail
+}  // namespace pixel_format
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_SIMD_X86
@@ -0,0 +1,57 @@
+/**
+ * @file simd_x86.inl
+ * @brief ピクセルフォーマット SIMD 実装の共通部（x86: 有効判定・CPU機能判定）
+ *
+ * 各フォーマットの SIMD 実装（*_simd.inl）は GCC/Clang の target 属性で
+ * 関数単位に命令セットを有効化し、実行時にCPU機能を判定して実装を選択する
+ * （ビルドオプションの変更は不要）。
+ * FLEXIMG_NO_SIMD を定義するとスカラー版のみを使用する。
+ */
+
+#ifndef FLEXIMG_PIXEL_FORMAT_SIMD_X86_INL
+#define FLEXIMG_PIXEL_FORMAT_SIMD_X86_INL
+
+#if !defined(FLEXIMG_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FLEXIMG_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+#ifdef FLEXIMG_SIMD_X86
+
+namespace FLEXIMG_NAMESPACE {
+namespace pixel_format {
+namespace detail {
+
+// 行処理関数（dst, src, pixelCount）: SIMD版・スカラー版共通のシグネチャ
+// 変換関数は in-place（dst == src）でも呼ばれるため __restrict__ は付けない
+using RowFunc = void (*)(void *, const void *, size_t);
+
+// 実行時のCPU機能（初回呼び出し時に1回のみ判定）
+struct CpuFeatures {
+    bool sse2;
+    bool ssse3;
+    bool sse41;
+    bool avx2;
+};
+
+static const CpuFeatures &cpuFeatures()
+{
+    static const CpuFeatures features = []() {
+        __builtin_cpu_init();
+        CpuFeatures f;
+        f.sse2  = __builtin_cpu_supports("sse2");
+        f.ssse3 = __builtin_cpu_supports("ssse3");
+        f.sse41 = __builtin_cpu_supports("sse4.1");
+        f.avx2  = __builtin_cpu_supports("avx2");
+        return f;
+    }();
+    return features;
+}
+
+}  // namespace detail
+}  // namespace pixel_format
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_SIMD_X86
+
+#endif  // FLEXIMG_PIXEL_FORMAT_SIMD_X86_INL
@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <cstring>
 
+#include "viewport_simd.inl"
+
 namespace FLEXIMG_NAMESPACE {
 namespace view_ops {
 
@@ -195,6 +197,9 @@ __attribute__((noinline)) static void bilinearBlend_1ch(uint8_t *__restrict__ ds
 //   c. edgeFlags適用: 境界ピクセルのアルファを0化
 //   d. bilinearBlend_RGBA8888: バイリニア補間
 //
+// RGBA8_Straight ソースでは、4近傍がソース内に収まるピクセルを a〜d を融合した
+// SIMD版（viewport_simd.inl）で処理し、境界に掛かるピクセルのみ上記の流れで処理する。
+//
 
 void copyRowDDABilinear(void *dst, const ViewPort &src, int_fast16_t count, int_fixed srcX, int_fixed srcY,
                         int_fixed incrX, int_fixed incrY, uint8_t edgeFadeMask, const PixelAuxInfo *srcAux)
@@ -309,8 +314,28 @@ void copyRowDDABilinear(void *dst, const ViewPort &src, int_fast16_t count, int_
                       srcY + offsetY,  // オフセット加算
                       incrX,          incrY,     weightsXY,  edgeFlagsChunk};
 
-    for (int_fast16_t offset = 0; offset < count; offset += CHUNK_SIZE) {
-        int_fast16_t chunk = (count - offset < CHUNK_SIZE) ? (count - offset) : CHUNK_SIZE;
+#ifdef FLEXIMG_SIMD_X86
+    // RGBA8_Straight（変換不要）は内部ピクセルを1パスで補間し、境界に掛かるピクセルのみチャンク処理する
+    static const BilinearInteriorFunc interior = selectBilinearInteriorRGBA8();
+    const BilinearInteriorFunc fused           = converter ? nullptr : interior;
+#endif
+
+    for (int_fast16_t offset = 0; offset < count;) {
+#ifdef FLEXIMG_SIMD_X86
+        if (fused) {
+            int_fast16_t done = fused(dstPtr, srcData, count - offset, &param);
+            dstPtr += done;
+            param.srcX += incrX * static_cast<int_fixed>(done);
+            param.srcY += incrY * static_cast<int_fixed>(done);
+            offset += done;
+            if (offset >= count) break;
+        }
+        // 境界に掛かるブロック（8ピクセル）のみ処理し、内部ピクセルの1パス処理に戻る
+        const int_fast16_t chunkMax = fused ? 8 : CHUNK_SIZE;
+#else
+        const int_fast16_t chunkMax = CHUNK_SIZE;
+#endif
+        int_fast16_t chunk = (count - offset < chunkMax) ? (count - offset) : chunkMax;
 
         // 4ピクセル抽出 + edgeFlags生成（末尾詰め配置でin-place変換可能）
         int srcQuadSize = srcBytesPerPixel * 4 * chunk;
@@ -354,6 +379,119 @@ void copyRowDDABilinear(void *dst, const ViewPort &src, int_fast16_t count, int_
         dstPtr += chunk;
         param.srcX += incrX * chunk;
         param.srcY += incrY * chunk;
+        offset += chunk;
+    }
+}
+
+// ============================================================================
+// 列テーブル転写
+// ============================================================================
+
+template <typename T>
+static void copyRowColumnMap_T(T *__restrict__ dst, const T *__restrict__ srcRow, const int32_t *__restrict__ columns,
+                               int_fast16_t count)
+{
+    int_fast16_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        auto p0    = srcRow[columns[i]];
+        auto p1    = srcRow[columns[i + 1]];
+        auto p2    = srcRow[columns[i + 2]];
+        auto p3    = srcRow[columns[i + 3]];
+        dst[i]     = p0;
+        dst[i + 1] = p1;
+        dst[i + 2] = p2;
+        dst[i + 3] = p3;
+    }
+    for (; i < count; ++i) {
+        dst[i] = srcRow[columns[i]];
+    }
+}
+
+void copyRowColumnMap(void *dst, const ViewPort &src, int_fast16_t srcY, const int32_t *columns, int_fast16_t count)
+{
+    if (!src.isValid() || count <= 0) return;
+
+    const void *srcRow = src.pixelAt(0, static_cast<int>(srcY));
+    switch (src.formatID->bytesPerPixel) {
+        case 1:
+            copyRowColumnMap_T(static_cast<uint8_t *>(dst), static_cast<const uint8_t *>(srcRow), columns, count);
+            break;
+        case 2:
+            copyRowColumnMap_T(static_cast<uint16_t *>(dst), static_cast<const uint16_t *>(srcRow), columns, count);
+            break;
+        case 3: {
+            auto d = static_cast<uint8_t *>(dst);
+            auto s = static_cast<const uint8_t *>(srcRow);
+            for (int_fast16_t i = 0; i < count; ++i) {
+                const uint8_t *p = s + static_cast<size_t>(columns[i]) * 3;
+                d[0]             = p[0];
+                d[1]             = p[1];
+                d[2]             = p[2];
+                d += 3;
+            }
+            break;
+        }
+        case 4: {
+            int_fast16_t done = 0;
+#ifdef FLEXIMG_SIMD_X86
+            static const ColumnMapFunc gather = selectColumnMap4Byte();
+            if (gather) {
+                done = gather(static_cast<uint32_t *>(dst), static_cast<const uint8_t *>(srcRow), columns, count);
+            }
+#endif
+            copyRowColumnMap_T(static_cast<uint32_t *>(dst) + done, static_cast<const uint32_t *>(srcRow),
+                               columns + done, count - done);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void copyRowColumnMapBilinear(void *dst, const ViewPort &src, int_fixed srcY, const int32_t *columns,
+                              const uint8_t *weights, int_fast16_t count)
+{
+    if (!src.isValid() || count <= 0) return;
+
+    const auto sy         = static_cast<int_fast16_t>(srcY >> INT_FIXED_SHIFT);
+    const uint_fast8_t fy = static_cast<uint_fast8_t>((srcY >> (INT_FIXED_SHIFT - 8)) & 0xFF);
+    const auto *row0      = static_cast<const uint32_t *>(src.pixelAt(0, static_cast<int>(sy)));
+    const auto *row1      = static_cast<const uint32_t *>(src.pixelAt(0, static_cast<int>(sy + 1)));
+    auto *dstPtr          = static_cast<uint32_t *>(dst);
+    int_fast16_t i        = 0;
+
+#ifdef FLEXIMG_SIMD_X86
+    static const ColumnMapBilinearFunc blend = selectColumnMapBilinearRGBA8();
+    if (blend) {
+        i = blend(dstPtr, row0, row1, fy, columns, weights, count);
+    }
+#endif
+
+    // 重み・補間式は bilinearBlend_RGBA8888 と同一
+    for (; i < count; ++i) {
+        uint_fast8_t fx    = weights[i];
+        uint32_t f         = static_cast<uint32_t>(fx) * ((256 - fy) | (static_cast<uint32_t>(fy) << 16));
+        uint8_t q11f       = static_cast<uint8_t>(f >> 24);
+        uint8_t q10f       = static_cast<uint8_t>(f >> 8);
+        uint8_t q01f       = static_cast<uint8_t>(((256 - fx) * fy) >> 8);
+        uint_fast16_t q00f = static_cast<uint_fast16_t>(256 - (q11f + q01f + q10f));
+
+        const auto sx = static_cast<size_t>(columns[i]);
+        uint32_t q00  = row0[sx];
+        uint32_t q10  = row0[sx + 1];
+        uint32_t q01  = row1[sx];
+        uint32_t q11  = row1[sx + 1];
+
+        uint32_t result_rb = static_cast<uint32_t>(q00f * (q00 & 0xFF00FF) + q10f * (q10 & 0xFF00FF) +
+                                                   q01f * (q01 & 0xFF00FF) + q11f * (q11 & 0xFF00FF));
+        uint32_t result_ga = static_cast<uint32_t>(q00f * ((q00 >> 8) & 0xFF00FF) + q10f * ((q10 >> 8) & 0xFF00FF) +
+                                                   q01f * ((q01 >> 8) & 0xFF00FF) + q11f * ((q11 >> 8) & 0xFF00FF));
+
+        // 結果を出力（リトルエンディアン: G,Aは上位バイトが正しい位置に来る）
+        auto dstBytes = reinterpret_cast<uint8_t *>(dstPtr + i);
+        dstPtr[i]     = result_ga;
+        dstBytes[0]   = static_cast<uint8_t>(result_rb >> 8);   // R
+        dstBytes[2]   = static_cast<uint8_t>(result_rb >> 24);  // B
     }
 }
 
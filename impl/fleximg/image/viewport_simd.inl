@@ -0,0 +1,203 @@
+/**
+ * @file viewport_simd.inl
+ * @brief copyRowDDABilinear / 列テーブル転写（RGBA8_Straight）の SIMD 実装（x86: AVX2）
+ * @see impl/fleximg/image/viewport.inl
+ *
+ * 共通部（有効判定・CPU機能判定）は pixel_format/simd_x86.inl
+ * 4近傍がすべてソース内に収まるピクセル（境界フラグなし）について、
+ * 重み計算・4近傍の取得・補間を1パスで行い、RGBA8を直接出力する
+ * （copyQuadDDA のチャンクバッファを経由しない）。
+ * 境界に掛かるピクセルは従来のパス（copyQuadDDA + edgeFlags + bilinearBlend_RGBA8888）で処理する。
+ * 列テーブル転写（回転なしの拡大縮小）は、事前計算した列インデックス・重みを読み込んでギャザーする。
+ */
+
+#include "pixel_format/simd_x86.inl"
+
+#ifdef FLEXIMG_SIMD_X86
+
+namespace FLEXIMG_NAMESPACE {
+namespace view_ops {
+
+// 内部ピクセル用の補間関数（dst, srcData, count, param）: 処理したピクセル数を返す
+using BilinearInteriorFunc = int_fast16_t (*)(uint32_t *__restrict__, const uint8_t *__restrict__, int_fast16_t,
+                                              const DDAParam *);
+
+// ========================================================================
+// RGBA8 バイリニア補間（8ピクセル単位）
+//
+// 先頭から、8ピクセルすべてが内部（sx < srcWidth - 1 かつ sy < srcHeight - 1）の
+// ブロックを連続して処理し、境界に掛かるブロックの手前で戻る。
+// 重み・補間式は bilinearBlend_RGBA8888 と同一（結果はビット単位で一致）:
+//   q10f = fx * (256 - fy) >> 8, q11f = fx * fy >> 8, q01f = (256 - fx) * fy >> 8
+//   q00f = 256 - (q10f + q11f + q01f)
+//   c = (q00f * c00 + q10f * c10 + q01f * c01 + q11f * c11) >> 8（16bitに収まる）
+// ========================================================================
+
+// 8ピクセル（32bit×8）と重み（32bit×8、0〜256）の積を16bitチャンネル単位で加算
+__attribute__((target("avx2"))) static inline void bilinearAccumulate_avx2(__m256i &accLo, __m256i &accHi,
+                                                                           __m256i pixels, __m256i weight)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    // 重みを各ピクセルの4チャンネル（16bit×4）に複製
+    __m256i w2 = _mm256_or_si256(weight, _mm256_slli_epi32(weight, 16));
+    accLo      = _mm256_add_epi16(accLo,
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(pixels, zero), _mm256_unpacklo_epi32(w2, w2)));
+    accHi      = _mm256_add_epi16(accHi,
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(pixels, zero), _mm256_unpackhi_epi32(w2, w2)));
+}
+
+__attribute__((target("avx2"))) static int_fast16_t bilinearInteriorRGBA8_avx2(uint32_t *__restrict__ dst,
+                                                                               const uint8_t *__restrict__ srcData,
+                                                                               int_fast16_t count,
+                                                                               const DDAParam *param)
+{
+    const int32_t srcStride = param->srcStride;
+    const int32_t srcLastX  = param->srcWidth - 1;
+    const int32_t srcLastY  = param->srcHeight - 1;
+    if (srcLastX <= 0 || srcLastY <= 0) return 0;
+    // 内部ピクセルのオフセット（sy * srcStride + sx * 4）が int32 に収まること
+    if ((srcStride < 0 ? -static_cast<int64_t>(srcStride) : static_cast<int64_t>(srcStride)) *
+                static_cast<int64_t>(param->srcHeight) +
+            static_cast<int64_t>(param->srcWidth) * 4 >
+        INT32_MAX) {
+        return 0;
+    }
+
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i vx = _mm256_add_epi32(_mm256_set1_epi32(param->srcX), _mm256_mullo_epi32(_mm256_set1_epi32(param->incrX), lane));
+    __m256i vy = _mm256_add_epi32(_mm256_set1_epi32(param->srcY), _mm256_mullo_epi32(_mm256_set1_epi32(param->incrY), lane));
+    const __m256i stepX  = _mm256_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(param->incrX) * 8u));
+    const __m256i stepY  = _mm256_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(param->incrY) * 8u));
+    const __m256i limitX = _mm256_set1_epi32(srcLastX - 1);
+    const __m256i limitY = _mm256_set1_epi32(srcLastY - 1);
+    const __m256i strd   = _mm256_set1_epi32(srcStride);
+    const __m256i mask8  = _mm256_set1_epi32(0xFF);
+    const __m256i w256   = _mm256_set1_epi32(256);
+    const auto *row0     = reinterpret_cast<const int *>(srcData);
+    const auto *row0r    = reinterpret_cast<const int *>(srcData + 4);
+    const auto *row1     = reinterpret_cast<const int *>(srcData + srcStride);
+    const auto *row1r    = reinterpret_cast<const int *>(srcData + srcStride + 4);
+
+    int_fast16_t done = 0;
+    for (; done + 8 <= count; done += 8) {
+        __m256i sx = _mm256_srai_epi32(vx, INT_FIXED_SHIFT);
+        __m256i sy = _mm256_srai_epi32(vy, INT_FIXED_SHIFT);
+        // 符号なし比較 sx <= srcLastX - 1（負の座標は大きな値として除外）
+        __m256i inside = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_min_epu32(sx, limitX), sx),
+                                          _mm256_cmpeq_epi32(_mm256_min_epu32(sy, limitY), sy));
+        if (_mm256_movemask_epi8(inside) != -1) break;
+
+        // 重み（bilinearBlend_RGBA8888 と同じ切り捨て順序、積は16bitに収まる）
+        __m256i fx   = _mm256_and_si256(_mm256_srli_epi32(vx, INT_FIXED_SHIFT - 8), mask8);
+        __m256i fy   = _mm256_and_si256(_mm256_srli_epi32(vy, INT_FIXED_SHIFT - 8), mask8);
+        __m256i ifx  = _mm256_sub_epi32(w256, fx);
+        __m256i ify  = _mm256_sub_epi32(w256, fy);
+        __m256i q10f = _mm256_srli_epi32(_mm256_mullo_epi16(fx, ify), 8);
+        __m256i q11f = _mm256_srli_epi32(_mm256_mullo_epi16(fx, fy), 8);
+        __m256i q01f = _mm256_srli_epi32(_mm256_mullo_epi16(ifx, fy), 8);
+        __m256i q00f = _mm256_sub_epi32(w256, _mm256_add_epi32(_mm256_add_epi32(q10f, q11f), q01f));
+
+        __m256i off   = _mm256_add_epi32(_mm256_mullo_epi32(sy, strd), _mm256_slli_epi32(sx, 2));
+        __m256i accLo = _mm256_setzero_si256();
+        __m256i accHi = _mm256_setzero_si256();
+        bilinearAccumulate_avx2(accLo, accHi, _mm256_i32gather_epi32(row0, off, 1), q00f);
+        bilinearAccumulate_avx2(accLo, accHi, _mm256_i32gather_epi32(row0r, off, 1), q10f);
+        bilinearAccumulate_avx2(accLo, accHi, _mm256_i32gather_epi32(row1, off, 1), q01f);
+        bilinearAccumulate_avx2(accLo, accHi, _mm256_i32gather_epi32(row1r, off, 1), q11f);
+
+        // unpack と同じレーン構成で pack するため、ピクセル順は元に戻る
+        __m256i result = _mm256_packus_epi16(_mm256_srli_epi16(accLo, 8), _mm256_srli_epi16(accHi, 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + done), result);
+
+        vx = _mm256_add_epi32(vx, stepX);
+        vy = _mm256_add_epi32(vy, stepY);
+    }
+    return done;
+}
+
+// CPU機能に応じた実装を選択（AVX2 > なし）
+static BilinearInteriorFunc selectBilinearInteriorRGBA8()
+{
+    if (pixel_format::detail::cpuFeatures().avx2) return bilinearInteriorRGBA8_avx2;
+    return nullptr;
+}
+
+// ========================================================================
+// 列テーブル転写（4バイト/ピクセル、8ピクセル単位）
+//
+// 列インデックスを8個ずつ読み込み、vpgatherdd で取得する。
+// 戻り値は処理したピクセル数（端数は呼び出し側でスカラー版により処理）。
+// ========================================================================
+
+// 最近傍（dst, srcRow, columns, count）
+using ColumnMapFunc = int_fast16_t (*)(uint32_t *__restrict__, const uint8_t *__restrict__, const int32_t *,
+                                       int_fast16_t);
+// バイリニア（dst, row0, row1, fy, columns, weights, count）
+using ColumnMapBilinearFunc = int_fast16_t (*)(uint32_t *__restrict__, const uint32_t *, const uint32_t *,
+                                               uint_fast8_t, const int32_t *, const uint8_t *, int_fast16_t);
+
+__attribute__((target("avx2"))) static int_fast16_t columnMap4Byte_avx2(uint32_t *__restrict__ dst,
+                                                                         const uint8_t *__restrict__ srcRow,
+                                                                         const int32_t *columns, int_fast16_t count)
+{
+    const auto *base  = reinterpret_cast<const int *>(srcRow);
+    int_fast16_t done = 0;
+    for (; done + 8 <= count; done += 8) {
+        __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(columns + done));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + done), _mm256_i32gather_epi32(base, sx, 4));
+    }
+    return done;
+}
+
+// 重み・補間式は bilinearInteriorRGBA8_avx2 と同一（fy は行で一定）
+__attribute__((target("avx2"))) static int_fast16_t columnMapBilinearRGBA8_avx2(
+    uint32_t *__restrict__ dst, const uint32_t *row0, const uint32_t *row1, uint_fast8_t fy, const int32_t *columns,
+    const uint8_t *weights, int_fast16_t count)
+{
+    const __m256i w256 = _mm256_set1_epi32(256);
+    const __m256i vfy  = _mm256_set1_epi32(static_cast<int>(fy));
+    const __m256i ify  = _mm256_sub_epi32(w256, vfy);
+    const auto *r0     = reinterpret_cast<const int *>(row0);
+    const auto *r0r    = reinterpret_cast<const int *>(row0 + 1);
+    const auto *r1     = reinterpret_cast<const int *>(row1);
+    const auto *r1r    = reinterpret_cast<const int *>(row1 + 1);
+
+    int_fast16_t done = 0;
+    for (; done + 8 <= count; done += 8) {
+        __m256i sx   = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(columns + done));
+        __m256i fx   = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(weights + done)));
+        __m256i ifx  = _mm256_sub_epi32(w256, fx);
+        __m256i q10f = _mm256_srli_epi32(_mm256_mullo_epi16(fx, ify), 8);
+        __m256i q11f = _mm256_srli_epi32(_mm256_mullo_epi16(fx, vfy), 8);
+        __m256i q01f = _mm256_srli_epi32(_mm256_mullo_epi16(ifx, vfy), 8);
+        __m256i q00f = _mm256_sub_epi32(w256, _mm256_add_epi32(_mm256_add_epi32(q10f, q11f), q01f));
+
+        __m256i accLo = _mm256_setzero_si256();
+        __m256i accHi = _mm256_setzero_si256();
+        bilinearAccumulate_avx2(accLo, accHi, _mm256_i32gather_epi32(r0, sx, 4), q00f);
+        bilinearAccumulate_avx2(accLo, accHi, _mm256_i32gather_epi32(r0r, sx, 4), q10f);
+        bilinearAccumulate_avx2(accLo, accHi, _mm256_i32gather_epi32(r1, sx, 4), q01f);
+        bilinearAccumulate_avx2(accLo, accHi, _mm256_i32gather_epi32(r1r, sx, 4), q11f);
+
+        __m256i result = _mm256_packus_epi16(_mm256_srli_epi16(accLo, 8), _mm256_srli_epi16(accHi, 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + done), result);
+    }
+    return done;
+}
+
+// CPU機能に応じた実装を選択（AVX2 > なし）
+static ColumnMapFunc selectColumnMap4Byte()
+{
+    if (pixel_format::detail::cpuFeatures().avx2) return columnMap4Byte_avx2;
+    return nullptr;
+}
+static ColumnMapBilinearFunc selectColumnMapBilinearRGBA8()
+{
+    if (pixel_format::detail::cpuFeatures().avx2) return columnMapBilinearRGBA8_avx2;
+    return nullptr;
+}
+
+}  // namespace view_ops
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_SIMD_X86
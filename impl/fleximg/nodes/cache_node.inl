@@ -0,0 +1,201 @@
+/**
+ * @file cache_node.inl
+ * @brief CacheNode 実装
+ * @see src/fleximg/nodes/cache_node.h
+ */
+
+namespace FLEXIMG_NAMESPACE {
+
+// ============================================================================
+// CacheNode - Template Method フック実装
+// ============================================================================
+
+PrepareResponse CacheNode::onPullPrepare(const PrepareRequest &request)
+{
+    Node *upstream = upstreamNode(0);
+    if (!upstream) {
+        // 上流なし: キャッシュを破棄してサイズ0を返す
+        cache_ = ImageBuffer();
+        rowRanges_.clear();
+        cachedSubtree_.clear();
+        cacheValid_  = false;
+        cacheActive_ = false;
+        PrepareResponse result;
+        result.status = PrepareStatus::Prepared;
+        return result;
+    }
+
+    // 上流サブツリー・要求・アロケータが前回の描画時と同じならキャッシュを使用（上流は準備しない）
+    currentSubtree_.clear();
+    collectSubtree(upstream, currentSubtree_);
+    bool unchanged = cacheValid_ && request.sameAs(cachedRequest_) && persistentAllocator() == cacheAllocator_ &&
+                     currentSubtree_.size() == cachedSubtree_.size();
+    for (size_t i = 0; unchanged && i < currentSubtree_.size(); ++i) {
+        unchanged = currentSubtree_[i].node == cachedSubtree_[i].node &&
+                    currentSubtree_[i].revision == cachedSubtree_[i].revision;
+    }
+    if (unchanged) {
+        cacheActive_ = true;
+        return cachedResponse_;
+    }
+
+    // 上流を準備し直して再描画
+    PrepareResponse upstreamResult = upstream->pullPrepare(request);
+    cachedSubtree_.swap(currentSubtree_);
+    cachedRequest_  = request;
+    cacheAllocator_ = persistentAllocator();
+
+    cacheValid_  = upstreamResult.ok() && renderCache(upstream, request, upstreamResult);
+    cacheActive_ = cacheValid_;
+    if (!cacheValid_) {
+        // 準備失敗・キャッシュ確保失敗時は上流をそのまま返す（パススルー）
+        cache_ = ImageBuffer();
+        rowRanges_.clear();
+        return upstreamResult;
+    }
+
+    cachedResponse_                 = upstreamResult;
+    cachedResponse_.width           = static_cast<int16_t>(cache_.width());
+    cachedResponse_.height          = static_cast<int16_t>(cache_.height());
+    cachedResponse_.origin          = cacheOrigin_;
+    cachedResponse_.preferredFormat = format_;
+    return cachedResponse_;
+}
+
+RenderResponse &CacheNode::onPullProcess(const RenderRequest &request)
+{
+    if (!cacheActive_) {
+        Node *upstream = upstreamNode(0);
+        if (!upstream) return makeEmptyResponse(request.origin);
+        return upstream->pullProcess(request);
+    }
+
+    // キャッシュ座標系での要求行・左端（キャッシュはリクエストのピクセル格子に揃えてある）
+    int y = from_fixed_floor(request.origin.y - cacheOrigin_.y);
+    if (y < 0 || y >= cache_.height()) {
+        return makeEmptyResponse(request.origin);
+    }
+    int left   = from_fixed_floor(request.origin.x - cacheOrigin_.x);
+    auto &row  = rowRanges_[static_cast<size_t>(y)];
+    int startX = std::max<int>(row.startX, left);
+    int endX   = std::min<int>(row.endX, left + request.width);
+    if (startX >= endX) {
+        return makeEmptyResponse(request.origin);
+    }
+
+    FLEXIMG_METRICS_SCOPE(NodeType::Cache);
+
+    // 下流のインプレース加工からキャッシュを守るため、データ範囲のみコピーして返す
+    auto width = static_cast<int_fast16_t>(endX - startX);
+    ImageBuffer output(width, 1, format_, InitPolicy::Uninitialized, allocator());
+    if (!output.isValid()) {
+        return makeEmptyResponse(request.origin);
+    }
+    std::memcpy(output.data(), cache_.view().pixelAt(startX, y),
+                static_cast<size_t>(width) * format_->bytesPerPixel);
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    PerfMetrics::instance().nodes[NodeType::Cache].recordAlloc(output.totalBytes(), output.width(), 1);
+#endif
+
+    return makeResponse(std::move(output), Point{cacheOrigin_.x + to_fixed(startX), cacheOrigin_.y + to_fixed(y)});
+}
+
+DataRange CacheNode::getDataRange(const RenderRequest &request) const
+{
+    if (!cacheActive_) {
+        return Node::getDataRange(request);
+    }
+
+    int y = from_fixed_floor(request.origin.y - cacheOrigin_.y);
+    if (y < 0 || y >= cache_.height()) {
+        return DataRange{0, 0};
+    }
+    int left   = from_fixed_floor(request.origin.x - cacheOrigin_.x);
+    auto &row  = rowRanges_[static_cast<size_t>(y)];
+    int startX = std::max<int>(row.startX, left);
+    int endX   = std::min<int>(row.endX, left + request.width);
+    if (startX >= endX) {
+        return DataRange{0, 0};
+    }
+    // request座標系に変換
+    return DataRange{static_cast<int16_t>(startX - left), static_cast<int16_t>(endX - left)};
+}
+
+// ============================================================================
+// CacheNode - private ヘルパーメソッド実装
+// ============================================================================
+
+void CacheNode::collectSubtree(const Node *node, std::vector<SubtreeEntry> &out)
+{
+    out.push_back(SubtreeEntry{node, node ? node->revision() : 0});
+    if (!node) return;
+    for (int i = 0; i < node->inputPortCount(); ++i) {
+        collectSubtree(node->upstreamNode(i), out);
+    }
+}
+
+bool CacheNode::renderCache(Node *upstream, const PrepareRequest &request, const PrepareResponse &upstreamResult)
+{
+    cache_ = ImageBuffer();
+    rowRanges_.clear();
+    ++renderCount_;
+
+    // キャッシュ範囲: 上流のAABBを、リクエストのピクセル格子（スクリーン左上基準）に合わせて外側へ拡張
+    int left       = from_fixed_floor(upstreamResult.origin.x - request.origin.x);
+    int top        = from_fixed_floor(upstreamResult.origin.y - request.origin.y);
+    int right      = from_fixed_ceil(upstreamResult.origin.x + to_fixed(upstreamResult.width) - request.origin.x);
+    int bottom     = from_fixed_ceil(upstreamResult.origin.y + to_fixed(upstreamResult.height) - request.origin.y);
+    cacheOrigin_.x = request.origin.x + to_fixed(left);
+    cacheOrigin_.y = request.origin.y + to_fixed(top);
+
+    // 空のAABB: データなしとしてキャッシュ（上流の再描画は不要）
+    if (upstreamResult.width <= 0 || upstreamResult.height <= 0 || right <= left || bottom <= top) {
+        return true;
+    }
+    if (right - left > INT16_MAX || bottom - top > INT16_MAX) {
+        return false;
+    }
+
+    auto width  = static_cast<int_fast16_t>(right - left);
+    auto height = static_cast<int_fast16_t>(bottom - top);
+    cache_      = ImageBuffer(width, height, format_, InitPolicy::Zero, persistentAllocator());
+    if (!cache_.isValid()) {
+        return false;
+    }
+    rowRanges_.assign(static_cast<size_t>(height), DataRange{0, 0});
+
+    RenderContext *ctx = context();
+    ViewPort dstView   = cache_.view();
+    for (int_fast16_t y = 0; y < height; ++y) {
+        RenderRequest rowReq;
+        rowReq.width    = static_cast<int16_t>(width);
+        rowReq.height   = 1;
+        rowReq.origin.x = cacheOrigin_.x;
+        rowReq.origin.y = cacheOrigin_.y + to_fixed(static_cast<int>(y));
+
+        if (upstream->getDataRange(rowReq).hasData()) {
+            RenderResponse &result = upstream->pullProcess(rowReq);
+            if (result.isValid()) {
+                const ImageBuffer &buf = result.buffer();
+                ViewPort srcView       = buf.view();
+                auto offsetX           = static_cast<int_fast32_t>(from_fixed(buf.origin().x - rowReq.origin.x));
+                int_fast32_t srcX      = std::max<int_fast32_t>(0, -offsetX);
+                int_fast32_t dstX      = std::max<int_fast32_t>(0, offsetX);
+                int_fast32_t w         = std::min<int_fast32_t>(srcView.width - srcX, width - dstX);
+                auto converter         = resolveConverter(srcView.formatID, format_, &buf.auxInfo());
+                if (w > 0 && converter) {
+                    converter(dstView.pixelAt(static_cast<int>(dstX), static_cast<int>(y)),
+                              srcView.pixelAt(static_cast<int>(srcX), 0), static_cast<size_t>(w));
+                    rowRanges_[static_cast<size_t>(y)] = DataRange{static_cast<int16_t>(dstX),
+                                                                   static_cast<int16_t>(dstX + w)};
+                }
+            }
+        }
+        // 行ごとにResponse・スキャンラインバッファを解放（prepare中は他に使用中のものはない）
+        if (ctx) ctx->resetScanlineResources();
+    }
+    return true;
+}
+
+}  // namespace FLEXIMG_NAMESPACE
@@ -34,6 +34,7 @@ PrepareResponse CompositeNode::onPullPrepare(const PrepareRequest &request)
 
     // 全上流へ伝播し、結果をマージ（AABB和集合）
     auto numInputs = inputCount();
+    inputSpans_.assign(static_cast<size_t>(numInputs), InputSpan{});
     for (int_fast16_t i = 0; i < numInputs; ++i) {
         Node *upstream = upstreamNode(i);
         if (upstream) {
@@ -51,6 +52,13 @@ PrepareResponse CompositeNode::onPullPrepare(const PrepareRequest &request)
             float right  = left + static_cast<float>(result.width);
             float bottom = top + static_cast<float>(result.height);
 
+            // アクティブリスト用のY範囲（補間・丸め差を上下1行の拡張で吸収）
+            if (result.width > 0 && result.height > 0) {
+                InputSpan &span = inputSpans_[static_cast<size_t>(i)];
+                span.top        = from_fixed_floor(result.origin.y) - 1;
+                span.bottom     = from_fixed_ceil(result.origin.y + to_fixed(result.height)) + 1;
+            }
+
             if (validUpstreamCount == 0) {
                 // 最初の結果でベースを初期化
                 merged.preferredFormat = result.preferredFormat;
@@ -98,6 +106,8 @@ PrepareResponse CompositeNode::onPullPrepare(const PrepareRequest &request)
     // getDataRangeキャッシュを無効化（アフィン行列が変わる可能性があるため）
     dataRangeCache_.invalidate();
 
+    buildActiveList();
+
     return merged;
 }
 
@@ -123,12 +133,17 @@ DataRange CompositeNode::getDataRange(const RenderRequest &request) const
         return cached;
     }
 
-    auto numInputs      = inputCount();
     int_fast16_t startX = request.width;  // 右端で初期化
     int_fast16_t endX   = 0;              // 左端で初期化
 
-    for (int_fast16_t i = 0; i < numInputs; ++i) {
-        Node *upstream = upstreamNode(i);
+    // 要求行に掛かる入力のみを対象にする
+    int32_t y0 = from_fixed_floor(request.origin.y);
+    int32_t y1 = y0 + request.height;
+    const uint16_t *first, *last;
+    activeInputsFor(request, first, last);
+    for (const uint16_t *it = first; it != last; ++it) {
+        if (!inputSpans_[*it].covers(y0, y1)) continue;
+        Node *upstream = upstreamNode(*it);
         if (!upstream) continue;
 
         DataRange range = upstream->getDataRange(request);
@@ -149,15 +164,114 @@ DataRange CompositeNode::getDataRange(const RenderRequest &request) const
     return result;
 }
 
+void CompositeNode::getDataSpans(const RenderRequest &request, DataRangeList &out) const
+{
+    int32_t y0 = from_fixed_floor(request.origin.y);
+    int32_t y1 = y0 + request.height;
+    const uint16_t *first, *last;
+    activeInputsFor(request, first, last);
+    for (const uint16_t *it = first; it != last; ++it) {
+        if (!inputSpans_[*it].covers(y0, y1)) continue;
+        Node *upstream = upstreamNode(*it);
+        if (upstream) upstream->getDataSpans(request, out);
+    }
+}
+
+namespace {
+
+// 合成バッファ内の不透明区間（合成バッファ座標、昇順・非重複・非隣接）
+// 上限を超えた区間や狭い区間は記録しない（記録漏れは遮蔽が弱まるだけで合成結果は変わらない）
+struct CompositeOpaqueSpans {
+    static constexpr int MAX_SPANS          = 8;
+    static constexpr int_fast16_t MIN_WIDTH = 16;  // これより狭い区間は分割リクエストの方が高くつく
+    DataRange spans[MAX_SPANS];
+    int count = 0;
+
+    // 区間を追加（重なる・隣接する区間と統合、溢れた場合は最も狭い区間を捨てる）
+    void add(int_fast16_t start, int_fast16_t end)
+    {
+        DataRange merged{static_cast<int16_t>(start), static_cast<int16_t>(end)};
+        DataRange result[MAX_SPANS + 1];
+        int n         = 0;
+        bool inserted = false;
+        for (int i = 0; i < count; ++i) {
+            const DataRange &s = spans[i];
+            if (s.endX < merged.startX) {
+                result[n++] = s;
+            } else if (merged.endX < s.startX) {
+                if (!inserted) {
+                    result[n++] = merged;
+                    inserted    = true;
+                }
+                result[n++] = s;
+            } else {
+                merged.startX = std::min(merged.startX, s.startX);
+                merged.endX   = std::max(merged.endX, s.endX);
+            }
+        }
+        if (!inserted) result[n++] = merged;
+
+        if (n > MAX_SPANS) {
+            int narrowest = 0;
+            for (int i = 1; i < n; ++i) {
+                if (result[i].endX - result[i].startX < result[narrowest].endX - result[narrowest].startX) {
+                    narrowest = i;
+                }
+            }
+            for (int i = narrowest; i + 1 < n; ++i) {
+                result[i] = result[i + 1];
+            }
+            --n;
+        }
+        count = n;
+        for (int i = 0; i < n; ++i) {
+            spans[i] = result[i];
+        }
+    }
+
+    // [0, width) のうち不透明区間に覆われていない区間を列挙（out は MAX_SPANS + 1 個）
+    int gaps(int_fast16_t width, DataRange *out) const
+    {
+        int n             = 0;
+        int_fast16_t left = 0;
+        for (int i = 0; i < count; ++i) {
+            if (spans[i].startX > left) {
+                out[n++] = DataRange{static_cast<int16_t>(left), spans[i].startX};
+            }
+            left = spans[i].endX;
+        }
+        if (left < width) {
+            out[n++] = DataRange{static_cast<int16_t>(left), static_cast<int16_t>(width)};
+        }
+        return n;
+    }
+
+    // RGBA8_Straight の [start, end) を走査し、不透明（alpha=255）の連続区間を追加
+    void scan(const uint8_t *row, int_fast16_t start, int_fast16_t end)
+    {
+        int_fast16_t x = start;
+        while (x < end) {
+            while (x < end && row[x * 4 + 3] != 255) ++x;
+            int_fast16_t runStart = x;
+            while (x < end && row[x * 4 + 3] == 255) ++x;
+            if (x - runStart >= MIN_WIDTH) add(runStart, x);
+        }
+    }
+};
+
+}  // namespace
+
 // onPullProcess: 複数の上流から画像を取得してunder合成
 // 単一バッファ事前確保方式:
 // - getDataRangeで合成範囲を事前計算
 // - hintRangeサイズの合成バッファをゼロ初期化で確保
 // - 各上流の結果をblendFromで直接書き込み
+// 不透明区間の遮蔽:
+// - 合成済みの不透明区間を記録し、後続の入力には残りの区間のみを要求する
+// - 全域が不透明になった時点で残りの入力は処理しない
 RenderResponse &CompositeNode::onPullProcess(const RenderRequest &request)
 {
-    auto numInputs = inputCount();
-    if (numInputs == 0) return makeEmptyResponse(request.origin);
+    if (inputCount() == 0) return makeEmptyResponse(request.origin);
 
     // 1. hintRange取得（キャッシュ付き）
     DataRange hintRange = getDataRange(request);
@@ -168,7 +282,8 @@ RenderResponse &CompositeNode::onPullProcess(const RenderRequest &request)
     Point compositeOrigin = request.origin;
     compositeOrigin.x += to_fixed(hintRange.startX);
 
-    RenderResponse &resp      = context_->acquireResponse();
+    RenderContext *ctx        = context();
+    RenderResponse &resp      = ctx->acquireResponse();
     ImageBuffer *compositeBuf = resp.createBuffer(hintWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
 
     if (!compositeBuf || !compositeBuf->isValid()) {
@@ -176,29 +291,158 @@ RenderResponse &CompositeNode::onPullProcess(const RenderRequest &request)
     }
     compositeBuf->setOrigin(compositeOrigin);
 
-    // 3. 各上流を処理
-    for (int_fast16_t i = 0; i < numInputs; ++i) {
-        Node *upstream = upstreamNode(i);
+    // 3. 要求行に掛かる上流のみを処理（ポート順を維持）
+    int32_t y0 = from_fixed_floor(request.origin.y);
+    int32_t y1 = y0 + request.height;
+    const uint16_t *first, *last;
+    activeInputsFor(request, first, last);
+
+    CompositeOpaqueSpans opaque;
+    DataRange gaps[CompositeOpaqueSpans::MAX_SPANS + 1];
+    auto *compositeRow = static_cast<uint8_t *>(compositeBuf->data());
+    for (const uint16_t *it = first; it != last; ++it) {
+        if (!inputSpans_[*it].covers(y0, y1)) continue;
+        Node *upstream = upstreamNode(*it);
         if (!upstream) continue;
 
-        RenderResponse &input = upstream->pullProcess(request);
-        if (!input.isValid()) {
-            context_->releaseResponse(input);
-            continue;
+        // 不透明区間を除いた残りの区間（不透明区間がなければ元のリクエストのまま）
+        int gapCount = 1;
+        if (opaque.count > 0) {
+            gapCount = opaque.gaps(hintWidth, gaps);
+            if (gapCount == 0) break;  // 全域が不透明: 以降の入力は全て隠れる
         }
+        bool scanOpaque = (it + 1 != last);  // 最後の入力の後は走査不要
 
-        FLEXIMG_METRICS_SCOPE(NodeType::Composite);
+        for (int g = 0; g < gapCount; ++g) {
+            RenderRequest gapRequest = request;
+            if (opaque.count > 0) {
+                gapRequest.origin.x = compositeOrigin.x + to_fixed(gaps[g].startX);
+                gapRequest.width    = static_cast<int16_t>(gaps[g].endX - gaps[g].startX);
+            }
 
-        // 上流のバッファをblendFrom
-        if (input.hasBuffer()) {
-            compositeBuf->blendFrom(input.buffer());
-        }
+            RenderResponse &input = upstream->pullProcess(gapRequest);
+
+            // 合成バッファへのポインタは上流pullごとにrespから取り直す。
+            // プール枯渇時のフォールバックでrespが上流と共有・クリアされた場合は
+            // 合成結果が失われているため打ち切る（エラーはRenderContextに記録済み）
+            if (&input == &resp || !resp.hasBuffer()) {
+                if (&input != &resp) ctx->releaseResponse(input);
+                resp.clear();
+                resp.origin = compositeOrigin;
+                return resp;
+            }
+            compositeBuf = &resp.buffer();
+            compositeRow = static_cast<uint8_t *>(compositeBuf->data());
+
+            if (!input.isValid()) {
+                ctx->releaseResponse(input);
+                continue;
+            }
+
+            FLEXIMG_METRICS_SCOPE(NodeType::Composite);
+
+            // 上流のバッファをblendFrom
+            if (input.hasBuffer()) {
+                const ImageBuffer &inputBuf = input.buffer();
+                compositeBuf->blendFrom(inputBuf);
+
+                // 書き込んだ範囲の不透明区間を記録
+                if (scanOpaque) {
+                    auto start = std::max<int_fast16_t>(inputBuf.startX() - compositeBuf->startX(), 0);
+                    auto end   = std::min<int_fast16_t>(inputBuf.endX() - compositeBuf->startX(), hintWidth);
+                    if (end - start >= CompositeOpaqueSpans::MIN_WIDTH) {
+                        opaque.scan(compositeRow, start, end);
+                    }
+                }
+            }
 
-        context_->releaseResponse(input);
+            ctx->releaseResponse(input);
+        }
     }
 
     resp.origin = compositeOrigin;
     return resp;
 }
 
+// ============================================================================
+// CompositeNode - アクティブリスト
+// ============================================================================
+
+// 入力のY範囲を行帯（バケット）に振り分ける
+// 各バケットは掛かる入力のポート番号をポート順に保持する（CSR形式）
+void CompositeNode::buildActiveList()
+{
+    activeInputs_.clear();
+    bucketOffsets_.clear();
+    bucketInputs_.clear();
+    bucketRows_ = 0;
+
+    int32_t minTop = 0, maxBottom = 0;
+    for (size_t i = 0; i < inputSpans_.size(); ++i) {
+        const InputSpan &span = inputSpans_[i];
+        if (span.top >= span.bottom) continue;
+        if (activeInputs_.empty() || span.top < minTop) minTop = span.top;
+        if (activeInputs_.empty() || span.bottom > maxBottom) maxBottom = span.bottom;
+        activeInputs_.push_back(static_cast<uint16_t>(i));
+    }
+    if (activeInputs_.empty()) return;
+
+    // バケット数が上限以下になる最小の行帯高さ（2のべき）
+    bucketTop_   = minTop;
+    bucketRows_  = maxBottom - minTop;
+    bucketShift_ = 0;
+    while (((bucketRows_ - 1) >> bucketShift_) >= MAX_ACTIVE_BUCKETS) {
+        ++bucketShift_;
+    }
+    auto bucketCount = static_cast<size_t>(((bucketRows_ - 1) >> bucketShift_) + 1);
+
+    // 1パス目: バケットごとの入力数を数え、累積して各バケットの終端位置にする
+    bucketOffsets_.assign(bucketCount + 1, 0);
+    for (uint16_t index : activeInputs_) {
+        const InputSpan &span = inputSpans_[index];
+        auto b0               = static_cast<size_t>((span.top - bucketTop_) >> bucketShift_);
+        auto b1               = static_cast<size_t>((span.bottom - 1 - bucketTop_) >> bucketShift_);
+        for (size_t b = b0; b <= b1; ++b) {
+            ++bucketOffsets_[b];
+        }
+    }
+    for (size_t b = 1; b < bucketCount; ++b) {
+        bucketOffsets_[b] += bucketOffsets_[b - 1];
+    }
+    bucketOffsets_[bucketCount] = bucketOffsets_[bucketCount - 1];
+    bucketInputs_.resize(bucketOffsets_[bucketCount]);
+
+    // 2パス目: 逆順に後ろから詰めて各バケット内をポート順に保つ（終了後は各バケットの開始位置）
+    for (auto it = activeInputs_.rbegin(); it != activeInputs_.rend(); ++it) {
+        const InputSpan &span = inputSpans_[*it];
+        auto b0               = static_cast<size_t>((span.top - bucketTop_) >> bucketShift_);
+        auto b1               = static_cast<size_t>((span.bottom - 1 - bucketTop_) >> bucketShift_);
+        for (size_t b = b0; b <= b1; ++b) {
+            bucketInputs_[--bucketOffsets_[b]] = *it;
+        }
+    }
+}
+
+void CompositeNode::activeInputsFor(const RenderRequest &request, const uint16_t *&first,
+                                    const uint16_t *&last) const
+{
+    first = last = nullptr;
+    if (bucketRows_ <= 0) return;
+
+    int32_t y0 = from_fixed_floor(request.origin.y) - bucketTop_;
+    int32_t y1 = y0 + request.height;
+    if (y1 <= 0 || y0 >= bucketRows_) return;
+
+    // 複数の行帯に跨る要求（ストリップ等）はデータを持つ全入力
+    int32_t b0 = std::max<int32_t>(y0, 0) >> bucketShift_;
+    int32_t b1 = (std::min<int32_t>(y1, bucketRows_) - 1) >> bucketShift_;
+    if (b0 != b1) {
+        first = activeInputs_.data();
+        last  = first + activeInputs_.size();
+        return;
+    }
+    first = bucketInputs_.data() + bucketOffsets_[static_cast<size_t>(b0)];
+    last  = bucketInputs_.data() + bucketOffsets_[static_cast<size_t>(b0) + 1];
+}
+
 }  // namespace FLEXIMG_NAMESPACE
@@ -12,6 +12,10 @@ namespace FLEXIMG_NAMESPACE {
 
 RenderResponse &FilterNodeBase::onPullProcess(const RenderRequest &request)
 {
+    if (!compiledKernels_.empty()) {
+        return pullCompiled(request);
+    }
+
     Node *upstream = upstreamNode(0);
     if (!upstream) return makeEmptyResponse(request.origin);
 
@@ -32,19 +36,127 @@ RenderResponse &FilterNodeBase::onPullProcess(const RenderRequest &request)
     return process(input, request);
 }
 
+DataRange FilterNodeBase::getDataRange(const RenderRequest &request) const
+{
+    if (!compiledKernels_.empty()) {
+        // ラインカーネルはデータ範囲を変えないため、中間ノードを飛ばして問い合わせる
+        return compiledSource_ ? compiledSource_->getDataRange(request) : DataRange{0, 0};
+    }
+    return Node::getDataRange(request);
+}
+
+void FilterNodeBase::getDataSpans(const RenderRequest &request, DataRangeList &out) const
+{
+    if (!compiledKernels_.empty()) {
+        if (compiledSource_) compiledSource_->getDataSpans(request, out);
+        return;
+    }
+    Node *upstream = upstreamNode(0);
+    if (upstream && computeInputMargin() == 0) {
+        upstream->getDataSpans(request, out);
+        return;
+    }
+    out.add(getDataRange(request));
+}
+
+// ============================================================================
+// FilterNodeBase - フィルタ列の融合
+// ============================================================================
+
+bool FilterNodeBase::getLineKernel(filters::LineKernel &kernel) const
+{
+    if (computeInputMargin() != 0) return false;
+    kernel.func     = getFilterFunc();
+    kernel.params   = &params_;
+    kernel.nodeType = nodeTypeForMetrics();
+    return kernel.func != nullptr;
+}
+
+void FilterNodeBase::prepare(const RenderRequest &screenInfo)
+{
+    (void)screenInfo;
+    compiledKernels_.clear();
+    compiledSource_ = nullptr;
+
+    RenderContext *ctx = context();
+    if (!ctx || !ctx->isFilterFusionEnabled()) return;
+
+    // 自身から上流へ、融合可能なノードが続く限り辿る
+    // 注: 上流はこの時点でprepare済み（Node::onPullPrepareは上流の後にprepareを呼ぶ）
+    filters::LineKernel kernel;
+    if (!getLineKernel(kernel)) return;
+
+    // 下流も融合可能なら自身は列の途中（カーネル列は末尾のノードだけが持つ）
+    filters::LineKernel downstreamKernel;
+    Node *downstream = downstreamNode(0);
+    if (downstream && downstream->upstreamNode(0) == this && downstream->getLineKernel(downstreamKernel)) return;
+    compiledKernels_.push_back(kernel);
+
+    Node *node = upstreamNode(0);
+    while (node && node->getLineKernel(kernel)) {
+        compiledKernels_.push_back(kernel);
+        node = node->upstreamNode(0);
+    }
+
+    // 単独ノードは通常経路と同じため、コンパイルしない
+    if (compiledKernels_.size() < 2) {
+        compiledKernels_.clear();
+        return;
+    }
+    std::reverse(compiledKernels_.begin(), compiledKernels_.end());
+    compiledSource_ = node;
+}
+
+void FilterNodeBase::finalize()
+{
+    // 差分prepareで次フレームに持ち越す場合はカーネル列を保持
+    if (keepsPreparedState()) return;
+    compiledKernels_.clear();
+    compiledSource_ = nullptr;
+}
+
+RenderResponse &FilterNodeBase::pullCompiled(const RenderRequest &request)
+{
+    if (!compiledSource_) return makeEmptyResponse(request.origin);
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    // ピクセル効率計測（マージン0のため要求 = 使用）
+    for (const auto &kernel : compiledKernels_) {
+        auto &metrics = PerfMetrics::instance().nodes[kernel.nodeType];
+        metrics.requestedPixels += static_cast<uint64_t>(request.width) * static_cast<uint64_t>(request.height);
+        metrics.usedPixels += static_cast<uint64_t>(request.width) * static_cast<uint64_t>(request.height);
+    }
+#endif
+
+    RenderResponse &input = compiledSource_->pullProcess(request);
+    if (!input.isValid()) return input;
+
+    // フォーマット変換は列の先頭で1回だけ
+    consolidateIfNeeded(input, PixelFormatIDs::RGBA8_Straight);
+
+    ViewPort workingView = input.buffer().view();
+    for (const auto &kernel : compiledKernels_) {
+        FLEXIMG_METRICS_SCOPE(kernel.nodeType);
+        for (int y = 0; y < workingView.height; ++y) {
+            kernel.func(static_cast<uint8_t *>(workingView.pixelAt(0, y)), workingView.width, *kernel.params);
+        }
+    }
+    return input;
+}
+
 // ============================================================================
 // FilterNodeBase - process() 共通実装
 // ============================================================================
 //
-// スキャンライン必須仕様（height=1）前提の共通処理:
+// スキャンライン・ストリップ共通の処理:
 // 1. RGBA8_Straight形式に変換
-// 2. ラインフィルタ関数を適用
+// 2. ラインフィルタ関数を各行に適用
 // 3. パフォーマンス計測（デバッグビルド時）
 //
 
 RenderResponse &FilterNodeBase::process(RenderResponse &input, const RenderRequest &request)
 {
-    (void)request;  // スキャンライン必須仕様では未使用
+    (void)request;  // 処理範囲は入力バッファで決まるため未使用
     FLEXIMG_METRICS_SCOPE(nodeTypeForMetrics());
 
     // フォーマット変換を実行（メトリクス記録付き）
@@ -54,10 +166,12 @@ RenderResponse &FilterNodeBase::process(RenderResponse &input, const RenderReque
     ImageBuffer &working = input.buffer();
     ViewPort workingView = working.view();
 
-    // ラインフィルタを適用（height=1前提）
-    // ViewPortのx,yオフセットを考慮してpixelAt(0,0)を使用
-    uint8_t *row = static_cast<uint8_t *>(workingView.pixelAt(0, 0));
-    getFilterFunc()(row, workingView.width, params_);
+    // ラインフィルタを各行に適用（スキャンライン時は1行）
+    // ViewPortのx,yオフセットを考慮してpixelAt(0,y)を使用
+    filters::LineFilterFunc func = getFilterFunc();
+    for (int y = 0; y < workingView.height; ++y) {
+        func(static_cast<uint8_t *>(workingView.pixelAt(0, y)), workingView.width, params_);
+    }
 
     // inputをそのまま返す（借用元への変更が反映される）
     return input;
@@ -0,0 +1,555 @@
+/**
+ * @file gaussian_blur_node.inl
+ * @brief GaussianBlurNode 実装
+ * @see src/fleximg/nodes/gaussian_blur_node.h
+ */
+
+namespace FLEXIMG_NAMESPACE {
+
+// 差分タップの係数（(1 - z^-K)^3 の展開、タップ間隔K）
+static constexpr int32_t kGaussianCombWeights[4] = {1, -3, 3, -1};
+
+// ========================================
+// パラメータ設定
+// ========================================
+
+void GaussianBlurNode::setSigma(float sigma)
+{
+    sigma_ = (sigma < 0.0f) ? 0.0f : (sigma > kMaxSigma) ? kMaxSigma : sigma;
+    // ボックス3回の分散 r² + r が sigma² に最も近い半径
+    auto radius = static_cast<int_fast16_t>((std::sqrt(4.0f * sigma_ * sigma_ + 1.0f) - 1.0f) * 0.5f + 0.5f);
+    radius_     = static_cast<int16_t>((radius > kMaxRadius) ? kMaxRadius : radius);
+    markDirty();
+}
+
+// ========================================
+// 終了処理
+// ========================================
+
+void GaussianBlurNode::finalize()
+{
+    // 差分prepareで次フレームに持ち越す場合: 確保済みの状態は保持し、累積のみ戻す
+    if (keepsPreparedState()) {
+        resetState(state_);
+        for (auto &state : workerStates_) {
+            resetState(state);
+        }
+        return;
+    }
+
+    state_.clear();
+    workerStates_.clear();
+    pushRows_.clear();
+
+    // getDataRangeキャッシュをリセット
+    rangeCache_.invalidate();
+}
+
+// ========================================
+// getDataRange 実装
+// ========================================
+
+DataRange GaussianBlurNode::getDataRange(const RenderRequest &request) const
+{
+    Node *upstream = upstreamNode(0);
+    if (!upstream) {
+        return DataRange();
+    }
+
+    // radius=0の場合は上流をそのまま返す
+    if (radius_ == 0) {
+        return upstream->getDataRange(request);
+    }
+
+    // キャッシュチェック（ワーカー単位）
+    DataRange cached;
+    if (rangeCache_.tryGet(request, cached)) {
+        return cached;
+    }
+
+    // 出力行Yに対して入力行 Y-margin から Y+margin の、左右に margin 拡張した範囲の和集合
+    int_fast16_t m = margin();
+    RenderRequest rowRequest;
+    rowRequest.width    = static_cast<int16_t>(request.width + m * 2);
+    rowRequest.height   = 1;
+    rowRequest.origin.x = request.origin.x - to_fixed(static_cast<int>(m));
+    int_fast16_t startX = INT16_MAX;
+    int_fast16_t endX   = INT16_MIN;
+    for (auto dy = static_cast<int_fast16_t>(-m); dy <= m; ++dy) {
+        rowRequest.origin.y = request.origin.y + to_fixed(static_cast<int>(dy));
+        DataRange rowRange  = upstream->getDataRange(rowRequest);
+        if (rowRange.hasData()) {
+            if (rowRange.startX < startX) startX = rowRange.startX;
+            if (rowRange.endX > endX) endX = rowRange.endX;
+        }
+    }
+
+    // rowRequest座標系 → request座標系（-m）、ぼかしによる両側拡張（-m / +m）
+    DataRange result{0, 0};
+    if (startX < endX) {
+        startX = std::max<int_fast16_t>(0, startX - m * 2);
+        endX   = std::min<int_fast16_t>(request.width, endX);
+        if (startX < endX) {
+            result = DataRange{static_cast<int16_t>(startX), static_cast<int16_t>(endX)};
+        }
+    }
+
+    // キャッシュに保存
+    rangeCache_.set(request, result);
+    return result;
+}
+
+// ========================================
+// Template Method フック
+// ========================================
+
+PrepareResponse GaussianBlurNode::onPullPrepare(const PrepareRequest &request)
+{
+    // 上流へ伝播
+    Node *upstream = upstreamNode(0);
+    if (!upstream) {
+        // 上流なし: サイズ0を返す
+        PrepareResponse result;
+        result.status = PrepareStatus::Prepared;
+        return result;
+    }
+
+    PrepareResponse upstreamResult = upstream->pullPrepare(request);
+    if (!upstreamResult.ok()) {
+        return upstreamResult;
+    }
+
+    // radius=0の場合はパススルー（状態不要）
+    if (radius_ == 0) {
+        return upstreamResult;
+    }
+
+    // 上流AABBを左右に margin 拡張した範囲を状態の列とする
+    int_fast16_t m = margin();
+    cacheOriginX_  = upstreamResult.origin.x - to_fixed(static_cast<int>(m));
+    initializeState(state_, upstreamResult.width + m * 2);
+    cacheWidth_ = static_cast<int16_t>(upstreamResult.width + m * 2);
+
+    // バンド並列用のワーカー別状態（各ワーカーが初回使用時に確保）
+    // ここで要素数を確定させ、process中はワーカーが自分の要素のみ触る
+    workerStates_.clear();
+    workerStates_.resize(static_cast<size_t>(RenderContext::MAX_WORKERS - 1));
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    // 累積和3段 × RGBA（uint64）
+    size_t stateBytes = static_cast<size_t>(cacheWidth_) * 4 * 3 * sizeof(uint64_t);
+    PerfMetrics::instance().nodes[NodeType::GaussianBlur].recordAlloc(stateBytes, cacheWidth_, 3);
+#endif
+
+    // AABBを上下左右に margin 拡張
+    upstreamResult.width    = cacheWidth_;
+    upstreamResult.height   = static_cast<int16_t>(upstreamResult.height + m * 2);
+    upstreamResult.origin.x = cacheOriginX_;
+    upstreamResult.origin.y = upstreamResult.origin.y - to_fixed(static_cast<int>(m));
+
+    return upstreamResult;
+}
+
+PrepareResponse GaussianBlurNode::onPushPrepare(const PrepareRequest &request)
+{
+    // 入力行を順に累積して出力するため、バンド並列は不可
+    if (context_) {
+        context_->requireSequential();
+    }
+
+    // 下流へ先に伝播してサイズ情報を取得
+    Node *downstream = downstreamNode(0);
+    PrepareResponse downstreamResult;
+    if (downstream) {
+        downstreamResult = downstream->pushPrepare(request);
+        if (!downstreamResult.ok()) {
+            return downstreamResult;
+        }
+    } else {
+        // 下流なし: 有効なデータがないのでサイズ0を返す
+        downstreamResult.status = PrepareStatus::Prepared;
+        return downstreamResult;
+    }
+
+    // radius=0の場合はスルー
+    if (radius_ == 0) {
+        return downstreamResult;
+    }
+
+    // push用状態を初期化（下流から取得したサイズを使用、出力サイズ = 入力サイズ）
+    cacheOriginX_ = downstreamResult.origin.x;
+    initializeState(state_, downstreamResult.width);
+    cacheWidth_       = downstreamResult.width;
+    pushInputY_       = 0;
+    pushOutputY_      = 0;
+    pushOutputHeight_ = downstreamResult.height;
+    lastInputOriginY_ = downstreamResult.origin.y;
+
+    // 差分タップ用の入力行リング
+    size_t ringRows = static_cast<size_t>(kernelSize() * 3);
+    pushRows_.resize(ringRows);
+    core::memory::IAllocator *alloc = persistentAllocator();
+    for (size_t i = 0; i < ringRows; i++) {
+        pushRows_[i] = ImageBuffer(cacheWidth_, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero, alloc);
+    }
+
+    return downstreamResult;
+}
+
+void GaussianBlurNode::onPushProcess(RenderResponse &input, const RenderRequest &request)
+{
+    // radius=0の場合はスルー
+    if (radius_ == 0) {
+        Node *downstream = downstreamNode(0);
+        if (downstream) {
+            downstream->pushProcess(input, request);
+        }
+        return;
+    }
+
+    if (!input.isValid()) {
+        pushInputRow(nullptr, 0);
+    } else {
+        consolidateIfNeeded(input);
+        ImageBuffer converted = convertFormat(ImageBuffer(input.buffer()), PixelFormatIDs::RGBA8_Straight);
+        auto xOffset          = static_cast<int_fast16_t>(from_fixed(input.origin.x - cacheOriginX_));
+        pushInputRow(&converted, xOffset);
+    }
+    lastInputOriginY_ = input.origin.y;
+
+    // 入力行 n の累積で出力行 n - margin が確定する
+    if (pushInputY_ > margin() && pushOutputY_ < pushOutputHeight_) {
+        emitPushRow();
+    }
+}
+
+void GaussianBlurNode::onPushFinalize()
+{
+    if (radius_ != 0) {
+        // 残りの行を出力（下端はゼロパディング扱い）
+        while (pushOutputY_ < pushOutputHeight_) {
+            pushInputRow(nullptr, 0);
+            lastInputOriginY_ += to_fixed(1);
+            if (pushInputY_ > margin()) {
+                emitPushRow();
+            }
+        }
+    }
+
+    // デフォルト動作: 下流へ伝播し、finalize()を呼び出す
+    Node *downstream = downstreamNode(0);
+    if (downstream) {
+        downstream->pushFinalize();
+    }
+    finalize();
+}
+
+RenderResponse &GaussianBlurNode::onPullProcess(const RenderRequest &request)
+{
+    Node *upstream = upstreamNode(0);
+    if (!upstream) return makeEmptyResponse(request.origin);
+
+    // radius=0の場合は処理をスキップしてスルー出力
+    if (radius_ == 0) {
+        return upstream->pullProcess(request);
+    }
+
+    // 有効範囲を先に判定（空の行では累積を進めない。次の要求行で追い付くか作り直す）
+    DataRange range = getDataRange(request);
+    if (!range.hasData()) {
+        return makeEmptyResponse(request.origin);
+    }
+
+    // 状態の列に対する出力範囲（SourceNodeと同じ丸め方式）
+    auto reqOffset = static_cast<int_fast16_t>(from_fixed_floor(request.origin.x - cacheOriginX_));
+    auto begin     = std::max<int_fast16_t>(0, reqOffset + range.startX);
+    auto end       = std::min<int_fast16_t>(cacheWidth_, reqOffset + range.endX);
+    if (begin >= end) {
+        return makeEmptyResponse(request.origin);
+    }
+
+    // 累積状態を要求行まで進める（内部で上流をpullするため、計測はこの後から開始）
+    BlurState &state = pullState();
+    advanceState(state, upstream, static_cast<int32_t>(from_fixed(request.origin.y)));
+
+    FLEXIMG_METRICS_SCOPE(NodeType::GaussianBlur);
+
+    auto outputWidth = static_cast<int16_t>(end - begin);
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    auto &metrics = PerfMetrics::instance().nodes[NodeType::GaussianBlur];
+    metrics.requestedPixels += static_cast<uint64_t>(request.width) * 1;
+    metrics.usedPixels += static_cast<uint64_t>(outputWidth) * 1;
+#endif
+
+    ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized, allocator());
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    metrics.recordAlloc(output.totalBytes(), output.width(), output.height());
+#endif
+
+    normalizeRow(static_cast<uint8_t *>(output.view().data), state.sum3.data(), begin, end);
+
+    Point outputOrigin;
+    outputOrigin.x = cacheOriginX_ + to_fixed(static_cast<int>(begin));
+    outputOrigin.y = request.origin.y;
+
+    return makeResponse(std::move(output), outputOrigin);
+}
+
+// ========================================
+// 垂直方向の累積
+// ========================================
+
+void GaussianBlurNode::advanceState(BlurState &state, Node *upstream, int32_t outputY)
+{
+    int_fast16_t ks = kernelSize();
+    int_fast16_t m  = margin();
+    // 出力行 outputY の合計は入力行 outputY + margin までの累積で確定する
+    int32_t target = outputY + static_cast<int32_t>(m);
+
+    // 後退、または作り直し（2 * margin + 1 行）より遠い前進では状態を作り直す
+    if (state.ready) {
+        int32_t jump = target - state.currentY;
+        if (jump < 0 || jump > m * 2 + 1) {
+            resetState(state);
+        }
+    }
+
+    // 出力行の影響範囲は outputY - margin から。それより上の入力行はゼロとみなして累積を開始する
+    if (!state.ready) {
+        state.windowStart = outputY - static_cast<int32_t>(m);
+        state.currentY    = state.windowStart - 1;
+        state.ready       = true;
+    }
+
+    while (state.currentY < target) {
+        int32_t n = ++state.currentY;
+        for (int_fast16_t tap = 0; tap < 4; tap++) {
+            int32_t srcY = n - static_cast<int32_t>(ks * tap);
+            if (srcY < state.windowStart) break;
+            accumulateUpstreamRow(state, upstream, srcY, kGaussianCombWeights[tap]);
+        }
+        integrateState(state);
+    }
+}
+
+void GaussianBlurNode::accumulateUpstreamRow(BlurState &state, Node *upstream, int32_t srcY, int32_t weight)
+{
+    // 状態の幅・原点でリクエスト作成
+    RenderRequest upstreamReq;
+    upstreamReq.width    = cacheWidth_;
+    upstreamReq.height   = 1;
+    upstreamReq.origin.x = cacheOriginX_;
+    upstreamReq.origin.y = to_fixed(srcY);
+
+    if (!upstream->getDataRange(upstreamReq).hasData()) {
+        return;
+    }
+
+    RenderContext *ctx     = context();
+    RenderResponse &result = upstream->pullProcess(upstreamReq);
+    if (!result.isValid()) {
+        ctx->releaseResponse(result);
+        return;
+    }
+
+    // バッファ準備
+    consolidateIfNeeded(result);
+
+    ImageBuffer converted = convertFormat(ImageBuffer(result.buffer()), PixelFormatIDs::RGBA8_Straight);
+    ViewPort srcView      = converted.view();
+
+    // 入力バッファ左端 - 状態の列0（VerticalBlurNodeの行キャッシュと同じ配置）
+    auto srcOffsetX = static_cast<int_fast16_t>(from_fixed(result.origin.x - cacheOriginX_));
+    auto dstStartX  = std::max<int_fast16_t>(0, srcOffsetX);
+    auto srcStartX  = std::max<int_fast16_t>(0, -srcOffsetX);
+    auto count = std::min<int_fast16_t>(static_cast<int_fast16_t>(srcView.width) - srcStartX, cacheWidth_ - dstStartX);
+    if (count > 0) {
+        accumulateRow(state, static_cast<const uint8_t *>(srcView.data) + srcStartX * 4, dstStartX, count, weight);
+    }
+
+    // 状態へ加算済みのため上流Responseを返却（プール枯渇防止）
+    ctx->releaseResponse(result);
+}
+
+void GaussianBlurNode::accumulateRow(BlurState &state, const uint8_t *row, int_fast16_t offset, int_fast16_t count,
+                                     int32_t weight)
+{
+    // 符号付きの値を uint64 の剰余演算で加算（累積後の合計は非負で uint64 に収まる）
+    uint64_t *sum = state.sum1.data() + offset * 4;
+    for (int_fast16_t x = 0; x < count; x++, row += 4, sum += 4) {
+        int32_t a = row[3] * weight;
+        sum[0] += static_cast<uint64_t>(static_cast<int64_t>(row[0] * a));
+        sum[1] += static_cast<uint64_t>(static_cast<int64_t>(row[1] * a));
+        sum[2] += static_cast<uint64_t>(static_cast<int64_t>(row[2] * a));
+        sum[3] += static_cast<uint64_t>(static_cast<int64_t>(a));
+    }
+}
+
+void GaussianBlurNode::integrateState(BlurState &state)
+{
+    uint64_t *s1 = state.sum1.data();
+    uint64_t *s2 = state.sum2.data();
+    uint64_t *s3 = state.sum3.data();
+    size_t count = state.sum1.size();
+    for (size_t i = 0; i < count; i++) {
+        s2[i] += s1[i];
+        s3[i] += s2[i];
+    }
+}
+
+// ========================================
+// 水平方向の累積と正規化
+// ========================================
+
+void GaussianBlurNode::normalizeRow(uint8_t *dst, const uint64_t *sum, int_fast16_t begin, int_fast16_t end) const
+{
+    static const uint64_t zero[4] = {0, 0, 0, 0};
+    int_fast16_t ks = kernelSize();
+    int_fast16_t m  = margin();
+    // 出力 [begin, end) の影響範囲外の列はゼロとみなす（結果は変わらない）
+    int_fast16_t lo = std::max<int_fast16_t>(0, begin - m);
+    int_fast16_t hi = std::min<int_fast16_t>(cacheWidth_, end + m);
+    auto tap        = [&](int_fast16_t x) { return (x >= lo && x < hi) ? sum + x * 4 : zero; };
+
+    // 2次元の重みの合計 K^6（アルファの正規化用）
+    uint64_t area = static_cast<uint64_t>(ks) * static_cast<uint64_t>(ks) * static_cast<uint64_t>(ks);
+    area *= area;
+
+    uint64_t h1[4] = {0, 0, 0, 0};
+    uint64_t h2[4] = {0, 0, 0, 0};
+    uint64_t h3[4] = {0, 0, 0, 0};
+    for (int_fast16_t n = lo; n < end + m; n++) {
+        const uint64_t *p0 = tap(n);
+        const uint64_t *p1 = tap(n - ks);
+        const uint64_t *p2 = tap(n - ks * 2);
+        const uint64_t *p3 = tap(n - ks * 3);
+        for (int c = 0; c < 4; c++) {
+            h1[c] += p0[c] - 3 * p1[c] + 3 * p2[c] - p3[c];
+            h2[c] += h1[c];
+            h3[c] += h2[c];
+        }
+
+        // 入力列 n の累積で出力列 n - margin が確定する
+        int_fast16_t x = n - m;
+        if (x < begin) continue;
+        uint8_t *d = dst + (x - begin) * 4;
+        uint64_t a = h3[3];
+        if (a == 0) {
+            d[0] = d[1] = d[2] = d[3] = 0;
+            continue;
+        }
+        d[0] = static_cast<uint8_t>(h3[0] / a);
+        d[1] = static_cast<uint8_t>(h3[1] / a);
+        d[2] = static_cast<uint8_t>(h3[2] / a);
+        d[3] = static_cast<uint8_t>(a / area);
+    }
+}
+
+// ========================================
+// 状態管理
+// ========================================
+
+void GaussianBlurNode::initializeState(BlurState &state, int_fast16_t width)
+{
+    size_t count = static_cast<size_t>(width) * 4;
+    state.sum1.assign(count, 0);
+    state.sum2.assign(count, 0);
+    state.sum3.assign(count, 0);
+    state.currentY    = 0;
+    state.windowStart = 0;
+    state.ready       = false;
+}
+
+void GaussianBlurNode::resetState(BlurState &state)
+{
+    std::fill(state.sum1.begin(), state.sum1.end(), 0u);
+    std::fill(state.sum2.begin(), state.sum2.end(), 0u);
+    std::fill(state.sum3.begin(), state.sum3.end(), 0u);
+    state.ready = false;
+}
+
+GaussianBlurNode::BlurState &GaussianBlurNode::pullState()
+{
+    auto worker = RenderContext::currentWorkerIndex();
+    if (worker == 0) {
+        return state_;
+    }
+    // ワーカー1以降: 初回使用時に確保
+    BlurState &state = workerStates_[static_cast<size_t>(worker - 1)];
+    if (state.sum1.empty()) {
+        initializeState(state, cacheWidth_);
+    }
+    return state;
+}
+
+// ========================================
+// push型用ヘルパー関数
+// ========================================
+
+void GaussianBlurNode::pushInputRow(const ImageBuffer *input, int_fast16_t xOffset)
+{
+    int_fast16_t ks = kernelSize();
+    auto ringRows   = static_cast<int32_t>(ks * 3);
+    int32_t n       = pushInputY_;
+    auto rowAt      = [&](int32_t y) {
+        return static_cast<const uint8_t *>(pushRows_[static_cast<size_t>(y % ringRows)].view().data);
+    };
+
+    // リングの同じスロットにある 3K 行前の入力行（係数 -1）を、上書き前に累積
+    if (n >= ringRows) {
+        accumulateRow(state_, rowAt(n), 0, cacheWidth_, kGaussianCombWeights[3]);
+    }
+
+    // 入力行をリングに格納（範囲外・無効行はゼロ）
+    uint8_t *dstData = static_cast<uint8_t *>(pushRows_[static_cast<size_t>(n % ringRows)].view().data);
+    std::memset(dstData, 0, static_cast<size_t>(cacheWidth_) * 4);
+    if (input) {
+        ViewPort srcView       = input->view();
+        int_fast16_t dstStart  = std::max<int_fast16_t>(0, xOffset);
+        int_fast16_t srcStart  = std::max<int_fast16_t>(0, -xOffset);
+        int_fast16_t copyWidth = std::min<int_fast16_t>(static_cast<int_fast16_t>(srcView.width) - srcStart,
+                                                        cacheWidth_ - dstStart);
+        if (copyWidth > 0) {
+            std::memcpy(dstData + dstStart * 4, static_cast<const uint8_t *>(srcView.data) + srcStart * 4,
+                        static_cast<size_t>(copyWidth) * 4);
+            accumulateRow(state_, dstData + dstStart * 4, dstStart, copyWidth, kGaussianCombWeights[0]);
+        }
+    }
+
+    // K, 2K 行前の入力行（入力開始前の行はゼロ）
+    if (n >= ks) {
+        accumulateRow(state_, rowAt(n - static_cast<int32_t>(ks)), 0, cacheWidth_, kGaussianCombWeights[1]);
+    }
+    if (n >= ks * 2) {
+        accumulateRow(state_, rowAt(n - static_cast<int32_t>(ks * 2)), 0, cacheWidth_, kGaussianCombWeights[2]);
+    }
+
+    integrateState(state_);
+    pushInputY_++;
+}
+
+void GaussianBlurNode::emitPushRow()
+{
+    ImageBuffer output(cacheWidth_, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized, allocator());
+    normalizeRow(static_cast<uint8_t *>(output.view().data), state_.sum3.data(), 0, cacheWidth_);
+
+    // 出力行のorigin.yは、最後に受信した入力行との差分を減算して求める
+    int32_t rowDiff = (pushInputY_ - 1) - pushOutputY_;
+    RenderRequest outReq;
+    outReq.width    = cacheWidth_;
+    outReq.height   = 1;
+    outReq.origin.x = cacheOriginX_;
+    outReq.origin.y = lastInputOriginY_ - to_fixed(rowDiff);
+
+    pushOutputY_++;
+
+    Node *downstream = downstreamNode(0);
+    if (downstream) {
+        RenderResponse &resp = makeResponse(std::move(output), outReq.origin);
+        downstream->pushProcess(resp, outReq);
+    }
+}
+
+}  // namespace FLEXIMG_NAMESPACE
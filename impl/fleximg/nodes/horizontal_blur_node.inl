@@ -97,7 +97,7 @@ RenderResponse &HorizontalBlurNode::onPullProcess(const RenderRequest &request)
 #endif
 
         // 出力バッファを確保
-        ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized);
+        ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized, allocator());
 
         // 水平方向スライディングウィンドウでブラー処理
         // inputOffset = -radius (出力を左に拡張)
@@ -132,7 +132,7 @@ RenderResponse &HorizontalBlurNode::onPullProcess(const RenderRequest &request)
     // 出力バッファを確保（必要幅のみ、ゼロ初期化）
     // 出力バッファ左端のワールド座標 = リクエスト左端 + blurredStartX
     int_fixed outputOriginX = request.origin.x + to_fixed(blurredStartX);
-    ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+    ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero, allocator());
     const uint8_t *srcRow = static_cast<const uint8_t *>(buffer.view().data);
     uint8_t *dstRow       = static_cast<uint8_t *>(output.view().data);
 
@@ -188,7 +188,7 @@ void HorizontalBlurNode::onPushProcess(RenderResponse &input, const RenderReques
         auto outputWidth = static_cast<int_fast16_t>(inputWidth + radius_ * 2);
 
         // 出力バッファを確保
-        ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized);
+        ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized, allocator());
 
         // 水平方向スライディングウィンドウでブラー処理
         // push型では inputOffset = -radius
@@ -216,12 +216,14 @@ void HorizontalBlurNode::onPushProcess(RenderResponse &input, const RenderReques
 
 // 水平方向ブラー処理（共通）
 // inputOffset: 出力x=0に対応する入力のカーネル中心位置
+// スライディング合計をチャンク単位でSoA配列に貯め、filters::boxBlurNormalize で一括正規化する
 void HorizontalBlurNode::applyHorizontalBlur(const ViewPort &srcView, int_fast16_t inputOffset, ImageBuffer &output)
 {
     const uint8_t *srcRow = static_cast<const uint8_t *>(srcView.data);
     uint8_t *dstRow       = static_cast<uint8_t *>(output.view().data);
     auto inputWidth       = static_cast<int_fast16_t>(srcView.width);
     auto outputWidth      = static_cast<int_fast16_t>(output.width());
+    auto ks               = kernelSize();
 
     // 初期ウィンドウの合計（出力x=0に対応）
     uint32_t sumR = 0, sumG = 0, sumB = 0, sumA = 0;
@@ -237,33 +239,45 @@ void HorizontalBlurNode::applyHorizontalBlur(const ViewPort &srcView, int_fast16
             sumA += a;
         }
     }
-    writeBlurredPixel(dstRow, 0, sumR, sumG, sumB, sumA);
-
-    // スライディング: x = 1 to outputWidth-1
-    for (int_fast16_t x = 1; x < outputWidth; x++) {
-        // 出ていくピクセル
-        auto oldSrcX = static_cast<int_fast16_t>(inputOffset + x - 1 - radius_);
-        if (oldSrcX >= 0 && oldSrcX < inputWidth) {
-            auto off   = oldSrcX * 4;
-            uint32_t a = srcRow[off + 3];
-            sumR -= srcRow[off] * a;
-            sumG -= srcRow[off + 1] * a;
-            sumB -= srcRow[off + 2] * a;
-            sumA -= a;
-        }
 
-        // 入ってくるピクセル
-        auto newSrcX = static_cast<int_fast16_t>(inputOffset + x + radius_);
-        if (newSrcX >= 0 && newSrcX < inputWidth) {
-            auto off   = newSrcX * 4;
-            uint32_t a = srcRow[off + 3];
-            sumR += srcRow[off] * a;
-            sumG += srcRow[off + 1] * a;
-            sumB += srcRow[off + 2] * a;
-            sumA += a;
+    // チャンク単位の合計値（SoA）
+    constexpr int_fast16_t kChunk = 32;
+    uint32_t chunkR[kChunk], chunkG[kChunk], chunkB[kChunk], chunkA[kChunk];
+
+    for (int_fast16_t chunkX = 0; chunkX < outputWidth; chunkX += kChunk) {
+        auto n = std::min<int_fast16_t>(kChunk, static_cast<int_fast16_t>(outputWidth - chunkX));
+        for (int_fast16_t i = 0; i < n; i++) {
+            auto x = static_cast<int_fast16_t>(chunkX + i);
+            // スライディング: x = 1 to outputWidth-1
+            if (x > 0) {
+                // 出ていくピクセル
+                auto oldSrcX = static_cast<int_fast16_t>(inputOffset + x - 1 - radius_);
+                if (oldSrcX >= 0 && oldSrcX < inputWidth) {
+                    auto off   = oldSrcX * 4;
+                    uint32_t a = srcRow[off + 3];
+                    sumR -= srcRow[off] * a;
+                    sumG -= srcRow[off + 1] * a;
+                    sumB -= srcRow[off + 2] * a;
+                    sumA -= a;
+                }
+
+                // 入ってくるピクセル
+                auto newSrcX = static_cast<int_fast16_t>(inputOffset + x + radius_);
+                if (newSrcX >= 0 && newSrcX < inputWidth) {
+                    auto off   = newSrcX * 4;
+                    uint32_t a = srcRow[off + 3];
+                    sumR += srcRow[off] * a;
+                    sumG += srcRow[off + 1] * a;
+                    sumB += srcRow[off + 2] * a;
+                    sumA += a;
+                }
+            }
+            chunkR[i] = sumR;
+            chunkG[i] = sumG;
+            chunkB[i] = sumB;
+            chunkA[i] = sumA;
         }
-
-        writeBlurredPixel(dstRow, x, sumR, sumG, sumB, sumA);
+        filters::boxBlurNormalize(dstRow + chunkX * 4, chunkR, chunkG, chunkB, chunkA, n, ks);
     }
 }
 
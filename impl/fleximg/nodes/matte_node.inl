@@ -92,14 +92,15 @@ void MatteNode::onPullFinalize()
 
 DataRange MatteNode::calcUpstreamRanges(const RenderRequest &request) const
 {
-    Node *fgNode   = upstreamNode(0);
-    Node *bgNode   = upstreamNode(1);
-    Node *maskNode = upstreamNode(2);
+    Node *fgNode      = upstreamNode(0);
+    Node *bgNode      = upstreamNode(1);
+    Node *maskNode    = upstreamNode(2);
+    RangeCache &cache = workerRangeCache();
 
     // 各上流のデータ範囲を取得
-    rangeCache_.fgRange   = fgNode ? fgNode->getDataRange(request) : DataRange{};
-    rangeCache_.bgRange   = bgNode ? bgNode->getDataRange(request) : DataRange{};
-    rangeCache_.maskRange = maskNode ? maskNode->getDataRange(request) : DataRange{};
+    cache.fgRange   = fgNode ? fgNode->getDataRange(request) : DataRange{};
+    cache.bgRange   = bgNode ? bgNode->getDataRange(request) : DataRange{};
+    cache.maskRange = maskNode ? maskNode->getDataRange(request) : DataRange{};
 
     // 有効範囲を計算: bg ∪ (mask ∩ fg)
     // - bgは常に有効（マスク範囲外やalpha=0でbgが見える）
@@ -109,37 +110,68 @@ DataRange MatteNode::calcUpstreamRanges(const RenderRequest &request) const
     int16_t endX   = 0;
 
     // bg範囲は常に有効
-    if (rangeCache_.bgRange.hasData()) {
-        startX = rangeCache_.bgRange.startX;
-        endX   = rangeCache_.bgRange.endX;
+    if (cache.bgRange.hasData()) {
+        startX = cache.bgRange.startX;
+        endX   = cache.bgRange.endX;
     }
 
     // (mask ∩ fg)範囲を追加
-    if (rangeCache_.maskRange.hasData() && rangeCache_.fgRange.hasData()) {
-        int16_t intersectStart = std::max(rangeCache_.maskRange.startX, rangeCache_.fgRange.startX);
-        int16_t intersectEnd   = std::min(rangeCache_.maskRange.endX, rangeCache_.fgRange.endX);
+    if (cache.maskRange.hasData() && cache.fgRange.hasData()) {
+        int16_t intersectStart = std::max(cache.maskRange.startX, cache.fgRange.startX);
+        int16_t intersectEnd   = std::min(cache.maskRange.endX, cache.fgRange.endX);
         if (intersectStart < intersectEnd) {
             if (intersectStart < startX) startX = intersectStart;
             if (intersectEnd > endX) endX = intersectEnd;
         }
     }
 
-    rangeCache_.unionRange = (startX < endX) ? DataRange{startX, endX} : DataRange{};
-    rangeCache_.origin     = request.origin;
-    rangeCache_.valid      = true;
+    cache.unionRange = (startX < endX) ? DataRange{startX, endX} : DataRange{};
+    cache.origin     = request.origin;
+    cache.width      = request.width;
+    cache.valid      = true;
 
-    return rangeCache_.unionRange;
+    return cache.unionRange;
 }
 
 DataRange MatteNode::getDataRange(const RenderRequest &request) const
 {
-    // キャッシュが有効でoriginが一致すれば再利用
-    if (rangeCache_.valid && rangeCache_.origin.x == request.origin.x && rangeCache_.origin.y == request.origin.y) {
-        return rangeCache_.unionRange;
+    const RangeCache &cache = workerRangeCache();
+    // キャッシュが有効でリクエストが一致すれば再利用
+    if (rangeCacheMatches(cache, request)) {
+        return cache.unionRange;
     }
     return calcUpstreamRanges(request);
 }
 
+void MatteNode::getDataSpans(const RenderRequest &request, DataRangeList &out) const
+{
+    Node *fgNode   = upstreamNode(0);
+    Node *bgNode   = upstreamNode(1);
+    Node *maskNode = upstreamNode(2);
+
+    // bgは区間列のまま有効
+    if (bgNode) bgNode->getDataSpans(request, out);
+
+    // fgはマスク範囲と交差する部分のみ有効
+    DataRange maskRange = maskNode ? maskNode->getDataRange(request) : DataRange{};
+    if (!fgNode || !maskRange.hasData()) return;
+
+    RenderContext *ctx = context();
+    DataRange *storage = ctx ? ctx->acquireSegments(static_cast<int>(out.capacity)) : nullptr;
+    if (!storage) {
+        // 作業領域が確保できない場合は外接範囲で代用
+        DataRange fgRange = fgNode->getDataRange(request);
+        out.add(DataRange{std::max(fgRange.startX, maskRange.startX), std::min(fgRange.endX, maskRange.endX)});
+        return;
+    }
+    DataRangeList fgSpans(storage, out.capacity);
+    fgNode->getDataSpans(request, fgSpans);
+    for (int_fast16_t i = 0; i < fgSpans.count; ++i) {
+        const DataRange &span = fgSpans.spans[i];
+        out.add(DataRange{std::max(span.startX, maskRange.startX), std::min(span.endX, maskRange.endX)});
+    }
+}
+
 // ============================================================================
 // MatteNode - onPullProcess実装（最適化版）
 // ============================================================================
@@ -159,44 +191,47 @@ RenderResponse &MatteNode::onPullProcess(const RenderRequest &request)
     Node *bgNode   = upstreamNode(1);  // 背景
     Node *maskNode = upstreamNode(2);  // マスク
 
+    // ワーカー単位の範囲キャッシュ
+    RangeCache &cache = workerRangeCache();
+
     // ========================================================================
     // Step 1: mask取得・全面0判定
     // ========================================================================
 
     // キャッシュ確認・更新
-    if (!rangeCache_.valid || rangeCache_.origin.x != request.origin.x || rangeCache_.origin.y != request.origin.y) {
+    if (!rangeCacheMatches(cache, request)) {
         calcUpstreamRanges(request);
     }
 
     {
         // maskデータなし or maskNodeなし → bg fallback
-        if (!rangeCache_.maskRange.hasData()) goto fallback_bg;
+        if (!cache.maskRange.hasData()) goto fallback_bg;
         if (!maskNode) goto fallback_bg;
 
         // mask要求範囲をfg∪bgの有効X範囲に制限
         // fg/bgが存在しない領域のマスクは取得しても無駄
         int16_t fgBgStart = request.width;
         int16_t fgBgEnd   = 0;
-        if (rangeCache_.fgRange.hasData()) {
-            if (rangeCache_.fgRange.startX < fgBgStart) fgBgStart = rangeCache_.fgRange.startX;
-            if (rangeCache_.fgRange.endX > fgBgEnd) fgBgEnd = rangeCache_.fgRange.endX;
+        if (cache.fgRange.hasData()) {
+            if (cache.fgRange.startX < fgBgStart) fgBgStart = cache.fgRange.startX;
+            if (cache.fgRange.endX > fgBgEnd) fgBgEnd = cache.fgRange.endX;
         }
-        if (rangeCache_.bgRange.hasData()) {
-            if (rangeCache_.bgRange.startX < fgBgStart) fgBgStart = rangeCache_.bgRange.startX;
-            if (rangeCache_.bgRange.endX > fgBgEnd) fgBgEnd = rangeCache_.bgRange.endX;
+        if (cache.bgRange.hasData()) {
+            if (cache.bgRange.startX < fgBgStart) fgBgStart = cache.bgRange.startX;
+            if (cache.bgRange.endX > fgBgEnd) fgBgEnd = cache.bgRange.endX;
         }
 
         // fg∪bgが空 → マスク値に関わらず出力は透明
         if (fgBgStart >= fgBgEnd) {
-            rangeCache_.valid = false;
+            cache.valid = false;
             return makeEmptyResponse(request.origin);
         }
 
         // fg∪bgとmaskの交差範囲でmask要求を絞る
         RenderRequest maskRequest = request;
         {
-            int16_t clampStart = std::max(fgBgStart, rangeCache_.maskRange.startX);
-            int16_t clampEnd   = std::min(fgBgEnd, rangeCache_.maskRange.endX);
+            int16_t clampStart = std::max(fgBgStart, cache.maskRange.startX);
+            int16_t clampEnd   = std::min(fgBgEnd, cache.maskRange.endX);
             if (clampStart < clampEnd) {
                 maskRequest.origin.x = request.origin.x + to_fixed(clampStart);
                 maskRequest.width    = clampEnd - clampStart;
@@ -237,7 +272,7 @@ RenderResponse &MatteNode::onPullProcess(const RenderRequest &request)
         // ========================================================================
 
         RenderResponse *bgResultPtr = nullptr;
-        if (rangeCache_.bgRange.hasData() && bgNode) {
+        if (cache.bgRange.hasData() && bgNode) {
             RenderResponse &bgResult = bgNode->pullProcess(request);
             if (bgResult.isValid()) {
                 // バッファ準備
@@ -317,7 +352,7 @@ RenderResponse &MatteNode::onPullProcess(const RenderRequest &request)
         // ========================================================================
 
         RenderResponse *fgResultPtr = nullptr;
-        if (fgNode && rangeCache_.fgRange.hasData()) {
+        if (fgNode && cache.fgRange.hasData()) {
             RenderResponse &fgResult = fgNode->pullProcess(request);
             if (fgResult.isValid()) {
                 // バッファ準備
@@ -335,8 +370,7 @@ RenderResponse &MatteNode::onPullProcess(const RenderRequest &request)
         // ========================================================================
 
         // InputView::fromにはconst参照が必要なので、一時的なRenderResponseを使う
-        static RenderResponse emptyResult;
-        emptyResult.origin = Point{};
+        RenderResponse emptyResult;
 
         InputView fgView        = InputView::from(fgResultPtr ? *fgResultPtr : emptyResult, unionMinX, unionMinY);
         InputView maskInputView = InputView::from(maskResult, unionMinX, unionMinY);
@@ -344,14 +378,14 @@ RenderResponse &MatteNode::onPullProcess(const RenderRequest &request)
         applyMatteOverlay(outputBuf, unionWidth, fgView, maskInputView);
 
         // キャッシュ無効化
-        rangeCache_.valid = false;
+        cache.valid = false;
 
         return makeResponse(std::move(outputBuf), Point{unionMinX, unionMinY});
     }
 
     // bgフォールバック: mask無効時はbgを直接返却
 fallback_bg:
-    rangeCache_.valid = false;
+    cache.valid = false;
     if (bgNode) {
         return bgNode->pullProcess(request);
     }
@@ -156,7 +156,7 @@ RenderResponse &NinePatchSourceNode::onPullProcess(const RenderRequest &request)
 
         RenderResponse &patchResult = patches_[i].pullProcess(request);
         if (!patchResult.isValid()) {
-            context_->releaseResponse(patchResult);
+            context()->releaseResponse(patchResult);
             continue;
         }
 
@@ -169,7 +169,7 @@ RenderResponse &NinePatchSourceNode::onPullProcess(const RenderRequest &request)
                                  patchResult.origin.y);
 
         // 使い終わったRenderResponseをプールに返却
-        context_->releaseResponse(patchResult);
+        context()->releaseResponse(patchResult);
     }
 
     return makeResponse(std::move(canvasBuf), Point{canvasOriginX, canvasOriginY});
@@ -24,7 +24,11 @@ PrepareStatus RendererNode::execPrepare()
     }
 
     // コンテキストを設定（一括設定でループを1回に削減）
-    context_.setup(pipelineAllocator_, &entryPool_);
+    // アリーナのチャンクはパイプライン用アロケータから確保する
+    scanlineArena_.setBacking(pipelineAllocator_);
+    context_.setup(pipelineAllocator_, &entryPool_, useScanlineArena_ ? &scanlineArena_ : nullptr);
+    context_.setFilterFusionEnabled(filterFusion_);
+    context_.setIncrementalPrepareEnabled(incrementalPrepare_);
 
     // ========================================
     // Step 1: 下流へ準備を伝播（AABB取得用）
@@ -78,16 +82,121 @@ PrepareStatus RendererNode::execPrepare()
 
     // 上流情報は将来の最適化に活用
     (void)pullResult;
+    partialFrame_ = false;
+
+    // ========================================
+    // Step 4: ストリップ高さの決定
+    // ========================================
+    // 上流・下流の全ノードが対応している場合のみ複数行で処理
+    // （DataRange可視化はスキャンライン単位の範囲を前提とするため除外）
+    activeStripHeight_ = 1;
+    if (stripHeight_ > 1 && !debugDataRange_ && upstream->isPullStripCapable() && downstream->isPushStripCapable()) {
+        activeStripHeight_ = stripHeight_;
+    }
+
+    // ========================================
+    // Step 5: 差分描画の領域決定
+    // ========================================
+    updateDamage(upstream, downstream);
+
+    // ========================================
+    // Step 6: バンド並列実行の準備
+    // ========================================
+    setupWorkers();
 
     return PrepareStatus::Prepared;
 }
 
+void RendererNode::setupWorkers()
+{
+    bandCount_ = 1;
+    if (!executor_) return;
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    // PerfMetricsはスレッドセーフではないため、計測時は逐次実行
+    return;
+#endif
+
+    // 行順序に依存するノードがprepare時に逐次実行を要求した
+    if (context_.isSequentialRequired()) return;
+
+    auto workers = static_cast<int_fast16_t>(requestedWorkers_ > 0 ? requestedWorkers_ : executor_->concurrency());
+    workers      = std::min<int_fast16_t>(workers, RenderContext::MAX_WORKERS);
+    workers      = std::min<int_fast16_t>(workers, calcTileCountY());
+    if (workers <= 1) return;
+
+    // ワーカースロット確保（ワーカー0はメインのcontext_を使うため workers-1 個）
+    auto slotCount = static_cast<int_fast16_t>(workers - 1);
+    if (workerSlotCount_ < slotCount) {
+        workers_.reset(new WorkerSlot[static_cast<size_t>(slotCount)]);
+        workerSlotCount_ = static_cast<int16_t>(slotCount);
+    }
+    for (int_fast16_t i = 0; i < slotCount; ++i) {
+        auto workerIndex                = static_cast<int_fast16_t>(i + 1);
+        core::memory::IAllocator *alloc = workerAllocators_[workerIndex];
+        WorkerSlot &slot                = workerSlot(i);
+        if (!alloc) alloc = &core::memory::DefaultAllocator::instance();
+        slot.arena.setBacking(alloc);
+        slot.context.setup(alloc, &slot.entryPool, useScanlineArena_ ? &slot.arena : nullptr);
+        slot.context.setWorkerIndex(workerIndex);
+    }
+    bandCount_ = static_cast<int16_t>(workers);
+}
+
 void RendererNode::execProcess()
 {
-    auto tileCountX = calcTileCountX();
     auto tileCountY = calcTileCountY();
 
-    for (int_fast16_t ty = 0; ty < tileCountY; ++ty) {
+    lastBandCount_ = bandCount_;
+    if (bandCount_ <= 1 || !executor_) {
+        lastBandCount_ = 1;
+        processRows(0, tileCountY);
+        return;
+    }
+
+    // 各バンドを並列実行（バンドiはワーカーiのコンテキストで処理）
+    executor_->parallelFor(bandCount_, &RendererNode::bandTask, this);
+}
+
+void RendererNode::processBand(int_fast16_t bandIndex)
+{
+    // スキャンラインをバンド数で均等分割（余りは先頭側のバンドに配分）
+    auto tileCountY = calcTileCountY();
+    auto base       = static_cast<int_fast16_t>(tileCountY / bandCount_);
+    auto rem        = static_cast<int_fast16_t>(tileCountY % bandCount_);
+    auto tyBegin    = static_cast<int_fast16_t>(bandIndex * base + std::min(bandIndex, rem));
+    auto tyEnd      = static_cast<int_fast16_t>(tyBegin + base + (bandIndex < rem ? 1 : 0));
+
+    // ワーカー用コンテキストをこのスレッドにバインド
+    // （実行スレッドはexecutor次第のため、タスクごとに明示的にバインドする）
+    RenderContext *ctx  = (bandIndex == 0) ? &context_ : &workerSlot(bandIndex - 1).context;
+    RenderContext *prev = RenderContext::bindToCurrentThread(ctx);
+    processRows(tyBegin, tyEnd);
+    RenderContext::bindToCurrentThread(prev);
+}
+
+void RendererNode::processRows(int_fast16_t tyBegin, int_fast16_t tyEnd)
+{
+    auto tileCountX = calcTileCountX();
+
+    if (partialFrame_) {
+        // 差分描画: タイル行と交差するダメージ区間のみ、タイル幅ごとに処理
+        auto tw = effectiveTileWidth();
+        auto th = effectiveTileHeight();
+        DataRange spans[DamageRegion::MAX_RECTS];
+        for (int_fast16_t ty = tyBegin; ty < tyEnd; ++ty) {
+            auto top       = static_cast<int_fast16_t>(ty * th);
+            auto spanCount = damage_.spans(top, top + th, spans, DamageRegion::MAX_RECTS);
+            for (int_fast16_t i = 0; i < spanCount; ++i) {
+                for (int_fast16_t x = spans[i].startX; x < spans[i].endX; x = static_cast<int_fast16_t>(x + tw)) {
+                    processDamageSpan(x, std::min<int_fast16_t>(x + tw, spans[i].endX), ty);
+                }
+            }
+        }
+        return;
+    }
+
+    for (int_fast16_t ty = tyBegin; ty < tyEnd; ++ty) {
         for (int_fast16_t tx = 0; tx < tileCountX; ++tx) {
             // デバッグ用チェッカーボード: 市松模様でタイルをスキップ
             if (debugCheckerboard_ && ((tx + ty) % 2 == 1)) {
@@ -98,6 +207,288 @@ void RendererNode::execProcess()
     }
 }
 
+// ============================================================================
+// RendererNode - 差分描画
+// ============================================================================
+
+namespace {
+
+// 接続・状態キー用の混合（FNV-1a）
+inline uint32_t mixDamageKey(uint32_t key, uintptr_t value)
+{
+    for (size_t i = 0; i < sizeof(value); ++i) {
+        key = (key ^ static_cast<uint32_t>(value & 0xFF)) * 16777619u;
+        value >>= 8;
+    }
+    return key;
+}
+
+constexpr uint32_t DAMAGE_KEY_SEED = 2166136261u;
+
+// 下流ノードの接続と変更カウンタを再帰的にキーへ混合
+uint32_t mixDownstreamKey(uint32_t key, const Node *node)
+{
+    key = mixDamageKey(key, reinterpret_cast<uintptr_t>(node));
+    if (!node) return key;
+    key = mixDamageKey(key, node->revision());
+    for (int i = 0; i < node->outputPortCount(); ++i) {
+        key = mixDownstreamKey(key, node->downstreamNode(i));
+    }
+    return key;
+}
+
+}  // namespace
+
+uint32_t RendererNode::computePushStateKey(Node *downstream) const
+{
+    uint32_t key = mixDownstreamKey(DAMAGE_KEY_SEED, downstream);
+    key          = mixDamageKey(key, static_cast<uint16_t>(virtualWidth_));
+    key          = mixDamageKey(key, static_cast<uint16_t>(virtualHeight_));
+    key          = mixDamageKey(key, static_cast<uint32_t>(pivotX_));
+    key          = mixDamageKey(key, static_cast<uint32_t>(pivotY_));
+    return key;
+}
+
+DamageRect RendererNode::toScreenRect(const PrepareResponse &aabb) const
+{
+    if (aabb.width <= 0 || aabb.height <= 0) return DamageRect{};
+
+    // スクリーン座標 = ワールド座標 + pivot（サブピクセル位置の補間・丸め差を1px拡張で吸収）
+    int_fixed left = aabb.origin.x + pivotX_;
+    int_fixed top  = aabb.origin.y + pivotY_;
+    int32_t x0     = from_fixed_floor(left) - 1;
+    int32_t y0     = from_fixed_floor(top) - 1;
+    int32_t x1     = from_fixed_ceil(left + to_fixed(aabb.width)) + 1;
+    int32_t y1     = from_fixed_ceil(top + to_fixed(aabb.height)) + 1;
+
+    // スクリーンではクリップしない（画面外のスプライトでもブラー等のマージン拡張で
+    // 画面内に掛かるため）。スクリーンへのクリップは updateDamage() で最後に1回だけ行う
+    DamageRect r;
+    r.x0 = clampDamageCoord(x0);
+    r.y0 = clampDamageCoord(y0);
+    r.x1 = clampDamageCoord(x1);
+    r.y1 = clampDamageCoord(y1);
+    if (r.empty()) return DamageRect{};
+    return r;
+}
+
+size_t RendererNode::collectDamage(Node *node)
+{
+    // 評価済み（DAG共有ノード）
+    for (size_t i = 0; i < damageWork_.size(); ++i) {
+        if (damageWork_[i].record.node == node) return i;
+    }
+
+    // 上流のダメージを収集（再帰中に damageWork_ が再確保されるためインデックスで参照）
+    DamageRegion region;
+    uint32_t inputsKey = DAMAGE_KEY_SEED;
+    for (int i = 0; i < node->inputPortCount(); ++i) {
+        Node *upstream = node->upstreamNode(i);
+        inputsKey      = mixDamageKey(inputsKey, reinterpret_cast<uintptr_t>(upstream));
+        if (!upstream) continue;
+        size_t index = collectDamage(upstream);
+        region.add(damageWork_[index].region);
+    }
+
+    int_fast16_t marginX = 0, marginY = 0;
+    node->damageMargin(marginX, marginY);
+    region.expand(marginX, marginY);
+
+    DamageRecord record;
+    record.node      = node;
+    record.revision  = node->revision();
+    record.inputsKey = inputsKey;
+    record.bounds    = toScreenRect(node->lastPrepareResponse());
+
+    // 前回の状態と比較
+    // 中間ノードのAABB変化は上流の変化によるもの（上流側のダメージで網羅済み）のため、
+    // AABBの比較は入力を持たないノードのみで行う
+    auto prev = std::lower_bound(
+        damageRecords_.begin(), damageRecords_.end(), node,
+        [](const DamageRecord &r, const Node *n) { return std::less<const Node *>()(r.node, n); });
+    if (prev == damageRecords_.end() || prev->node != node) {
+        region.add(record.bounds);
+    } else {
+        const DamageRect &old = prev->bounds;
+        bool boundsChanged    = old.x0 != record.bounds.x0 || old.y0 != record.bounds.y0 ||
+                             old.x1 != record.bounds.x1 || old.y1 != record.bounds.y1;
+        if (prev->revision != record.revision || prev->inputsKey != record.inputsKey ||
+            (node->inputPortCount() == 0 && boundsChanged)) {
+            region.add(old);
+            region.add(record.bounds);
+        }
+    }
+
+    damageWork_.push_back(DamageWork{record, region});
+    return damageWork_.size() - 1;
+}
+
+void RendererNode::updateDamage(Node *upstream, Node *downstream)
+{
+    damage_.clear();
+    DamageRect screen{0, 0, virtualWidth_, virtualHeight_};
+
+    // デバッグ表示はフレーム全体の描画を前提とするため、差分描画しない
+    if (!damageTracking_ || debugCheckerboard_ || debugDataRange_) {
+        damageValid_ = false;
+        damageRecords_.clear();
+        damage_.add(screen);
+        return;
+    }
+
+    damageWork_.clear();
+    size_t rootIndex = collectDamage(upstream);
+    damage_.add(damageWork_[rootIndex].region);
+
+    // 新しい記録をアドレス順に整列し、グラフから外れたノードの旧領域を加える
+    std::vector<DamageRecord> records;
+    records.reserve(damageWork_.size());
+    for (const auto &work : damageWork_) {
+        records.push_back(work.record);
+    }
+    auto byNode = [](const DamageRecord &a, const DamageRecord &b) {
+        return std::less<const Node *>()(a.node, b.node);
+    };
+    std::sort(records.begin(), records.end(), byNode);
+    for (const auto &old : damageRecords_) {
+        if (!std::binary_search(records.begin(), records.end(), old, byNode)) {
+            damage_.add(old.bounds);
+        }
+    }
+    damageRecords_.swap(records);
+
+    // 下流・スクリーン設定が変化した場合、または前回の記録が無効なら全画面
+    uint32_t pushKey = computePushStateKey(downstream);
+    if (!damageValid_ || pushKey != pushStateKey_) {
+        damage_.clear();
+        damage_.add(screen);
+    }
+    pushStateKey_ = pushKey;
+    damage_.clip(screen);
+
+    // 初回（記録が無効）は従来どおりの全画面描画、以降は区間単位の部分描画
+    partialFrame_ = damageValid_;
+    damageValid_  = true;
+}
+
+void RendererNode::processDamageSpan(int_fast16_t x0, int_fast16_t x1, int_fast16_t tileY)
+{
+    RenderContext &ctx = activeContext();
+    Node *upstream     = upstreamNode(0);
+    Node *downstream   = downstreamNode(0);
+    if (!upstream || !downstream) {
+        ctx.resetScanlineResources();
+        return;
+    }
+
+    auto th  = effectiveTileHeight();
+    auto top = static_cast<int_fast16_t>(tileY * th);
+
+    RenderRequest request;
+    request.width    = static_cast<int16_t>(x1 - x0);
+    request.height   = static_cast<int16_t>(std::min<int_fast16_t>(th, virtualHeight_ - top));
+    request.origin.x = to_fixed(static_cast<int>(x0)) - pivotX_;
+    request.origin.y = to_fixed(static_cast<int>(top)) - pivotY_;
+
+    // 区間全体を透明で埋めたバッファに結果を配置（前フレームの内容を消去するため）
+    ImageBuffer span(request.width, request.height, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero,
+                     ctx.allocator());
+
+    // プルする範囲: データ区間分割時はデータのある区間のみ、それ以外は区間全体
+    DataRange wholeRange{0, request.width};
+    DataRangeList pulls(&wholeRange, 1);
+    pulls.count = 1;
+    if (spanSplit_) {
+        DataRange *storage = ctx.acquireSegments(MAX_DATA_SPANS);
+        if (storage) {
+            pulls = DataRangeList(storage, MAX_DATA_SPANS);
+            collectDataSpans(upstream, request, pulls);
+        }
+    }
+
+    for (int_fast16_t i = 0; i < pulls.count; ++i) {
+        RenderRequest pullReq = request;
+        pullReq.origin.x += to_fixed(static_cast<int>(pulls.spans[i].startX));
+        pullReq.width = pulls.spans[i].width();
+
+        RenderResponse &result = upstream->pullProcess(pullReq);
+        if (result.isValid()) {
+            const ImageBuffer &buf = result.buffer();
+            ViewPort srcView       = buf.view();
+            auto offsetX           = static_cast<int_fast32_t>(from_fixed(buf.origin().x - request.origin.x));
+            auto offsetY           = static_cast<int_fast32_t>(from_fixed(buf.origin().y - request.origin.y));
+            int_fast32_t srcX      = std::max<int_fast32_t>(0, -offsetX);
+            int_fast32_t srcY      = std::max<int_fast32_t>(0, -offsetY);
+            int_fast32_t dstX      = std::max<int_fast32_t>(0, offsetX);
+            int_fast32_t dstY      = std::max<int_fast32_t>(0, offsetY);
+            int_fast32_t w         = std::min<int_fast32_t>(srcView.width - srcX, request.width - dstX);
+            int_fast32_t h         = std::min<int_fast32_t>(srcView.height - srcY, request.height - dstY);
+            // 同一フォーマットは memcpy、異なる場合は変換しながら配置
+            auto converter = resolveConverter(srcView.formatID, PixelFormatIDs::RGBA8_Straight, &buf.auxInfo());
+            if (w > 0 && h > 0 && converter) {
+                ViewPort dstView = span.view();
+                for (int_fast32_t y = 0; y < h; ++y) {
+                    converter(dstView.pixelAt(static_cast<int>(dstX), static_cast<int>(dstY + y)),
+                              srcView.pixelAt(static_cast<int>(srcX), static_cast<int>(srcY + y)),
+                              static_cast<size_t>(w));
+                }
+            }
+        }
+        ctx.releaseResponse(result);
+    }
+
+    RenderResponse &output = ctx.acquireResponse();
+    span.setOrigin(request.origin);
+    output.addBuffer(std::move(span));
+    output.origin = request.origin;
+
+    downstream->pushProcess(output, request);
+    ctx.resetScanlineResources();
+}
+
+// ============================================================================
+// RendererNode - データ区間分割
+// ============================================================================
+
+void RendererNode::collectDataSpans(Node *upstream, const RenderRequest &request, DataRangeList &spans)
+{
+    upstream->getDataSpans(request, spans);
+    spans.closeGaps(MIN_SPAN_GAP);
+
+    // リクエスト範囲にクリップ
+    int_fast16_t n = 0;
+    for (int_fast16_t i = 0; i < spans.count; ++i) {
+        DataRange r{std::max<int16_t>(spans.spans[i].startX, 0), std::min(spans.spans[i].endX, request.width)};
+        if (r.hasData()) spans.spans[n++] = r;
+    }
+    spans.count = n;
+}
+
+bool RendererNode::processDataSpans(Node *upstream, const RenderRequest &request)
+{
+    RenderContext &ctx = activeContext();
+    DataRange *storage = ctx.acquireSegments(MAX_DATA_SPANS);
+    if (!storage) return false;
+
+    DataRangeList spans(storage, MAX_DATA_SPANS);
+    collectDataSpans(upstream, request, spans);
+    if (spans.empty()) return false;
+
+    Node *downstream = downstreamNode(0);
+    for (int_fast16_t i = 0; i < spans.count; ++i) {
+        RenderRequest spanReq = request;
+        spanReq.origin.x += to_fixed(static_cast<int>(spans.spans[i].startX));
+        spanReq.width = spans.spans[i].width();
+
+        RenderResponse &result = upstream->pullProcess(spanReq);
+        if (downstream) {
+            downstream->pushProcess(result, spanReq);
+        }
+        ctx.releaseResponse(result);
+    }
+    return true;
+}
+
 // デバッグ用: DataRange可視化処理
 // - getDataRange()の範囲外: マゼンタ（データがないはずの領域）
 // - AABBとgetDataRangeの差分:
@@ -112,7 +503,8 @@ void RendererNode::applyDataRangeDebug(Node *upstream, const RenderRequest &requ
     DataRange aabbRange = upstream->getDataRangeBounds(request);
 
     // フルサイズのバッファを作成（ゼロ初期化で未定義領域を透明に）
-    ImageBuffer debugBuffer(request.width, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero, pipelineAllocator_);
+    ImageBuffer debugBuffer(request.width, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero,
+                            activeContext().allocator());
     uint8_t *dst = static_cast<uint8_t *>(debugBuffer.data());
 
     // デバッグ色定義（RGBA）
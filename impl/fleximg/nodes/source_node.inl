@@ -18,6 +18,14 @@ PrepareResponse SourceNode::onPullPrepare(const PrepareRequest &request)
     // getDataRangeキャッシュを無効化（アフィン行列が変わる可能性があるため）
     dataRangeCache_.invalidate();
 
+    // 透明部分のトリミング情報（ソース変更後の初回のみ走査）
+    if (alphaTrimEnabled_ && !trimValid_) {
+        updateAlphaTrim();
+    }
+    trimActive_  = false;
+    trimOffsetX_ = 0;
+    trimOffsetY_ = 0;
+
     // Prepare時のoriginを保存（Process時の差分計算用）
     prepareOriginX_ = request.origin.x;
     prepareOriginY_ = request.origin.y;
@@ -31,9 +39,39 @@ PrepareResponse SourceNode::onPullPrepare(const PrepareRequest &request)
         combinedMatrix = localMatrix_;  // 無変換時は単位行列
     }
 
+    // 射影変換: アフィン変換の事前計算（ミップマップ・列テーブル等）は使用しない
+    usePerspective_ = false;
+    if (perspectiveEnabled_) {
+        PrepareResponse result;
+        preparePerspective(request, combinedMatrix, result);
+        return result;
+    }
+
     // 逆行列とピクセル中心オフセットを計算
     affine_ = precomputeInverseAffine(combinedMatrix);
 
+    // ミップマップ: 逆行列の縮小率からレベルを選択し、サンプリング対象をそのレベルに置き換える
+    // レベル L の1ピクセルは元画像の 2^L x 2^L ピクセルに相当するため、
+    // 行列の2x2部分を 2^L 倍、pivot を 1/2^L にして逆行列を計算し直す
+    view_            = source_;
+    mipLevel_        = 0;
+    mipBlend_        = 0;
+    int_fixed pivotX = pivotX_;
+    int_fixed pivotY = pivotY_;
+    if (affine_.isValid() && selectMipLevel()) {
+        const auto levelScale = static_cast<float>(1 << mipLevel_);
+
+        combinedMatrix.a *= levelScale;
+        combinedMatrix.b *= levelScale;
+        combinedMatrix.c *= levelScale;
+        combinedMatrix.d *= levelScale;
+
+        pivotX  = pivotX_ >> mipLevel_;
+        pivotY  = pivotY_ >> mipLevel_;
+        view_   = mipLevels_[static_cast<size_t>(mipLevel_ - 1)].view();
+        affine_ = precomputeInverseAffine(combinedMatrix);
+    }
+
     if (affine_.isValid()) {
         const int32_t invA = affine_.invMatrix.a;
         const int32_t invB = affine_.invMatrix.b;
@@ -41,8 +79,8 @@ PrepareResponse SourceNode::onPullPrepare(const PrepareRequest &request)
         const int32_t invD = affine_.invMatrix.d;
 
         // pivot は既に Q16.16 なのでそのまま使用
-        const int32_t srcPivotXFixed16 = pivotX_;
-        const int32_t srcPivotYFixed16 = pivotY_;
+        const int32_t srcPivotXFixed16 = pivotX;
+        const int32_t srcPivotYFixed16 = pivotY;
 
         // prepareOrigin を逆行列で変換（Prepare時に1回だけ計算）
         // Q16.16 × Q16.16 = Q32.32、右シフトで Q16.16 に戻す
@@ -53,16 +91,41 @@ PrepareResponse SourceNode::onPullPrepare(const PrepareRequest &request)
             (static_cast<int64_t>(prepareOriginX_) * invC + static_cast<int64_t>(prepareOriginY_) * invD) >>
             INT_FIXED_SHIFT);
 
+        constexpr int_fixed one = 1 << INT_FIXED_SHIFT;
+
+        // 面積平均: 回転・せん断なしで、いずれかの軸が縮小の場合のみ
+        useArea_ = interpolationMode_ == InterpolationMode::Area && invB == 0 && invC == 0 &&
+                   (invA > one || invA < -one || invD > one || invD < -one) && prepareRGBA8Converter();
+
         // バイリニア補間かどうかで有効範囲とオフセットが異なる
         // copyQuadDDA対応フォーマットならバイリニア可能（出力はRGBA8_Straight）
-        const bool useBilinear =
-            (interpolationMode_ == InterpolationMode::Bilinear) && source_.formatID && source_.formatID->copyQuadDDA;
+        // 面積平均の条件を満たさない Area はバイリニアとして扱う
+        const bool useBilinear = !useArea_ &&
+                                 (interpolationMode_ == InterpolationMode::Bilinear ||
+                                  interpolationMode_ == InterpolationMode::Area) &&
+                                 view_.formatID && view_.formatID->copyQuadDDA;
+
+        if (useArea_) {
+            // 面積平均: 有効範囲は最近傍と同じ（出力ピクセル中心がソース内）
+            fpWidth_  = source_.width << INT_FIXED_SHIFT;
+            fpHeight_ = source_.height << INT_FIXED_SHIFT;
 
-        if (useBilinear) {
+            xs1_ = invA + (invA < 0 ? fpWidth_ : -1);
+            xs2_ = invA + (invA < 0 ? 0 : (fpWidth_ - 1));
+            ys1_ = invC + (invC < 0 ? fpHeight_ : -1);
+            ys2_ = invC + (invC < 0 ? 0 : (fpHeight_ - 1));
+
+            // 列テーブル・行キャッシュはprepareごとに作り直す（ソース内容の変更に追従）
+            for (auto &state : areaStates_) {
+                state.tableValid = false;
+                state.cachedRow  = -1;
+            }
+            useBilinear_ = false;
+        } else if (useBilinear) {
             // バイリニア: 有効範囲はNearest同様 srcSize
             // 境界外ピクセルは copyQuadDDA の edgeFlags で透明として補間
-            fpWidth_  = source_.width << INT_FIXED_SHIFT;
-            fpHeight_ = source_.height << INT_FIXED_SHIFT;
+            fpWidth_  = view_.width << INT_FIXED_SHIFT;
+            fpHeight_ = view_.height << INT_FIXED_SHIFT;
 
             // バイリニア: edgeFadeFlagsに応じて各辺の範囲を拡張
             // フェード有効な辺のみ halfPixel 分拡張（フェードアウト領域用）
@@ -101,8 +164,18 @@ PrepareResponse SourceNode::onPullPrepare(const PrepareRequest &request)
             useBilinear_ = true;
         } else {
             // 最近傍: pivot の小数部を保持
-            fpWidth_  = source_.width << INT_FIXED_SHIFT;
-            fpHeight_ = source_.height << INT_FIXED_SHIFT;
+            // 透明部分のトリミング時は非透明ピクセルを含む矩形を有効範囲とする
+            int32_t rectWidth  = view_.width;
+            int32_t rectHeight = view_.height;
+            trimActive_        = alphaTrimEnabled_ && !trimRows_.empty() && mipLevel_ == 0;
+            if (trimActive_) {
+                trimOffsetX_ = trimBounds_.startX << INT_FIXED_SHIFT;
+                trimOffsetY_ = trimTop_ << INT_FIXED_SHIFT;
+                rectWidth    = trimBounds_.width();
+                rectHeight   = trimBottom_ - trimTop_;
+            }
+            fpWidth_  = rectWidth << INT_FIXED_SHIFT;
+            fpHeight_ = rectHeight << INT_FIXED_SHIFT;
 
             xs1_ = invA + (invA < 0 ? fpWidth_ : -1);
             xs2_ = invA + (invA < 0 ? 0 : (fpWidth_ - 1));
@@ -122,27 +195,49 @@ PrepareResponse SourceNode::onPullPrepare(const PrepareRequest &request)
         // 等倍表示相当（逆行列2x2部分が単位行列）かつ最近傍の場合、
         // DDA をスキップし、高速な非アフィンパス（subView参照）を使用
         // バイリニア補間時はedgeFade等の処理にDDAが必要なためスキップしない
-        constexpr int_fixed one = 1 << INT_FIXED_SHIFT;
-        bool isTranslationOnly  = !useBilinear_ && invA == one && invD == one && invB == 0 && invC == 0;
+        // （面積平均は縮小時のみなので等倍にはならない）
+        bool isTranslationOnly = !useBilinear_ && invA == one && invD == one && invB == 0 && invC == 0;
 
         hasAffine_ = !isTranslationOnly;
+
+        // 列テーブル（回転・せん断なしの拡大縮小）
+        buildColumnMap(request.width);
+
+        // 転置キャッシュ（90度/270度回転の最近傍、帯はprepareごとに作り直す）
+        const PixelFormatID format = view_.formatID;
+        useTransposeCache_ = transposeCacheEnabled_ && hasAffine_ && !useBilinear_ && !useArea_ && invA == 0 &&
+                             invD == 0 && format && format->pixelsPerUnit == 1 && format->bytesPerPixel >= 1 &&
+                             format->bytesPerPixel <= 4 && format->copyRowDDA;
+        for (auto &strip : transposeStrips_) {
+            strip.column = -1;
+        }
     } else {
         // 逆行列が無効（特異行列）
-        hasAffine_ = true;
+        hasAffine_         = true;
+        useArea_           = false;
+        useColumnMap_      = false;
+        useTransposeCache_ = false;
     }
 
     // SourceNodeは終端なので上流への伝播なし
     // 出力側で必要なAABBを計算（常にcalcAffineAABBを使用）
     PrepareResponse result;
     result.status          = PrepareStatus::Prepared;
-    result.preferredFormat = source_.formatID;
+    result.preferredFormat = view_.formatID;
 
     // バイリニア補間のフェード領域分を考慮した入力矩形
     // フェード有効な辺は0.5ピクセル拡張される
-    float aabbWidth      = static_cast<float>(source_.width);
-    float aabbHeight     = static_cast<float>(source_.height);
-    int_fixed aabbPivotX = pivotX_;
-    int_fixed aabbPivotY = pivotY_;
+    float aabbWidth      = static_cast<float>(view_.width);
+    float aabbHeight     = static_cast<float>(view_.height);
+    int_fixed aabbPivotX = pivotX;
+    int_fixed aabbPivotY = pivotY;
+    if (trimActive_) {
+        // 透明部分のトリミング: 非透明ピクセルを含む矩形のみ
+        aabbWidth  = static_cast<float>(fpWidth_ >> INT_FIXED_SHIFT);
+        aabbHeight = static_cast<float>(fpHeight_ >> INT_FIXED_SHIFT);
+        aabbPivotX -= trimOffsetX_;
+        aabbPivotY -= trimOffsetY_;
+    }
     if (useBilinear_) {
         constexpr float half          = 0.5f;
         constexpr int_fixed halfFixed = 1 << (INT_FIXED_SHIFT - 1);
@@ -165,6 +260,9 @@ PrepareResponse SourceNode::onPullPrepare(const PrepareRequest &request)
     calcAffineAABB(aabbWidth, aabbHeight, {aabbPivotX, aabbPivotY}, combinedMatrix, result.width, result.height,
                    result.origin);
 
+    // 行ごとの有効範囲を事前計算（スキャンラインごとの除算を省く）
+    buildRowSpanTable(request, result);
+
     return result;
 }
 
@@ -172,7 +270,7 @@ RenderResponse &SourceNode::onPullProcess(const RenderRequest &request)
 {
     FLEXIMG_METRICS_SCOPE(NodeType::Source);
 
-    if (!source_.isValid()) {
+    if (!view_.isValid()) {
         return makeEmptyResponse(request.origin);
     }
 
@@ -181,27 +279,9 @@ RenderResponse &SourceNode::onPullProcess(const RenderRequest &request)
         return pullProcessWithAffine(request);
     }
 
-    // アフィン事前計算値から座標を導出（DDAパスと同一の情報源）
-    // baseTxWithOffsets_ はPrepare時に合成行列から計算済みで、
-    // request.affineMatrix経由の平行移動も含まれている
-    const int32_t deltaX = from_fixed(request.origin.x - prepareOriginX_);
-    const int32_t deltaY = from_fixed(request.origin.y - prepareOriginY_);
-    const int32_t baseX  = baseTxWithOffsets_ + deltaX * affine_.invMatrix.a + deltaY * affine_.invMatrix.b;
-    const int32_t baseY  = baseTyWithOffsets_ + deltaX * affine_.invMatrix.c + deltaY * affine_.invMatrix.d;
-
-    // srcBase: 出力dx=0に対応するソースピクセルインデックス
-    int32_t srcBaseX = from_fixed_floor(baseX);
-    int32_t srcBaseY = from_fixed_floor(baseY);
-
-    // 有効範囲: srcBase + dx が [0, srcSize) に収まる dx の範囲
-    // srcBase + dxStart >= 0  →  dxStart >= -srcBaseX
-    // srcBase + dxEnd < srcSize  →  dxEnd < srcSize - srcBaseX
-    auto dxStartX = std::max<int32_t>(0, -srcBaseX);
-    auto dxEndX   = std::min<int32_t>(request.width, source_.width - srcBaseX);
-    auto dxStartY = std::max<int32_t>(0, -srcBaseY);
-    auto dxEndY   = std::min<int32_t>(request.height, source_.height - srcBaseY);
-
-    if (dxStartX >= dxEndX || dxStartY >= dxEndY) {
+    // 有効範囲（ソース矩形、トリミング時は非透明範囲）
+    int32_t srcBaseX = 0, srcBaseY = 0, dxStartX = 0, dxEndX = 0, dxStartY = 0, dxEndY = 0;
+    if (!calcTranslationRange(request, srcBaseX, srcBaseY, dxStartX, dxEndX, dxStartY, dxEndY)) {
         return makeEmptyResponse(request.origin);
     }
 
@@ -212,13 +292,13 @@ RenderResponse &SourceNode::onPullProcess(const RenderRequest &request)
     auto srcX = static_cast<int_fast16_t>(srcBaseX + dxStartX);
     auto srcY = static_cast<int_fast16_t>(srcBaseY + dxStartY);
     ImageBuffer result(
-        view_ops::subView(source_, srcX, srcY, static_cast<int_fast16_t>(validW), static_cast<int_fast16_t>(validH)));
-    // パレット情報を出力ImageBufferに設定
-    if (palette_) {
+        view_ops::subView(view_, srcX, srcY, static_cast<int_fast16_t>(validW), static_cast<int_fast16_t>(validH)));
+    // パレット情報を出力ImageBufferに設定（ミップレベルは適用済み）
+    if (palette_ && mipLevel_ == 0) {
         result.setPalette(palette_);
     }
     // カラーキー情報を出力ImageBufferに設定
-    if (colorKeyRGBA8_ != colorKeyReplace_) {
+    if (colorKeyRGBA8_ != colorKeyReplace_ && mipLevel_ == 0) {
         result.auxInfo().colorKeyRGBA8   = colorKeyRGBA8_;
         result.auxInfo().colorKeyReplace = colorKeyReplace_;
     }
@@ -232,11 +312,76 @@ RenderResponse &SourceNode::onPullProcess(const RenderRequest &request)
 // SourceNode - private ヘルパーメソッド実装
 // ============================================================================
 
+// 非アフィン（平行移動のみ）の有効範囲を計算
+// 戻り値: true=有効範囲あり, false=有効範囲なし
+bool SourceNode::calcTranslationRange(const RenderRequest &request, int32_t &srcBaseX, int32_t &srcBaseY,
+                                      int32_t &dxStartX, int32_t &dxEndX, int32_t &dxStartY, int32_t &dxEndY) const
+{
+    // アフィン事前計算値から座標を導出（DDAパスと同一の情報源）
+    // baseTxWithOffsets_ はPrepare時に合成行列から計算済みで、
+    // request.affineMatrix経由の平行移動も含まれている
+    const int32_t deltaX = from_fixed(request.origin.x - prepareOriginX_);
+    const int32_t deltaY = from_fixed(request.origin.y - prepareOriginY_);
+    const int32_t baseX  = baseTxWithOffsets_ + deltaX * affine_.invMatrix.a + deltaY * affine_.invMatrix.b;
+    const int32_t baseY  = baseTyWithOffsets_ + deltaX * affine_.invMatrix.c + deltaY * affine_.invMatrix.d;
+
+    // srcBase: 出力dx=0に対応するソースピクセルインデックス
+    srcBaseX = from_fixed_floor(baseX);
+    srcBaseY = from_fixed_floor(baseY);
+
+    // 有効範囲: srcBase + dx が [0, srcSize) に収まる dx の範囲
+    // srcBase + dxStart >= 0  →  dxStart >= -srcBaseX
+    // srcBase + dxEnd < srcSize  →  dxEnd < srcSize - srcBaseX
+    // トリミング時は非透明ピクセルを含む矩形 [x0, x1) x [y0, y1) に置き換える
+    int32_t x0 = 0, x1 = view_.width, y0 = 0, y1 = view_.height;
+    if (trimActive_) {
+        x0 = trimBounds_.startX;
+        x1 = trimBounds_.endX;
+        y0 = trimTop_;
+        y1 = trimBottom_;
+    }
+    dxStartX = std::max<int32_t>(0, x0 - srcBaseX);
+    dxEndX   = std::min<int32_t>(request.width, x1 - srcBaseX);
+    dxStartY = std::max<int32_t>(0, y0 - srcBaseY);
+    dxEndY   = std::min<int32_t>(request.height, y1 - srcBaseY);
+
+    if (dxStartX >= dxEndX || dxStartY >= dxEndY) {
+        return false;
+    }
+
+    if (trimActive_) {
+        // 要求行の非透明範囲の和集合で左右を制限し、上下の空行を除外
+        int32_t rowStartX = x1, rowEndX = x0;
+        int32_t firstY = -1, lastY = -1;
+        for (int32_t dy = dxStartY; dy < dxEndY; ++dy) {
+            const DataRange &row = trimRows_[static_cast<size_t>(srcBaseY + dy)];
+            if (!row.hasData()) continue;
+            if (firstY < 0) firstY = dy;
+            lastY     = dy;
+            rowStartX = std::min<int32_t>(rowStartX, row.startX);
+            rowEndX   = std::max<int32_t>(rowEndX, row.endX);
+        }
+        if (firstY < 0) {
+            return false;
+        }
+        dxStartY = firstY;
+        dxEndY   = lastY + 1;
+        dxStartX = std::max(dxStartX, rowStartX - srcBaseX);
+        dxEndX   = std::min(dxEndX, rowEndX - srcBaseX);
+    }
+    return dxStartX < dxEndX;
+}
+
 // スキャンライン有効範囲を計算（getDataRange/pullProcessWithAffineで共用）
 // 戻り値: true=有効範囲あり, false=有効範囲なし
 bool SourceNode::calcScanlineRange(const RenderRequest &request, int32_t &dxStart, int32_t &dxEnd, int32_t *outBaseX,
                                    int32_t *outBaseY) const
 {
+    // 射影変換（ベース座標は使用しない）
+    if (usePerspective_) {
+        return calcPerspectiveRange(request, dxStart, dxEnd);
+    }
+
     // 特異行列チェック
     if (!affine_.isValid()) {
         return false;
@@ -258,25 +403,52 @@ bool SourceNode::calcScanlineRange(const RenderRequest &request, int32_t &dxStar
     const int32_t baseX = baseTxWithOffsets_ + deltaX * invA + deltaY * invB;
     const int32_t baseY = baseTyWithOffsets_ + deltaX * invC + deltaY * invD;
 
+    // 有効矩形（トリミング時は非透明ピクセルを含む矩形）の左上を原点とした座標
+    const int32_t clipX = baseX - trimOffsetX_;
+    const int32_t clipY = baseY - trimOffsetY_;
+
     int32_t left  = 0;
     int32_t right = request.width;
 
+    // 行範囲テーブル: スクリーン内の行は配列参照のみ（テーブル外の行はAABB外なのでデータなし）
+    if (static_cast<uint32_t>(deltaY) < static_cast<uint32_t>(rowSpanScreenHeight_)) {
+        auto row = static_cast<uint32_t>(deltaY - rowSpanTop_);
+        if (row < rowSpans_.size()) {
+            const RowSpan &span = rowSpans_[row];
+            left                = std::max(left, span.start - deltaX);
+            right               = std::min(right, span.end - deltaX);
+        } else {
+            left  = 1;
+            right = 0;
+        }
+        dxStart = left;
+        dxEnd   = right - 1;
+        if (outBaseX) *outBaseX = baseX;
+        if (outBaseY) *outBaseY = baseY;
+        return dxStart <= dxEnd;
+    }
+
     if (invA) {
-        left  = std::max(left, (xs1_ - baseX) / invA);
-        right = std::min(right, (xs2_ - baseX) / invA);
-    } else if (static_cast<uint32_t>(baseX) >= static_cast<uint32_t>(fpWidth_)) {
+        left  = std::max(left, (xs1_ - clipX) / invA);
+        right = std::min(right, (xs2_ - clipX) / invA);
+    } else if (static_cast<uint32_t>(clipX) >= static_cast<uint32_t>(fpWidth_)) {
         left  = 1;
         right = 0;
     }
 
     if (invC) {
-        left  = std::max(left, (ys1_ - baseY) / invC);
-        right = std::min(right, (ys2_ - baseY) / invC);
-    } else if (static_cast<uint32_t>(baseY) >= static_cast<uint32_t>(fpHeight_)) {
+        left  = std::max(left, (ys1_ - clipY) / invC);
+        right = std::min(right, (ys2_ - clipY) / invC);
+    } else if (static_cast<uint32_t>(clipY) >= static_cast<uint32_t>(fpHeight_)) {
         left  = 1;
         right = 0;
     }
 
+    // 回転なしではソース行が一定なので、その行の非透明範囲で制限
+    if (trimActive_ && !invC && left < right) {
+        clipToTrimRow(baseX, baseY, left, right, false);
+    }
+
     dxStart = left;
     dxEnd   = right - 1;  // right は排他的なので -1
 
@@ -287,19 +459,215 @@ bool SourceNode::calcScanlineRange(const RenderRequest &request, int32_t &dxStar
     return dxStart <= dxEnd;
 }
 
+// 行範囲テーブルを作成
+// 範囲計算はdeltaXについて平行移動するだけなので、行ごとに deltaX = 0 の範囲を1つ持てばよい
+void SourceNode::buildRowSpanTable(const PrepareRequest &request, const PrepareResponse &aabb)
+{
+    rowSpans_.clear();
+    rowSpanTop_          = 0;
+    rowSpanScreenHeight_ = 0;
+    if (!rowSpanTableEnabled_ || !hasAffine_ || !affine_.isValid() || request.height <= 0) {
+        return;
+    }
+
+    // AABBの行範囲（prepare origin 基準、浮動小数点誤差分として上下1行拡張）をスクリーン内に制限
+    // スクリーン外の行はcalcScanlineRangeが直接計算する
+    int top    = std::max(0, from_fixed_floor(aabb.origin.y - prepareOriginY_) - 1);
+    int bottom = std::min<int>(request.height,
+                               from_fixed_ceil(aabb.origin.y + to_fixed(aabb.height) - prepareOriginY_) + 1);
+    if (top < bottom) {
+        rowSpans_.resize(static_cast<size_t>(bottom - top));
+        for (int y = top; y < bottom; ++y) {
+            rowSpans_[static_cast<size_t>(y - top)] = calcRowSpan(y);
+        }
+        rowSpanTop_ = top;
+    }
+    rowSpanScreenHeight_ = request.height;
+}
+
+// deltaY 行の有効範囲（deltaX = 0、幅クリップなし）
+// calcScanlineRangeの切り捨て除算を床関数除算に置き換えている
+// 両者が異なるのは商が負の場合のみで、その場合は幅クリップ（0 / 範囲なし）の結果が変わらない
+SourceNode::RowSpan SourceNode::calcRowSpan(int32_t deltaY) const
+{
+    // テーブルの「制限なし」（deltaXを引いてもオーバーフローしない値）
+    constexpr int32_t unbounded = 1 << 30;
+
+    const int32_t invA  = affine_.invMatrix.a;
+    const int32_t invC  = affine_.invMatrix.c;
+    const int32_t baseX = baseTxWithOffsets_ + deltaY * affine_.invMatrix.b;
+    const int32_t baseY = baseTyWithOffsets_ + deltaY * affine_.invMatrix.d;
+    const int32_t clipX = baseX - trimOffsetX_;
+    const int32_t clipY = baseY - trimOffsetY_;
+
+    RowSpan span = {-unbounded, unbounded};
+    if (invA) {
+        span.start = std::max(span.start, floorDiv(xs1_ - clipX, invA));
+        span.end   = std::min(span.end, floorDiv(xs2_ - clipX, invA));
+    } else if (static_cast<uint32_t>(clipX) >= static_cast<uint32_t>(fpWidth_)) {
+        return RowSpan{0, 0};
+    }
+
+    if (invC) {
+        span.start = std::max(span.start, floorDiv(ys1_ - clipY, invC));
+        span.end   = std::min(span.end, floorDiv(ys2_ - clipY, invC));
+    } else if (static_cast<uint32_t>(clipY) >= static_cast<uint32_t>(fpHeight_)) {
+        return RowSpan{0, 0};
+    }
+
+    if (trimActive_ && !invC && span.start < span.end) {
+        clipToTrimRow(baseX, baseY, span.start, span.end, true);
+    }
+    return span;
+}
+
+int32_t SourceNode::floorDiv(int32_t n, int32_t d)
+{
+    int32_t q = n / d;
+    return (q * d != n && ((n < 0) != (d < 0))) ? q - 1 : q;
+}
+
+// 回転なし時の行ごとのトリミング
+// 有効矩形の範囲計算と同じ式を、ソース行の非透明範囲 [startX, endX) に適用する
+void SourceNode::clipToTrimRow(int32_t baseX, int32_t baseY, int32_t &left, int32_t &right, bool floorDivision) const
+{
+    // 呼び出し側で有効矩形内の行であることを確認済み
+    const DataRange &row = trimRows_[static_cast<size_t>(baseY >> INT_FIXED_SHIFT)];
+    if (!row.hasData()) {
+        left  = 1;
+        right = 0;
+        return;
+    }
+
+    const int32_t invA       = affine_.invMatrix.a;
+    const int32_t fpRowWidth = row.width() << INT_FIXED_SHIFT;
+    const int32_t rowX       = baseX - (row.startX << INT_FIXED_SHIFT);
+    if (invA) {
+        const int32_t rowStart = invA + (invA < 0 ? fpRowWidth : -1) - rowX;
+        const int32_t rowEnd   = invA + (invA < 0 ? 0 : (fpRowWidth - 1)) - rowX;
+        left  = std::max(left, floorDivision ? floorDiv(rowStart, invA) : rowStart / invA);
+        right = std::min(right, floorDivision ? floorDiv(rowEnd, invA) : rowEnd / invA);
+    } else if (static_cast<uint32_t>(rowX) >= static_cast<uint32_t>(fpRowWidth)) {
+        left  = 1;
+        right = 0;
+    }
+}
+
+// ソース画像を走査し、行ごとの非透明範囲を記録
+// パレット・カラーキーを含めてRGBA8_Straightへ変換し、alpha != 0 のピクセルを非透明とする
+void SourceNode::updateAlphaTrim()
+{
+    trimValid_ = true;
+    trimRows_.clear();
+    trimBounds_ = DataRange{0, 0};
+    trimTop_    = 0;
+    trimBottom_ = 0;
+
+    PixelFormatID format = source_.formatID;
+    if (!source_.isValid() || !format) {
+        return;
+    }
+    // アルファ・パレット・カラーキーのいずれもなければ全ピクセル不透明
+    const bool hasColorKey = colorKeyRGBA8_ != colorKeyReplace_;
+    if (!format->hasAlpha && !format->isIndexed && !hasColorKey) {
+        return;
+    }
+
+    PixelAuxInfo auxInfo;
+    if (palette_) {
+        auxInfo.palette           = palette_.data;
+        auxInfo.paletteFormat     = palette_.format;
+        auxInfo.paletteColorCount = palette_.colorCount;
+    }
+    auxInfo.colorKeyRGBA8   = colorKeyRGBA8_;
+    auxInfo.colorKeyReplace = colorKeyReplace_;
+    auto converter          = resolveConverter(format, PixelFormatIDs::RGBA8_Straight,
+                                               (palette_ || hasColorKey) ? &auxInfo : nullptr);
+    if (!converter) {
+        return;
+    }
+
+    // チャンク単位で変換して走査（bit-packed形式は行頭のビット位置を考慮）
+    constexpr int_fast16_t CHUNK_SIZE = 64;
+    uint8_t tempBuf[CHUNK_SIZE * 4];
+    const int_fast32_t pixelBits      = format->bitsPerPixel;
+    const int_fast32_t rowBits        = source_.x * pixelBits;
+    const size_t bytesPerChunk        = static_cast<size_t>(CHUNK_SIZE * pixelBits >> 3);
+    converter.ctx.pixelOffsetInByte   = static_cast<uint8_t>((rowBits & 7) >> (pixelBits >> 1));
+
+    const int_fast16_t width  = source_.width;
+    const int_fast16_t height = source_.height;
+    trimRows_.assign(static_cast<size_t>(height), DataRange{0, 0});
+    bool trimmed       = false;  // 全幅でない行があるか
+    int_fast16_t minX  = width;
+    int_fast16_t maxX  = 0;
+    int_fast16_t firstY = -1;
+    int_fast16_t lastY  = -1;
+    for (int_fast16_t y = 0; y < height; ++y) {
+        const uint8_t *src = static_cast<const uint8_t *>(source_.data) + (source_.y + y) * source_.stride +
+                             static_cast<size_t>(rowBits >> 3);
+        int_fast16_t first = -1;
+        int_fast16_t last  = -1;
+        for (int_fast16_t x = 0; x < width; x += CHUNK_SIZE) {
+            int_fast16_t chunk = std::min<int_fast16_t>(CHUNK_SIZE, width - x);
+            converter(tempBuf, src, static_cast<size_t>(chunk));
+            for (int_fast16_t i = 0; i < chunk; ++i) {
+                if (tempBuf[i * 4 + 3]) {
+                    if (first < 0) first = x + i;
+                    last = x + i;
+                }
+            }
+            src += bytesPerChunk;
+        }
+        if (first < 0) {
+            trimmed = true;
+            continue;
+        }
+        trimRows_[static_cast<size_t>(y)] = DataRange{static_cast<int16_t>(first), static_cast<int16_t>(last + 1)};
+        trimmed |= first > 0 || last + 1 < width;
+        minX = std::min(minX, first);
+        maxX = std::max<int_fast16_t>(maxX, last + 1);
+        if (firstY < 0) firstY = y;
+        lastY = y;
+    }
+
+    // 全行が全幅（全ピクセル不透明を含む）ならトリミング不要
+    if (!trimmed) {
+        std::vector<DataRange>().swap(trimRows_);
+        return;
+    }
+    if (firstY >= 0) {
+        trimBounds_ = DataRange{static_cast<int16_t>(minX), static_cast<int16_t>(maxX)};
+        trimTop_    = static_cast<int16_t>(firstY);
+        trimBottom_ = static_cast<int16_t>(lastY + 1);
+    }
+}
+
 // getDataRange: スキャンライン単位の正確なデータ範囲を返す
 // アフィン変換時はcalcScanlineRangeで厳密な有効範囲を計算
-// 同一リクエストの重複呼び出しはキャッシュで高速化
+// 同一リクエストの重複呼び出しはキャッシュで高速化（行範囲テーブルのスクリーン内の行は直接参照）
 DataRange SourceNode::getDataRange(const RenderRequest &request) const
 {
     // アフィン変換がない場合はAABBベースで十分（正確）
+    // トリミング時は要求行の非透明範囲
     if (!hasAffine_) {
-        return prepareResponse_.getDataRange(request);
+        if (!trimActive_) {
+            return prepareResponse_.getDataRange(request);
+        }
+        int32_t srcBaseX = 0, srcBaseY = 0, dxStartX = 0, dxEndX = 0, dxStartY = 0, dxEndY = 0;
+        if (!calcTranslationRange(request, srcBaseX, srcBaseY, dxStartX, dxEndX, dxStartY, dxEndY)) {
+            return DataRange{0, 0};
+        }
+        return DataRange{static_cast<int16_t>(dxStartX), static_cast<int16_t>(dxEndX)};
     }
 
+    // 行範囲テーブルで引ける行はキャッシュより速い
+    const int32_t deltaY = from_fixed(request.origin.y - prepareOriginY_);
+    const bool useTable  = static_cast<uint32_t>(deltaY) < static_cast<uint32_t>(rowSpanScreenHeight_);
+
     // キャッシュヒットチェック（同一スキャンラインの重複呼び出し対応）
     DataRange cached;
-    if (dataRangeCache_.tryGet(request, cached)) {
+    if (!useTable && dataRangeCache_.tryGet(request, cached)) {
         return cached;
     }
 
@@ -313,7 +681,9 @@ DataRange SourceNode::getDataRange(const RenderRequest &request) const
     }
 
     // キャッシュ更新
-    dataRangeCache_.set(request, result);
+    if (!useTable) {
+        dataRangeCache_.set(request, result);
+    }
 
     return result;
 }
@@ -341,16 +711,18 @@ RenderResponse &SourceNode::pullProcessWithAffine(const RenderRequest &request)
     // - その他のバイリニア: RGBA8_Straight出力
     // - 最近傍: ソースフォーマット出力（ただしbit-packedはIndex8に展開）
     PixelFormatID outFormat;
-    if (useBilinear_) {
-        outFormat = view_ops::canUseSingleChannelBilinear(source_.formatID, edgeFadeFlags_)
-                        ? source_.formatID
+    if (useArea_) {
+        outFormat = PixelFormatIDs::RGBA8_Straight;
+    } else if (useBilinear_) {
+        outFormat = view_ops::canUseSingleChannelBilinear(view_.formatID, edgeFadeFlags_)
+                        ? view_.formatID
                         : PixelFormatIDs::RGBA8_Straight;
     } else {
         // bit-packed形式の場合、DDAはIndex8形式で出力するため出力フォーマットをIndex8に
-        if (source_.formatID && source_.formatID->pixelsPerUnit > 1) {
+        if (view_.formatID && view_.formatID->pixelsPerUnit > 1) {
             outFormat = PixelFormatIDs::Index8;
         } else {
-            outFormat = source_.formatID;
+            outFormat = view_.formatID;
         }
     }
     ImageBuffer *output = resp.createBuffer(validWidth, 1, outFormat, InitPolicy::Uninitialized);
@@ -367,6 +739,12 @@ RenderResponse &SourceNode::pullProcessWithAffine(const RenderRequest &request)
                                                                 output->height());
 #endif
 
+    // 面積平均（出力はパレット・カラーキー適用済みのRGBA8_Straight）
+    if (useArea_) {
+        areaAverageRow(static_cast<uint8_t *>(output->data()), validWidth, dxStart, baseX, baseY);
+        return resp;
+    }
+
     // DDA転写（1行のみ）
     const int32_t invA = affine_.invMatrix.a;
     const int32_t invC = affine_.invMatrix.c;
@@ -375,9 +753,14 @@ RenderResponse &SourceNode::pullProcessWithAffine(const RenderRequest &request)
 
     void *dstRow = output->data();
 
+    // 列テーブルの対象（先頭ピクセルのスクリーン列がテーブル内）
+    const int32_t screenX = from_fixed(request.origin.x - prepareOriginX_) + dxStart;
+    const bool inColumnMap =
+        useColumnMap_ && screenX >= 0 && screenX + validWidth <= static_cast<int32_t>(colMap_.size());
+
     // ViewPortのx,yオフセットをQ16.16固定小数点に変換
-    int_fixed offsetX = static_cast<int32_t>(source_.x) << INT_FIXED_SHIFT;
-    int_fixed offsetY = static_cast<int32_t>(source_.y) << INT_FIXED_SHIFT;
+    int_fixed offsetX = static_cast<int32_t>(view_.x) << INT_FIXED_SHIFT;
+    int_fixed offsetY = static_cast<int32_t>(view_.y) << INT_FIXED_SHIFT;
 
     if (useBilinear_) {
         // バイリニア補間（出力はRGBA8_Straight）
@@ -394,10 +777,41 @@ RenderResponse &SourceNode::pullProcessWithAffine(const RenderRequest &request)
             auxInfo.colorKeyRGBA8   = colorKeyRGBA8_;
             auxInfo.colorKeyReplace = colorKeyReplace_;
         }
-        const PixelAuxInfo *auxPtr =
-            (auxInfo.palette || auxInfo.colorKeyRGBA8 != auxInfo.colorKeyReplace) ? &auxInfo : nullptr;
-        view_ops::copyRowDDABilinear(dstRow, source_, validWidth, srcX_fixed + offsetX - halfPixel,
-                                     srcY_fixed + offsetY - halfPixel, invA, invC, edgeFadeFlags_, auxPtr);
+        // ミップレベルはパレット・カラーキー適用済み
+        const bool useAux =
+            mipLevel_ == 0 && (auxInfo.palette || auxInfo.colorKeyRGBA8 != auxInfo.colorKeyReplace);
+        const PixelAuxInfo *auxPtr = useAux ? &auxInfo : nullptr;
+        const int_fixed rowSrcX    = srcX_fixed + offsetX - halfPixel;
+        const int_fixed rowSrcY    = srcY_fixed + offsetY - halfPixel;
+        if (usePerspective_) {
+            perspectiveRow(*output, request, dxStart, auxPtr);
+        } else if (!inColumnMap ||
+                   !columnMapBilinearRow(static_cast<uint32_t *>(dstRow), screenX, validWidth, rowSrcX, rowSrcY)) {
+            view_ops::copyRowDDABilinear(dstRow, view_, validWidth, rowSrcX, rowSrcY, invA, invC, edgeFadeFlags_,
+                                         auxPtr);
+        }
+
+        // トリリニア: 1つ粗いレベルの同じ位置（座標・増分は 1/2）を補間して合成
+        if (mipBlend_ > 0) {
+            ImageBuffer coarse(validWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized,
+                               allocator());
+            if (coarse.isValid()) {
+                view_ops::copyRowDDABilinear(coarse.data(), mipLevels_[static_cast<size_t>(mipLevel_)].view(),
+                                             validWidth, (srcX_fixed >> 1) - halfPixel, (srcY_fixed >> 1) - halfPixel,
+                                             invA >> 1, invC >> 1, edgeFadeFlags_, nullptr);
+                blendMipRow(static_cast<uint8_t *>(dstRow), static_cast<const uint8_t *>(coarse.data()), validWidth,
+                            mipBlend_);
+            }
+        }
+    } else if (usePerspective_) {
+        // 最近傍補間（射影変換）
+        perspectiveRow(*output, request, dxStart, nullptr);
+    } else if (inColumnMap) {
+        // 最近傍補間（列テーブル、ソース行は行内で一定）
+        columnMapRow(static_cast<uint8_t *>(dstRow), screenX, validWidth, srcY_fixed >> INT_FIXED_SHIFT);
+    } else if (useTransposeCache_) {
+        // 最近傍補間（転置キャッシュ、ソース列は行内で一定）
+        transposedRow(static_cast<uint8_t *>(dstRow), validWidth, srcX_fixed, srcY_fixed);
     } else {
         // 最近傍補間（BPP分岐は関数内部で実施）
         // view_ops::copyRowDDA(dstRow, source_, validWidth,
@@ -405,17 +819,21 @@ RenderResponse &SourceNode::pullProcessWithAffine(const RenderRequest &request)
 
         // DDAParam を構築（bit-packed形式は境界チェックにsrcWidth/srcHeightを使用）
         // ViewPortのx,yオフセットを加算
-        DDAParam param = {
-            source_.stride, source_.width, source_.height, srcX_fixed + offsetX, srcY_fixed + offsetY, invA,
-            invC,           nullptr,       nullptr};
+        DDAParam param = {view_.stride, view_.width, view_.height, srcX_fixed + offsetX, srcY_fixed + offsetY,
+                          invA,         invC,        nullptr,      nullptr};
 
         // フォーマットの関数ポインタを呼び出し
-        if (source_.formatID && source_.formatID->copyRowDDA) {
-            source_.formatID->copyRowDDA(static_cast<uint8_t *>(dstRow), static_cast<const uint8_t *>(source_.data),
-                                         validWidth, &param);
+        if (view_.formatID && view_.formatID->copyRowDDA) {
+            view_.formatID->copyRowDDA(static_cast<uint8_t *>(dstRow), static_cast<const uint8_t *>(view_.data),
+                                       validWidth, &param);
         }
     }
 
+    // ミップレベル（RGBA8、パレット・カラーキー適用済み）からのサンプリングでは以降の処理は不要
+    if (mipLevel_ > 0) {
+        return resp;
+    }
+
     // パレット情報を出力ImageBufferに設定
     if (palette_) {
         output->setPalette(palette_);
@@ -429,4 +847,854 @@ RenderResponse &SourceNode::pullProcessWithAffine(const RenderRequest &request)
     return resp;
 }
 
+// ============================================================================
+// SourceNode - 列テーブル（回転・せん断なしの拡大縮小）
+// ============================================================================
+//
+// b == c == 0 では、スクリーン列 s のソースX座標は行によらず baseTxWithOffsets_ + s * invA になる。
+// prepare時に全スクリーン列のソース列（バイリニアは重みも）を求め、各行はテーブル参照で転写する。
+// 座標はDDAと同じ int32 の演算で求めるため、結果はDDAパスとビット単位で一致する。
+//
+
+void SourceNode::buildColumnMap(int_fast16_t screenWidth)
+{
+    useColumnMap_ = false;
+    colMapReuse_  = false;
+    if (!columnMapEnabled_ || !hasAffine_ || useArea_ || affine_.invMatrix.b != 0 || affine_.invMatrix.c != 0 ||
+        screenWidth <= 0 || !view_.formatID) {
+        return;
+    }
+
+    const PixelFormatID format = view_.formatID;
+    if (useBilinear_) {
+        // RGBA8_Straight のみ（カラーキーの置換は DDA パスのフォーマット変換で行う）
+        if (format != PixelFormatIDs::RGBA8_Straight || view_.width < 2 || view_.height < 2) return;
+        if (mipLevel_ == 0 && colorKeyRGBA8_ != colorKeyReplace_) return;
+    } else if (format->pixelsPerUnit != 1 || format->bytesPerPixel < 1 || format->bytesPerPixel > 4 ||
+               !format->copyRowDDA) {
+        return;
+    }
+
+    const int32_t invA = affine_.invMatrix.a;
+    const auto width   = static_cast<size_t>(screenWidth);
+    colMap_.resize(width);
+
+    // DDAと同じく int32 で加算（ラップアラウンドを含めて一致させるため符号なしで計算）
+    auto x = static_cast<uint32_t>(baseTxWithOffsets_);
+    if (useBilinear_) {
+        // copyRowDDABilinear に渡す座標（ViewPortオフセット加算、ピクセル左上基準）と同じ
+        constexpr int_fixed halfPixel = 1 << (INT_FIXED_SHIFT - 1);
+        x += static_cast<uint32_t>((static_cast<int32_t>(view_.x) << INT_FIXED_SHIFT) - halfPixel);
+
+        colWeights_.resize(width);
+        int32_t first = -1, last = -1, interior = 0;
+        for (size_t s = 0; s < width; ++s) {
+            const auto srcX  = static_cast<int32_t>(x);
+            const int32_t sx = srcX >> INT_FIXED_SHIFT;
+            if (sx >= 0 && sx < view_.width - 1) {
+                colMap_[s]     = sx;
+                colWeights_[s] = static_cast<uint8_t>((srcX >> (INT_FIXED_SHIFT - 8)) & 0xFF);
+                if (first < 0) first = static_cast<int32_t>(s);
+                last = static_cast<int32_t>(s);
+                interior++;
+            } else {
+                colMap_[s]     = 0;
+                colWeights_[s] = 0;
+            }
+            x += static_cast<uint32_t>(invA);
+        }
+        // 内部の列は連続した範囲（座標が単調でない＝オーバーフローする場合は使用しない）
+        if (first < 0 || interior != last - first + 1) return;
+        colInteriorStart_ = first;
+        colInteriorEnd_   = last + 1;
+    } else {
+        const int32_t lastX = view_.width - 1;
+        for (size_t s = 0; s < width; ++s) {
+            colMap_[s] = std::min(std::max(static_cast<int32_t>(x) >> INT_FIXED_SHIFT, int32_t{0}), lastX);
+            x += static_cast<uint32_t>(invA);
+        }
+
+        // 縦方向の拡大では連続する行が同じソース行を参照しうる（行キャッシュはprepareごとに破棄）
+        constexpr int_fixed one = 1 << INT_FIXED_SHIFT;
+        colMapReuse_            = affine_.invMatrix.d > -one && affine_.invMatrix.d < one;
+        for (auto &row : colMapRows_) {
+            row.srcRow = -1;
+        }
+    }
+    useColumnMap_ = true;
+}
+
+void SourceNode::columnMapRow(uint8_t *dst, int32_t screenX, int_fast16_t count, int32_t srcY)
+{
+    const int32_t *columns = colMap_.data() + screenX;
+    if (!colMapReuse_) {
+        view_ops::copyRowColumnMap(dst, view_, static_cast<int_fast16_t>(srcY), columns, count);
+        return;
+    }
+
+    // 行キャッシュ経由（転写結果を保持し、同じソース行の次の要求では複製のみ）
+    const auto bpp      = static_cast<size_t>(view_.formatID->bytesPerPixel);
+    ColumnMapRow &cache = colMapRows_[RenderContext::currentWorkerIndex()];
+    if (cache.pixels.size() != colMap_.size() * bpp) {
+        cache.pixels.resize(colMap_.size() * bpp);
+        cache.srcRow = -1;
+    }
+    uint8_t *cached = cache.pixels.data() + static_cast<size_t>(screenX) * bpp;
+    if (cache.srcRow != srcY || screenX < cache.start || screenX + count > cache.end) {
+        view_ops::copyRowColumnMap(cached, view_, static_cast<int_fast16_t>(srcY), columns, count);
+        cache.srcRow = srcY;
+        cache.start  = screenX;
+        cache.end    = screenX + static_cast<int32_t>(count);
+    }
+    std::memcpy(dst, cached, static_cast<size_t>(count) * bpp);
+}
+
+bool SourceNode::columnMapBilinearRow(uint32_t *dst, int32_t screenX, int_fast16_t count, int_fixed srcX,
+                                      int_fixed srcY) const
+{
+    // 上下の行がソース内に収まる行のみ（上下端の行はエッジ処理のためDDA）
+    const int32_t sy = srcY >> INT_FIXED_SHIFT;
+    if (sy < 0 || sy >= view_.height - 1) {
+        return false;
+    }
+    const auto width    = static_cast<int32_t>(count);
+    const int32_t begin = std::min(std::max(colInteriorStart_ - screenX, int32_t{0}), width);
+    const int32_t end   = std::min(std::max(colInteriorEnd_ - screenX, begin), width);
+    if (begin >= end) {
+        return false;
+    }
+
+    // 左右の端（4近傍がソース外に掛かる列）はDDA
+    const int32_t invA = affine_.invMatrix.a;
+    if (begin > 0) {
+        view_ops::copyRowDDABilinear(dst, view_, static_cast<int_fast16_t>(begin), srcX, srcY, invA, 0,
+                                     edgeFadeFlags_, nullptr);
+    }
+    view_ops::copyRowColumnMapBilinear(dst + begin, view_, srcY, colMap_.data() + screenX + begin,
+                                       colWeights_.data() + screenX + begin, static_cast<int_fast16_t>(end - begin));
+    if (end < count) {
+        view_ops::copyRowDDABilinear(dst + end, view_, static_cast<int_fast16_t>(count - end), srcX + invA * end,
+                                     srcY, invA, 0, edgeFadeFlags_, nullptr);
+    }
+    return true;
+}
+
+// ============================================================================
+// SourceNode - 転置キャッシュ（90度/270度回転）
+// ============================================================================
+//
+// a == d == 0 では出力行のソースX座標が一定で、出力1行はソースの1列を縦に読む。
+// ソースの TransposeBlock 列分を転置した帯を作り、出力行は帯の1行を横に読む（Y一定の DDA）。
+// 帯は TransposeBlock x TransposeBlock のタイル単位で作成するため、読み書きともタイル分のキャッシュラインに収まる。
+//
+
+// ソース列 [column, column + columns) × 行 [y0, y1) を転置
+// 帯の行 r（dst + r * dstStride）のピクセル y はソースの (column + r, y)
+// block 行ずつ、タイル内のソース行（columns ピクセル）をキャッシュに載せたまま帯の各行へ連続して書き込む
+template <size_t BytesPerPixel>
+static void transposeColumns(uint8_t *dst, size_t dstStride, const ViewPort &src, int32_t column, int32_t columns,
+                             int32_t y0, int32_t y1, int32_t block)
+{
+    const auto srcStride = static_cast<ptrdiff_t>(src.stride);
+    for (int32_t yb = y0; yb < y1; yb += block) {
+        const int32_t rows = std::min(block, y1 - yb);
+        const auto *tile   = static_cast<const uint8_t *>(src.pixelAt(column, yb));
+        for (int32_t r = 0; r < columns; ++r) {
+            const uint8_t *s = tile + static_cast<size_t>(r) * BytesPerPixel;
+            uint8_t *d       = dst + static_cast<size_t>(r) * dstStride + static_cast<size_t>(yb) * BytesPerPixel;
+            for (int32_t y = 0; y < rows; ++y) {
+                std::memcpy(d, s, BytesPerPixel);
+                s += srcStride;
+                d += BytesPerPixel;
+            }
+        }
+    }
+}
+
+void SourceNode::transposedRow(uint8_t *dst, int_fast16_t count, int_fixed srcX, int_fixed srcY)
+{
+    constexpr int32_t blockMask = TransposeBlock - 1;
+    const int32_t invC          = affine_.invMatrix.c;
+    const auto bpp              = static_cast<size_t>(view_.formatID->bytesPerPixel);
+
+    // 参照するソース行の範囲（座標は単調なので両端で決まる）
+    const int32_t sx     = srcX >> INT_FIXED_SHIFT;
+    const int32_t syHead = srcY >> INT_FIXED_SHIFT;
+    const auto last      = static_cast<uint32_t>(count - 1);
+    const int32_t syTail =
+        static_cast<int32_t>(static_cast<uint32_t>(srcY) + static_cast<uint32_t>(invC) * last) >> INT_FIXED_SHIFT;
+    const int32_t syMin = std::min(syHead, syTail);
+    const int32_t syMax = std::max(syHead, syTail);
+
+    // 帯の行の長さ（ソース高さを TransposeBlock 単位に切り上げ）
+    // 2のべき乗のストライドでは帯の各行が同じキャッシュセットに集中するため、64バイトずらす
+    const size_t stride   = static_cast<size_t>((view_.height + blockMask) & ~blockMask) * bpp + 64;
+    TransposeStrip &strip = transposeStrips_[RenderContext::currentWorkerIndex()];
+    if (strip.pixels.size() != stride * static_cast<size_t>(TransposeBlock)) {
+        strip.pixels.resize(stride * static_cast<size_t>(TransposeBlock));
+        strip.column = -1;
+    }
+
+    const int32_t column = sx & ~blockMask;
+    if (strip.column != column || syMin < strip.y0 || syMax >= strip.y1) {
+        // 要求範囲を含む TransposeBlock 行単位の範囲のみ作成（タイル分割時も各ピクセルを1回だけ読む）
+        const int32_t y0      = syMin & ~blockMask;
+        const int32_t y1      = std::min<int32_t>((syMax + TransposeBlock) & ~blockMask, view_.height);
+        const int32_t columns = std::min<int32_t>(TransposeBlock, view_.width - column);
+        uint8_t *pixels       = strip.pixels.data();
+        switch (bpp) {
+            case 1:
+                transposeColumns<1>(pixels, stride, view_, column, columns, y0, y1, TransposeBlock);
+                break;
+            case 2:
+                transposeColumns<2>(pixels, stride, view_, column, columns, y0, y1, TransposeBlock);
+                break;
+            case 3:
+                transposeColumns<3>(pixels, stride, view_, column, columns, y0, y1, TransposeBlock);
+                break;
+            default:
+                transposeColumns<4>(pixels, stride, view_, column, columns, y0, y1, TransposeBlock);
+                break;
+        }
+        strip.column = column;
+        strip.y0     = y0;
+        strip.y1     = y1;
+    }
+
+    // 帯の行 sx - column を横に読む（元の DDA とX/Yを入れ替えた座標）
+    DDAParam param = {static_cast<int32_t>(stride), view_.height, TransposeBlock, srcY, srcX - (column << INT_FIXED_SHIFT),
+                      invC, 0, nullptr, nullptr};
+    view_.formatID->copyRowDDA(dst, strip.pixels.data(), count, &param);
+}
+
+// ============================================================================
+// SourceNode - 射影変換（3x3 ホモグラフィ）
+// ============================================================================
+//
+// ワールド座標 (x, y) のソース座標は (X / W, Y / W)（(X, Y, W) = perspectiveInv_ × (x, y, 1)）。
+// X, Y, W はスキャンライン上で dx の1次式なので、有効範囲（perspMin <= X / W <= perspMax、W > 0）は
+// X - perspMin * W >= 0 等の1次不等式になり、アフィン変換と同様に半直線の共通部分で求まる。
+// 行内は PerspectiveSpan ピクセル（遠近の強い部分ではより短い区間）ごとに 1 / W を求め、
+// 区間内はソース座標を線形補間した DDA で転写する。区間はスクリーン列の PerspectiveSpan 境界に
+// 揃えるため、リクエストの分割（タイル・差分描画等）によらず同じ列は同じソース座標になる。
+//
+
+void SourceNode::preparePerspective(const PrepareRequest &request, const AffineMatrix &combined,
+                                    PrepareResponse &result)
+{
+    // アフィン変換の事前計算・高速パスはすべて無効化
+    view_                = source_;
+    mipLevel_            = 0;
+    mipBlend_            = 0;
+    affine_              = AffinePrecomputed();
+    hasAffine_           = true;
+    useArea_             = false;
+    useColumnMap_        = false;
+    useTransposeCache_   = false;
+    rowSpanTop_          = 0;
+    rowSpanScreenHeight_ = 0;
+    rowSpans_.clear();
+
+    // 面積平均は縮小の軸が行内で変わるため、Bilinear として扱う
+    useBilinear_ =
+        interpolationMode_ != InterpolationMode::Nearest && view_.formatID && view_.formatID->copyQuadDDA;
+
+    result.status          = PrepareStatus::Prepared;
+    result.preferredFormat = view_.formatID;
+    result.origin          = request.origin;
+
+    // 順変換（pivot 基準のソース座標 → ワールド座標）と、その逆変換
+    const PerspectiveMatrix forward = PerspectiveMatrix(combined) * perspective_;
+    PerspectiveMatrix inverse;
+    if (!forward.inverse(inverse)) {
+        return;  // 特異行列（出力なし）
+    }
+    usePerspective_ = true;
+
+    const float pivotX = fixed_to_float(pivotX_);
+    const float pivotY = fixed_to_float(pivotY_);
+    perspectiveInv_    = PerspectiveMatrix(1, 0, pivotX, 0, 1, pivotY, 0, 0, 1) * inverse;
+
+    // 有効範囲（ピクセル中心）: バイリニアはフェード有効な辺のみ 0.5 ピクセル拡張
+    constexpr int_fixed halfPixel = 1 << (INT_FIXED_SHIFT - 1);
+    const uint8_t fade            = useBilinear_ ? edgeFadeFlags_ : 0;
+    perspMinX_                    = (fade & EdgeFade_Left) ? -halfPixel : 0;
+    perspMinY_                    = (fade & EdgeFade_Top) ? -halfPixel : 0;
+    perspMaxX_                    = to_fixed(view_.width) - 1 + ((fade & EdgeFade_Right) ? halfPixel : 0);
+    perspMaxY_                    = to_fixed(view_.height) - 1 + ((fade & EdgeFade_Bottom) ? halfPixel : 0);
+
+    // AABB: 有効範囲の4角を順変換
+    const float left   = fixed_to_float(perspMinX_) - pivotX;
+    const float right  = fixed_to_float(perspMaxX_ + 1) - pivotX;
+    const float top    = fixed_to_float(perspMinY_) - pivotY;
+    const float bottom = fixed_to_float(perspMaxY_ + 1) - pivotY;
+    const float xs[4]  = {left, right, left, right};
+    const float ys[4]  = {top, top, bottom, bottom};
+    float minX = 0, maxX = 0, minY = 0, maxY = 0;
+    bool bounded = true;
+    for (int i = 0; i < 4 && bounded; ++i) {
+        const float w = forward.px * xs[i] + forward.py * ys[i] + forward.pw;
+        bounded       = w > 0;
+        const float x = (forward.a * xs[i] + forward.b * ys[i] + forward.tx) / w;
+        const float y = (forward.c * xs[i] + forward.d * ys[i] + forward.ty) / w;
+        minX          = i ? std::min(minX, x) : x;
+        maxX          = i ? std::max(maxX, x) : x;
+        minY          = i ? std::min(minY, y) : y;
+        maxY          = i ? std::max(maxY, y) : y;
+    }
+
+    // w <= 0 の角を含む（視点の後ろに回り込む）か、座標範囲を超える場合はスクリーン全体
+    constexpr float limit = 16384.0f;
+    if (!bounded || !(minX > -limit && maxX < limit && minY > -limit && maxY < limit)) {
+        result.width  = request.width;
+        result.height = request.height;
+        return;
+    }
+    result.width    = static_cast<int16_t>(std::ceil(maxX - minX));
+    result.height   = static_cast<int16_t>(std::ceil(maxY - minY));
+    result.origin.x = float_to_fixed(minX);
+    result.origin.y = float_to_fixed(minY);
+}
+
+// 半直線 p + q * dx >= 0 で範囲 [left, right] を制限
+static void clipPerspectiveHalfLine(float p, float q, float &left, float &right)
+{
+    if (q > 0) {
+        left = std::max(left, -p / q);
+    } else if (q < 0) {
+        right = std::min(right, -p / q);
+    } else if (p < 0) {
+        right = -1;
+    }
+}
+
+bool SourceNode::calcPerspectiveRange(const RenderRequest &request, int32_t &dxStart, int32_t &dxEnd) const
+{
+    const PerspectiveMatrix &m = perspectiveInv_;
+
+    // prepare 時の原点の列（スクリーン列 0）のピクセル中心の同次座標
+    // 範囲はスクリーン列で求める（リクエストの分割位置によらず同じ境界になる）
+    const float sx = fixed_to_float(prepareOriginX_) + 0.5f;
+    const float sy = fixed_to_float(request.origin.y) + 0.5f;
+    const float x0 = m.a * sx + m.b * sy + m.tx;
+    const float y0 = m.c * sx + m.d * sy + m.ty;
+    const float w0 = m.px * sx + m.py * sy + m.pw;
+
+    const float minX = fixed_to_float(perspMinX_);
+    const float maxX = fixed_to_float(perspMaxX_);
+    const float minY = fixed_to_float(perspMinY_);
+    const float maxY = fixed_to_float(perspMaxY_);
+
+    const int32_t colStart = from_fixed(request.origin.x - prepareOriginX_);
+    float left             = static_cast<float>(colStart);
+    float right            = static_cast<float>(colStart + request.width - 1);
+    clipPerspectiveHalfLine(w0, m.px, left, right);                           // W >= 0
+    clipPerspectiveHalfLine(x0 - minX * w0, m.a - minX * m.px, left, right);  // X >= minX * W
+    clipPerspectiveHalfLine(maxX * w0 - x0, maxX * m.px - m.a, left, right);  // X <= maxX * W
+    clipPerspectiveHalfLine(y0 - minY * w0, m.c - minY * m.px, left, right);  // Y >= minY * W
+    clipPerspectiveHalfLine(maxY * w0 - y0, maxY * m.px - m.c, left, right);  // Y <= maxY * W
+    if (!(left <= right)) {
+        return false;
+    }
+
+    // 境界の丸め誤差は perspectiveRow のクランプで吸収（範囲外は読まない）
+    dxStart = static_cast<int32_t>(std::ceil(left)) - colStart;
+    dxEnd   = static_cast<int32_t>(std::floor(right)) - colStart;
+    return dxStart <= dxEnd;
+}
+
+// ソース座標（Q16.16 相当の float）を [lo, hi] にクランプして変換（NaN は lo）
+static int_fixed clampPerspectiveCoord(float v, int_fixed lo, int_fixed hi)
+{
+    if (!(v > static_cast<float>(lo))) return lo;
+    if (v >= static_cast<float>(hi)) return hi;
+    return static_cast<int_fixed>(v);
+}
+
+void SourceNode::perspectiveRow(ImageBuffer &output, const RenderRequest &request, int32_t dxStart,
+                                const PixelAuxInfo *aux) const
+{
+    const PerspectiveMatrix &m = perspectiveInv_;
+    const int_fast16_t count   = output.width();
+    const auto bpp             = static_cast<size_t>(output.bytesPerPixel());
+    auto *dst                  = static_cast<uint8_t *>(output.data());
+
+    // 補間の区間と除算位置はスクリーン列（prepare 時の原点基準）に揃える
+    // タイル・差分描画・スパン分割などでリクエストの分割位置が変わっても、同じ列は同じ座標になる
+    const int32_t colStart = from_fixed(request.origin.x - prepareOriginX_) + dxStart;
+    const int32_t colEnd   = colStart + static_cast<int32_t>(count);
+
+    // スクリーン列 0 のピクセル中心の同次座標
+    const float sx = fixed_to_float(prepareOriginX_) + 0.5f;
+    const float sy = fixed_to_float(request.origin.y) + 0.5f;
+    const float x0 = m.a * sx + m.b * sy + m.tx;
+    const float y0 = m.c * sx + m.d * sy + m.ty;
+    const float w0 = m.px * sx + m.py * sy + m.pw;
+
+    // スクリーン列 col のソース座標（除算は 1 / W の1回）
+    // 区間端は有効範囲外のこともあるため、ここでは int_fixed に収まる範囲で飽和させるだけにする
+    constexpr int_fixed coordLimit = 1 << 30;
+    auto sample = [&](int32_t col, int_fixed &u, int_fixed &v) {
+        const auto fc     = static_cast<float>(col);
+        const float scale = static_cast<float>(INT_FIXED_ONE) / (w0 + m.px * fc);
+        u                 = clampPerspectiveCoord((x0 + m.a * fc) * scale, -coordLimit, coordLimit);
+        v                 = clampPerspectiveCoord((y0 + m.c * fc) * scale, -coordLimit, coordLimit);
+    };
+
+    // ViewPortのx,yオフセット、バイリニアはピクセル左上基準
+    constexpr int_fixed halfPixel = 1 << (INT_FIXED_SHIFT - 1);
+    const int_fixed offsetX = (static_cast<int32_t>(view_.x) << INT_FIXED_SHIFT) - (useBilinear_ ? halfPixel : 0);
+    const int_fixed offsetY = (static_cast<int32_t>(view_.y) << INT_FIXED_SHIFT) - (useBilinear_ ? halfPixel : 0);
+
+    // 出力の i ピクセル目から n ピクセルを DDA で転写
+    auto emit = [&](int_fast16_t i, int_fast16_t n, int_fixed u, int_fixed v, int_fixed incrX, int_fixed incrY) {
+        uint8_t *d = dst + static_cast<size_t>(i) * bpp;
+        if (useBilinear_) {
+            view_ops::copyRowDDABilinear(d, view_, n, u + offsetX, v + offsetY, incrX, incrY, edgeFadeFlags_, aux);
+        } else if (view_.formatID->copyRowDDA) {
+            DDAParam param = {view_.stride, view_.width, view_.height, u + offsetX, v + offsetY,
+                              incrX,        incrY,       nullptr,      nullptr};
+            view_.formatID->copyRowDDA(d, static_cast<const uint8_t *>(view_.data), n, &param);
+        }
+    };
+
+    // 補間座標 u + incr * j が有効範囲内か（範囲内の j は区間内で連続する）
+    auto inRange = [&](int_fixed u, int_fixed v, int_fixed incrX, int_fixed incrY, int_fast16_t j) {
+        const int64_t x = static_cast<int64_t>(u) + static_cast<int64_t>(incrX) * j;
+        const int64_t y = static_cast<int64_t>(v) + static_cast<int64_t>(incrY) * j;
+        return x >= perspMinX_ && x <= perspMaxX_ && y >= perspMinY_ && y <= perspMaxY_;
+    };
+
+    // 線形補間の誤差はスクリーン上で約 n^2 * |dW| / (4 * W)（dW: 1ピクセルあたりの W の変化）
+    // 1/8 ピクセルを超えるブロックは区間を短くする（除算が増えるのは遠近の強い部分のみ）
+    const float dw = std::fabs(m.px);
+
+    bool cached       = false;  // 直前の区間終点の座標（次の区間の始点として再利用）
+    int32_t cachedCol = 0;
+    int_fixed cachedU = 0, cachedV = 0;
+    for (int32_t col = colStart; col < colEnd;) {
+        // PerspectiveSpan 境界に揃えたブロック単位で区間長を決める
+        const int32_t blockStart = floorDiv(col, PerspectiveSpan) * PerspectiveSpan;
+        const float wb           = w0 + m.px * static_cast<float>(blockStart);
+        const float wMin         = std::min(wb, wb + m.px * static_cast<float>(PerspectiveSpan));
+        int32_t n                = PerspectiveSpan;
+        while (n > 1 && 2.0f * dw * static_cast<float>(n * n) > wMin) {
+            n >>= 1;
+        }
+        const int32_t spanStart = blockStart + (col - blockStart) / n * n;
+        const int32_t spanEnd   = std::min(spanStart + n, colEnd);
+
+        int_fixed u0 = cachedU, v0 = cachedV;
+        if (!cached || spanStart != cachedCol) {
+            sample(spanStart, u0, v0);
+        }
+        cached          = false;
+        int_fixed incrX = 0, incrY = 0;
+        if (n > 1) {
+            sample(spanStart + n, cachedU, cachedV);
+            cached    = true;
+            cachedCol = spanStart + n;
+            incrX     = static_cast<int_fixed>((static_cast<int64_t>(cachedU) - u0) / n);
+            incrY     = static_cast<int_fixed>((static_cast<int64_t>(cachedV) - v0) / n);
+        }
+
+        // 出力範囲 [col, spanEnd) を区間内の位置 j で表し、有効範囲外の端は1ピクセルずつクランプして転写
+        auto j     = static_cast<int_fast16_t>(col - spanStart);
+        auto jEnd  = static_cast<int_fast16_t>(spanEnd - spanStart);
+        auto pixel = [&](int_fast16_t pj) {
+            const int64_t x = static_cast<int64_t>(u0) + static_cast<int64_t>(incrX) * pj;
+            const int64_t y = static_cast<int64_t>(v0) + static_cast<int64_t>(incrY) * pj;
+            emit(static_cast<int_fast16_t>(spanStart + pj - colStart), 1,
+                 static_cast<int_fixed>(std::min<int64_t>(std::max<int64_t>(x, perspMinX_), perspMaxX_)),
+                 static_cast<int_fixed>(std::min<int64_t>(std::max<int64_t>(y, perspMinY_), perspMaxY_)), 0, 0);
+        };
+        while (j < jEnd && !inRange(u0, v0, incrX, incrY, j)) {
+            pixel(j++);
+        }
+        while (jEnd > j && !inRange(u0, v0, incrX, incrY, static_cast<int_fast16_t>(jEnd - 1))) {
+            pixel(--jEnd);
+        }
+        if (j < jEnd) {
+            emit(static_cast<int_fast16_t>(spanStart + j - colStart), static_cast<int_fast16_t>(jEnd - j),
+                 u0 + incrX * static_cast<int32_t>(j), v0 + incrY * static_cast<int32_t>(j), incrX, incrY);
+        }
+        col = spanEnd;
+    }
+}
+
+// ============================================================================
+// SourceNode - 面積平均（縮小時の補間モード Area）
+// ============================================================================
+//
+// 出力ピクセル (dx, dy) のソース上の矩形は、ピクセル中心 (baseX + invA * dx, baseY) から
+// 半ピクセル分（dxOffsetX, rowOffsetY）戻った端を起点とする |invA| x |invD|。
+// 各軸の重みは矩形の端からの位置を 0〜256 に写した累積値の差で、ソース内の重みの合計は
+// 端数を含めて常に 256 以下（ソース内に収まる矩形では 256）。
+// - 水平方向: ソース行を RGBA8 に変換して (R×A, G×A, B×A, A) にし、列テーブルで出力列ごとに合計
+// - 垂直方向: 水平合計に行の重みを掛けて累積（出力行ごとのアキュムレータ、チャンネルごとの配列）
+// - 正規化: 合計を 1/256 にして RGB = 合計 / A合計、A = A合計 / 256（filters::boxBlurNormalize）
+
+bool SourceNode::prepareRGBA8Converter()
+{
+    PixelFormatID format = source_.formatID;
+    if (!source_.isValid() || !format) {
+        return false;
+    }
+    PixelAuxInfo auxInfo;
+    if (palette_) {
+        auxInfo.palette           = palette_.data;
+        auxInfo.paletteFormat     = palette_.format;
+        auxInfo.paletteColorCount = palette_.colorCount;
+    }
+    auxInfo.colorKeyRGBA8   = colorKeyRGBA8_;
+    auxInfo.colorKeyReplace = colorKeyReplace_;
+    const bool hasColorKey  = colorKeyRGBA8_ != colorKeyReplace_;
+    rgbaConverter_          = resolveConverter(format, PixelFormatIDs::RGBA8_Straight,
+                                               (palette_ || hasColorKey) ? &auxInfo : nullptr);
+    return static_cast<bool>(rgbaConverter_);
+}
+
+// 出力列 count 個の列テーブルを作成（edgeX: 先頭列の端、ソース座標 Q16.16）
+void SourceNode::buildAreaColumns(AreaState &state, int32_t edgeX, int_fast16_t count) const
+{
+    const int32_t invA  = affine_.invMatrix.a;
+    const int32_t len   = invA < 0 ? -invA : invA;
+    const int64_t scale = (int64_t{256} << 32) / len;  // 矩形内の位置 → 0〜256
+    const int32_t width = source_.width;
+
+    // 参照するソース列の範囲（矩形はソース外にはみ出すことがある）
+    const int32_t lastEdge = edgeX + invA * static_cast<int32_t>(count);
+    const int32_t spanL    = std::max<int32_t>(0, from_fixed_floor(std::min(edgeX, lastEdge)));
+    const int32_t spanR    = std::min<int32_t>(width, from_fixed_ceil(std::max(edgeX, lastEdge)));
+
+    state.colFirst.resize(static_cast<size_t>(count));
+    state.colTap.resize(static_cast<size_t>(count) + 1);
+    state.weights.clear();
+    state.colTap[0] = 0;
+    for (int_fast16_t j = 0; j < count; ++j) {
+        const int32_t e0 = edgeX + invA * static_cast<int32_t>(j);
+        const int32_t u0 = invA < 0 ? e0 + invA : e0;
+        const int32_t u1 = u0 + len;
+        const int32_t i0 = std::max<int32_t>(spanL, from_fixed_floor(u0));
+        const int32_t i1 = std::min<int32_t>(spanR, from_fixed_ceil(u1));
+
+        // 累積重み（矩形の左端からの距離を 0〜256 に写す）
+        auto cumulative = [&](int32_t u) {
+            return static_cast<int32_t>((static_cast<int64_t>(u - u0) * scale + (int64_t{1} << 31)) >> 32);
+        };
+        state.colFirst[static_cast<size_t>(j)] = i0 - spanL;
+        for (int32_t i = i0; i < i1; ++i) {
+            const int32_t from = std::max(u0, i << INT_FIXED_SHIFT);
+            const int32_t to   = std::min(u1, (i + 1) << INT_FIXED_SHIFT);
+            state.weights.push_back(static_cast<uint16_t>(cumulative(to) - cumulative(from)));
+        }
+        state.colTap[static_cast<size_t>(j) + 1] = static_cast<uint32_t>(state.weights.size());
+    }
+
+    state.edgeX      = edgeX;
+    state.srcX0      = spanL;
+    state.srcX1      = std::max(spanL, spanR);
+    state.count      = count;
+    state.cachedRow  = -1;
+    state.tableValid = true;
+    state.premul.resize(static_cast<size_t>(state.srcX1 - spanL) * 4);
+    state.rowSum.resize(static_cast<size_t>(count) * 4);
+    state.acc.resize(static_cast<size_t>(count) * 4);
+}
+
+// ソース行 srcY を変換し、列テーブルで水平方向に縮小して rowSum に格納
+void SourceNode::reduceAreaRow(AreaState &state, int32_t srcY) const
+{
+    // ソース列 [srcX0, srcX1) をチャンク単位で RGBA8 に変換し、α加重値 (C×A, A) に展開
+    // bit-packed形式は範囲先頭のビット位置を考慮
+    constexpr int_fast16_t CHUNK_SIZE = 64;
+    uint8_t tempBuf[CHUNK_SIZE * 4];
+    FormatConverter converter       = rgbaConverter_;
+    const int_fast32_t pixelBits    = source_.formatID->bitsPerPixel;
+    const int_fast32_t rowBits      = (source_.x + state.srcX0) * pixelBits;
+    const size_t bytesPerChunk      = static_cast<size_t>(CHUNK_SIZE * pixelBits >> 3);
+    converter.ctx.pixelOffsetInByte = static_cast<uint8_t>((rowBits & 7) >> (pixelBits >> 1));
+
+    const uint8_t *src = static_cast<const uint8_t *>(source_.data) + (source_.y + srcY) * source_.stride +
+                         static_cast<size_t>(rowBits >> 3);
+    const int_fast16_t spanWidth = static_cast<int_fast16_t>(state.srcX1 - state.srcX0);
+    uint16_t *pm                 = state.premul.data();
+    for (int_fast16_t x = 0; x < spanWidth; x += CHUNK_SIZE) {
+        int_fast16_t chunk = std::min<int_fast16_t>(CHUNK_SIZE, spanWidth - x);
+        converter(tempBuf, src, static_cast<size_t>(chunk));
+        for (int_fast16_t i = 0; i < chunk; ++i) {
+            const uint_fast16_t a = tempBuf[i * 4 + 3];
+            pm[0]                 = static_cast<uint16_t>(tempBuf[i * 4 + 0] * a);
+            pm[1]                 = static_cast<uint16_t>(tempBuf[i * 4 + 1] * a);
+            pm[2]                 = static_cast<uint16_t>(tempBuf[i * 4 + 2] * a);
+            pm[3]                 = static_cast<uint16_t>(a);
+            pm += 4;
+        }
+        src += bytesPerChunk;
+    }
+
+    // 出力列ごとの重み付き合計（重みの合計 ≤ 256 のため uint32 に収まる、チャンネルごとの配列に格納）
+    const uint16_t *weights = state.weights.data();
+    const auto count        = static_cast<size_t>(state.count);
+    uint32_t *sumR          = state.rowSum.data();
+    uint32_t *sumG          = sumR + count;
+    uint32_t *sumB          = sumG + count;
+    uint32_t *sumA          = sumB + count;
+    for (size_t j = 0; j < count; ++j) {
+        const uint16_t *p  = state.premul.data() + static_cast<size_t>(state.colFirst[j]) * 4;
+        const uint32_t end = state.colTap[j + 1];
+        uint32_t r = 0, g = 0, b = 0, a = 0;
+        for (uint32_t t = state.colTap[j]; t < end; ++t, p += 4) {
+            const uint32_t w = weights[t];
+            r += w * p[0];
+            g += w * p[1];
+            b += w * p[2];
+            a += w * p[3];
+        }
+        sumR[j] = r;
+        sumG[j] = g;
+        sumB[j] = b;
+        sumA[j] = a;
+    }
+    state.cachedRow = srcY;
+}
+
+void SourceNode::areaAverageRow(uint8_t *dst, int_fast16_t count, int32_t dxStart, int32_t baseX, int32_t baseY)
+{
+    AreaState &state = areaStates_[RenderContext::currentWorkerIndex()];
+
+    // 先頭列・出力行の矩形の端（ピクセル中心から半ピクセル戻す）
+    const int32_t invA  = affine_.invMatrix.a;
+    const int32_t invD  = affine_.invMatrix.d;
+    const int32_t edgeX = baseX - affine_.dxOffsetX + invA * dxStart;
+    const int32_t edgeY = baseY - affine_.rowOffsetY;
+
+    // 列テーブルは先頭列の端と列数のみで決まる（回転なしのため行によらない）
+    if (!state.tableValid || state.edgeX != edgeX || state.count != count) {
+        buildAreaColumns(state, edgeX, count);
+    }
+
+    // 出力行の矩形に掛かるソース行と重み
+    const int32_t lenY   = invD < 0 ? -invD : invD;
+    const int64_t scaleY = (int64_t{256} << 32) / lenY;
+    const int32_t v0     = invD < 0 ? edgeY + invD : edgeY;
+    const int32_t v1     = v0 + lenY;
+    const int32_t rowTop = std::max<int32_t>(0, from_fixed_floor(v0));
+    const int32_t rowEnd = std::min<int32_t>(source_.height, from_fixed_ceil(v1));
+
+    // 累積重み（矩形の上端からの距離を 0〜256 に写す）
+    auto cumulative = [&](int32_t v) {
+        return static_cast<int32_t>((static_cast<int64_t>(v - v0) * scaleY + (int64_t{1} << 31)) >> 32);
+    };
+
+    const size_t n = static_cast<size_t>(count) * 4;
+    uint32_t *acc  = state.acc.data();
+    std::fill(acc, acc + n, 0u);
+    if (state.srcX0 < state.srcX1) {
+        for (int32_t y = rowTop; y < rowEnd; ++y) {
+            const int32_t from = std::max(v0, y << INT_FIXED_SHIFT);
+            const int32_t to   = std::min(v1, (y + 1) << INT_FIXED_SHIFT);
+            const auto wy      = static_cast<uint32_t>(cumulative(to) - cumulative(from));
+            if (wy == 0) continue;
+            // 直前の出力行と共有する境界の行は縮小結果を再利用
+            if (y != state.cachedRow) {
+                reduceAreaRow(state, y);
+            }
+            const uint32_t *sum = state.rowSum.data();
+            for (size_t i = 0; i < n; ++i) {
+                acc[i] += wy * sum[i];
+            }
+        }
+    }
+
+    // 正規化: 重みの合計（65536）を 256 に落としてボックスブラーと共通の正規化を使う
+    // （A = 合計 / 256 は 0〜255、RGB は 255 * A合計 <= 255 * 255 * 256 < 2^24 に制限）
+    const auto plane = static_cast<size_t>(count);
+    uint32_t *accR   = acc;
+    uint32_t *accG   = acc + plane;
+    uint32_t *accB   = acc + plane * 2;
+    uint32_t *accA   = acc + plane * 3;
+    for (size_t j = 0; j < plane; ++j) {
+        const uint32_t a     = accA[j] >> 8;
+        const uint32_t limit = a * 255;
+        accR[j]              = std::min(accR[j] >> 8, limit);
+        accG[j]              = std::min(accG[j] >> 8, limit);
+        accB[j]              = std::min(accB[j] >> 8, limit);
+        accA[j]              = a;
+    }
+    filters::boxBlurNormalize(dst, accR, accG, accB, accA, count, 256);
+}
+
+// ============================================================================
+// SourceNode - ミップマップ
+// ============================================================================
+//
+// レベル L（1以上）は RGBA8_Straight で、サイズは前のレベルの (w + 1) / 2 x (h + 1) / 2。
+// 各ピクセルは前のレベルの 2x2 ピクセルのα加重平均（奇数サイズの端のはみ出し分は透明）。
+// 元画像（レベル0）のパレット・カラーキーはレベル1の作成時に適用する。
+// 必要なレベルまでprepare時に作成し、ソース・カラーキーが変わるまで保持する。
+
+// 縮小率からレベルを選択し、必要なレベルを作成（レベル1以上を使う場合 true）
+// 縮小率 ρ: 出力1ピクセルあたりのソース上の移動量（逆行列の列ベクトルの長さ）の大きい方
+// - Nearest: L = round(log2 ρ)
+// - Linear:  L = floor(log2 ρ)、端数を mipBlend_（1〜255）として L + 1 と合成
+bool SourceNode::selectMipLevel()
+{
+    if (mipmapMode_ == MipmapMode::None || interpolationMode_ == InterpolationMode::Area || !source_.isValid()) {
+        return false;
+    }
+
+    // ソース・カラーキー・アロケータが変わった場合は作り直す
+    if (!mipValid_ || mipAllocator_ != persistentAllocator()) {
+        mipLevels_.clear();
+        mipValid_     = true;
+        mipAllocator_ = persistentAllocator();
+    }
+
+    const float invA = fixed_to_float(affine_.invMatrix.a);
+    const float invB = fixed_to_float(affine_.invMatrix.b);
+    const float invC = fixed_to_float(affine_.invMatrix.c);
+    const float invD = fixed_to_float(affine_.invMatrix.d);
+    const float rho  = std::max(std::sqrt(invA * invA + invC * invC), std::sqrt(invB * invB + invD * invD));
+    if (!(rho > 1.0f)) {
+        return false;
+    }
+    const float lod = std::log2(rho);
+
+    // 最大レベル（1x1 になるまで）
+    int maxLevel = 0;
+    for (int w = source_.width, h = source_.height; w > 1 || h > 1; w = (w + 1) / 2, h = (h + 1) / 2) {
+        ++maxLevel;
+    }
+
+    // トリリニアはバイリニア補間時のみ（レベル0が1chのまま出力されるフォーマットは除く）
+    const bool bilinear = interpolationMode_ == InterpolationMode::Bilinear;
+    int level           = 0;
+    int blend           = 0;
+    if (mipmapMode_ == MipmapMode::Linear && bilinear) {
+        level = static_cast<int>(lod);
+        blend = static_cast<int>((lod - static_cast<float>(level)) * 256.0f + 0.5f);
+        if (blend >= 256) {
+            ++level;
+            blend = 0;
+        }
+        if (level == 0 && view_ops::canUseSingleChannelBilinear(source_.formatID, edgeFadeFlags_)) {
+            blend = 0;
+        }
+    } else {
+        level = static_cast<int>(lod + 0.5f);
+    }
+    if (level >= maxLevel) {
+        level = maxLevel;
+        blend = 0;
+    }
+    if (!ensureMipLevels(blend > 0 ? level + 1 : level)) {
+        return false;
+    }
+
+    mipLevel_ = static_cast<int8_t>(level);
+    mipBlend_ = static_cast<uint16_t>(blend);
+    return level > 0;
+}
+
+// レベル1〜count を作成（作成済みのレベルは再利用）
+bool SourceNode::ensureMipLevels(int count)
+{
+    while (static_cast<int>(mipLevels_.size()) < count) {
+        if (mipLevels_.empty() && !prepareRGBA8Converter()) {
+            return false;
+        }
+        ImageBuffer level =
+            mipLevels_.empty() ? buildMipLevel(source_, true) : buildMipLevel(mipLevels_.back().view(), false);
+        if (!level.isValid()) {
+            return false;
+        }
+        mipLevels_.push_back(std::move(level));
+    }
+    return true;
+}
+
+// src を 1/2 に縮小したレベルを作成（convert: src を rgbaConverter_ で RGBA8 に変換して読む）
+ImageBuffer SourceNode::buildMipLevel(const ViewPort &src, bool convert) const
+{
+    const auto width  = static_cast<int_fast16_t>((src.width + 1) / 2);
+    const auto height = static_cast<int_fast16_t>((src.height + 1) / 2);
+    ImageBuffer level(width, height, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized, persistentAllocator());
+    if (!level.isValid()) {
+        return level;
+    }
+
+    // 変換用の行バッファ（2行分）と、出力1行分のα加重合計（チャンネルごとの配列）
+    const auto srcWidth = static_cast<size_t>(src.width);
+    const auto plane    = static_cast<size_t>(width);
+    std::vector<uint8_t> rows(convert ? srcWidth * 8 : 0);
+    std::vector<uint32_t> sums(plane * 4);
+    uint32_t *sumR = sums.data();
+    uint32_t *sumG = sumR + plane;
+    uint32_t *sumB = sumG + plane;
+    uint32_t *sumA = sumB + plane;
+
+    FormatConverter converter    = rgbaConverter_;
+    const int_fast32_t pixelBits = src.formatID->bitsPerPixel;
+    const int_fast32_t rowBits   = src.x * pixelBits;
+    converter.ctx.pixelOffsetInByte = static_cast<uint8_t>((rowBits & 7) >> (pixelBits >> 1));
+
+    for (int_fast16_t y = 0; y < height; ++y) {
+        std::fill(sums.begin(), sums.end(), 0u);
+        for (int_fast16_t k = 0; k < 2; ++k) {
+            const int_fast16_t sy = y * 2 + k;
+            if (sy >= src.height) break;
+            const uint8_t *row;
+            if (convert) {
+                const uint8_t *p = static_cast<const uint8_t *>(src.data) + (src.y + sy) * src.stride +
+                                   static_cast<size_t>(rowBits >> 3);
+                converter(rows.data() + srcWidth * 4 * static_cast<size_t>(k), p, srcWidth);
+                row = rows.data() + srcWidth * 4 * static_cast<size_t>(k);
+            } else {
+                row = static_cast<const uint8_t *>(src.pixelAt(0, static_cast<int>(sy)));
+            }
+            for (size_t x = 0; x < srcWidth; ++x, row += 4) {
+                const uint32_t a = row[3];
+                sumR[x >> 1] += row[0] * a;
+                sumG[x >> 1] += row[1] * a;
+                sumB[x >> 1] += row[2] * a;
+                sumA[x >> 1] += a;
+            }
+        }
+        // 2x2 の平均（A = 合計 / 4、はみ出した分は透明として数える）
+        filters::boxBlurNormalize(static_cast<uint8_t *>(level.pixelAt(0, static_cast<int>(y))), sumR, sumG, sumB,
+                                  sumA, width, 4);
+    }
+    return level;
+}
+
+// トリリニアの合成: dst = dst * (256 - weight) + coarse * weight（プリマルチプライドで補間）
+void SourceNode::blendMipRow(uint8_t *dst, const uint8_t *coarse, int_fast16_t count, uint_fast16_t weight)
+{
+    const uint_fast32_t w1 = weight;
+    const uint_fast32_t w0 = 256 - weight;
+    for (int_fast16_t x = 0; x < count; ++x, dst += 4, coarse += 4) {
+        const uint_fast32_t a0 = dst[3];
+        const uint_fast32_t a1 = coarse[3];
+        if (a0 == a1) {
+            // 同じアルファ（不透明同士など）は色をそのまま補間
+            dst[0] = static_cast<uint8_t>((dst[0] * w0 + coarse[0] * w1) >> 8);
+            dst[1] = static_cast<uint8_t>((dst[1] * w0 + coarse[1] * w1) >> 8);
+            dst[2] = static_cast<uint8_t>((dst[2] * w0 + coarse[2] * w1) >> 8);
+            continue;
+        }
+        const uint_fast32_t wa0 = a0 * w0;
+        const uint_fast32_t wa1 = a1 * w1;
+        const uint_fast32_t sum = wa0 + wa1;
+        if (sum == 0) {
+            dst[0] = dst[1] = dst[2] = dst[3] = 0;
+            continue;
+        }
+        dst[0] = static_cast<uint8_t>((dst[0] * wa0 + coarse[0] * wa1) / sum);
+        dst[1] = static_cast<uint8_t>((dst[1] * wa0 + coarse[1] * wa1) / sum);
+        dst[2] = static_cast<uint8_t>((dst[2] * wa0 + coarse[2] * wa1) / sum);
+        dst[3] = static_cast<uint8_t>(sum >> 8);
+    }
+}
+
 }  // namespace FLEXIMG_NAMESPACE
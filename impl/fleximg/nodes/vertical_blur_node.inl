@@ -33,11 +33,25 @@ void VerticalBlurNode::prepare(const RenderRequest &screenInfo)
 
 void VerticalBlurNode::finalize()
 {
+    // 差分prepareで次フレームに持ち越す場合: 行キャッシュは保持し、ウィンドウ状態のみ戻す
+    if (keepsPreparedState()) {
+        for (auto &stage : stages_) {
+            resetStageWindow(stage);
+        }
+        for (auto &stages : workerStages_) {
+            for (auto &stage : stages) {
+                resetStageWindow(stage);
+            }
+        }
+        return;
+    }
+
     // パイプラインステージをクリア
     for (auto &stage : stages_) {
         stage.clear();
     }
     stages_.clear();
+    workerStages_.clear();
 
     // 上流origin情報をリセット
     upstreamOriginXSet_ = false;
@@ -45,9 +59,7 @@ void VerticalBlurNode::finalize()
     sourceHeight_       = 0;
 
     // getDataRangeキャッシュをリセット
-    rangeCache_.origin = {INT32_MIN, INT32_MIN};
-    rangeCache_.startX = 0;
-    rangeCache_.endX   = 0;
+    rangeCache_.invalidate();
 }
 
 // ========================================
@@ -66,17 +78,16 @@ DataRange VerticalBlurNode::getDataRange(const RenderRequest &request) const
         return upstream->getDataRange(request);
     }
 
-    // キャッシュチェック
-    if (rangeCache_.origin.x == request.origin.x && rangeCache_.origin.y == request.origin.y) {
-        if (rangeCache_.startX >= rangeCache_.endX) {
-            return DataRange{0, 0};
-        }
-        return DataRange{rangeCache_.startX, rangeCache_.endX};
+    // キャッシュチェック（ワーカー単位）
+    DataRange cached;
+    if (rangeCache_.tryGet(request, cached)) {
+        return cached;
     }
 
     // 垂直ブラーでは、出力行Yに対して入力行 Y-expansion から Y+expansion の
     // X範囲の和集合が必要（expansion = radius * passes）
     // 特にアフィン変換された画像では、各行のX範囲が異なる可能性がある
+    // 注: 行Yのみで決まるため、バンド分割時もウィンドウ状態に依存せず同じ結果になる
     int_fast16_t expansion = radius_ * passes_;
     int16_t startX         = INT16_MAX;
     int16_t endX           = INT16_MIN;
@@ -93,15 +104,11 @@ DataRange VerticalBlurNode::getDataRange(const RenderRequest &request) const
         }
     }
 
-    // キャッシュに保存
-    rangeCache_.origin = request.origin;
-    rangeCache_.startX = startX;
-    rangeCache_.endX   = endX;
+    DataRange result = (startX < endX) ? DataRange{startX, endX} : DataRange{0, 0};
 
-    if (startX >= endX) {
-        return DataRange{0, 0};
-    }
-    return DataRange{startX, endX};
+    // キャッシュに保存
+    rangeCache_.set(request, result);
+    return result;
 }
 
 // ========================================
@@ -140,9 +147,18 @@ PrepareResponse VerticalBlurNode::onPullPrepare(const PrepareRequest &request)
     }
 
     // 上流AABBに基づいてキャッシュを初期化
-    cacheOriginX_ = upstreamResult.origin.x;
+    // upstreamOriginX_は出力のorigin.x計算に使用（アフィン変換で各行のorigin.xが
+    // 異なる場合があるため、AABBのorigin.xに固定する）
+    cacheOriginX_       = upstreamResult.origin.x;
+    upstreamOriginX_    = cacheOriginX_;
+    upstreamOriginXSet_ = true;
     initializeStages(upstreamResult.width);
 
+    // バンド並列用のワーカー別ステージ（各ワーカーが初回使用時に確保）
+    // ここで要素数を確定させ、process中はワーカーが自分の要素のみ触る
+    workerStages_.clear();
+    workerStages_.resize(static_cast<size_t>(RenderContext::MAX_WORKERS - 1));
+
 #ifdef FLEXIMG_DEBUG_PERF_METRICS
     // パイプライン方式: 各ステージ (radius*2+1)*width*4 + width*16
     size_t cacheBytes =
@@ -162,6 +178,11 @@ PrepareResponse VerticalBlurNode::onPullPrepare(const PrepareRequest &request)
 
 PrepareResponse VerticalBlurNode::onPushPrepare(const PrepareRequest &request)
 {
+    // 入力行を順に蓄積して出力するため、バンド並列は不可
+    if (context_) {
+        context_->requireSequential();
+    }
+
     // 下流へ先に伝播してサイズ情報を取得
     Node *downstream = downstreamNode(0);
     PrepareResponse downstreamResult;
@@ -317,17 +338,15 @@ RenderResponse &VerticalBlurNode::pullProcessPipeline(Node *upstream, const Rend
     int_fast16_t requestY = static_cast<int_fast16_t>(from_fixed(request.origin.y));
     // 注: 各ステージの初期化はupdateStageCache内で行われる
 
+    // 処理中ワーカーのステージ列（逐次実行時はstages_）
+    std::vector<BlurStage> &stages = pullStages();
+
     // 最終ステージのキャッシュを更新（再帰的に前段ステージも更新される）
     // updateStageCache内で上流をpullするため、計測はこの後から開始
-    updateStageCache(passes_ - 1, upstream, request, requestY);
+    updateStageCache(stages, passes_ - 1, upstream, request, requestY);
 
     // 有効範囲を取得（キャッシュがあれば再利用）
-    DataRange range;
-    if (rangeCache_.origin.x == request.origin.x && rangeCache_.origin.y == request.origin.y) {
-        range = DataRange{rangeCache_.startX, rangeCache_.endX};
-    } else {
-        range = getDataRange(request);
-    }
+    DataRange range = getDataRange(request);
 
     // 有効なデータがない場合は空を返す（originは維持）
     if (!range.hasData()) {
@@ -365,30 +384,18 @@ RenderResponse &VerticalBlurNode::pullProcessPipeline(Node *upstream, const Rend
     metrics.usedPixels += static_cast<uint64_t>(outputWidth) * 1;
 #endif
 
-    ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized);
+    ImageBuffer output(outputWidth, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized, allocator());
 
 #ifdef FLEXIMG_DEBUG_PERF_METRICS
     metrics.recordAlloc(output.totalBytes(), output.width(), output.height());
 #endif
 
     // 最終ステージの列合計から出力行を計算（有効範囲のみ）
-    BlurStage &lastStage = stages_[static_cast<size_t>(passes_ - 1)];
+    BlurStage &lastStage = stages[static_cast<size_t>(passes_ - 1)];
     uint8_t *outRow      = static_cast<uint8_t *>(output.view().data);
-    int_fast16_t ks      = kernelSize();
-
-    for (int_fast16_t cacheX = srcStartX; cacheX < srcEndX; cacheX++) {
-        size_t outOff = static_cast<size_t>(cacheX - srcStartX) * 4;
-
-        if (lastStage.colSumA[static_cast<size_t>(cacheX)] > 0) {
-            size_t cx          = static_cast<size_t>(cacheX);
-            outRow[outOff]     = static_cast<uint8_t>(lastStage.colSumR[cx] / lastStage.colSumA[cx]);
-            outRow[outOff + 1] = static_cast<uint8_t>(lastStage.colSumG[cx] / lastStage.colSumA[cx]);
-            outRow[outOff + 2] = static_cast<uint8_t>(lastStage.colSumB[cx] / lastStage.colSumA[cx]);
-            outRow[outOff + 3] = static_cast<uint8_t>(lastStage.colSumA[cx] / static_cast<uint32_t>(ks));
-        } else {
-            outRow[outOff] = outRow[outOff + 1] = outRow[outOff + 2] = outRow[outOff + 3] = 0;
-        }
-    }
+    auto cx              = static_cast<size_t>(srcStartX);
+    filters::boxBlurNormalize(outRow, lastStage.colSumR.data() + cx, lastStage.colSumG.data() + cx,
+                              lastStage.colSumB.data() + cx, lastStage.colSumA.data() + cx, outputWidth, kernelSize());
 
     // 出力の origin を計算（バッファ左上のワールド座標）
     Point outputOrigin;
@@ -398,15 +405,24 @@ RenderResponse &VerticalBlurNode::pullProcessPipeline(Node *upstream, const Rend
     return makeResponse(std::move(output), outputOrigin);
 }
 
-void VerticalBlurNode::updateStageCache(int_fast16_t stageIndex, Node *upstream, const RenderRequest &request,
-                                        int_fast16_t newY)
+void VerticalBlurNode::updateStageCache(std::vector<BlurStage> &stages, int_fast16_t stageIndex, Node *upstream,
+                                        const RenderRequest &request, int_fast16_t newY)
 {
-    BlurStage &stage = stages_[static_cast<size_t>(stageIndex)];
+    BlurStage &stage = stages[static_cast<size_t>(stageIndex)];
     int_fast16_t ks  = kernelSize();
 
-    // このステージへの最初の呼び出し時、currentYを調整してキャッシュを完全に充填
-    // newY - kernelSize()
-    // から開始することで、kernelSize()回のループでキャッシュが充填される
+    // ウィンドウの不連続（バンド開始行・部分再描画等で kernelSize 行以上離れた行への移動）
+    // 全スロットが入れ替わるため、逐次スライドせずにウィンドウを作り直す
+    if (stage.cacheReady) {
+        int_fast16_t jump = static_cast<int_fast16_t>(newY - stage.currentY);
+        if (jump >= ks || jump <= -ks) {
+            resetStageWindow(stage);
+        }
+    }
+
+    // このステージへの最初の呼び出し時（バンド開始行を含む）、currentYを調整してキャッシュを完全に充填
+    // newY - kernelSize() から開始することで、kernelSize()回のループでキャッシュが充填される
+    // 前段ステージも同様に再帰的に充填されるため、上方向に radius * passes 行のハロー行が取得される
     if (!stage.cacheReady) {
         stage.currentY   = newY - ks;
         stage.cacheReady = true;
@@ -430,7 +446,7 @@ void VerticalBlurNode::updateStageCache(int_fast16_t stageIndex, Node *upstream,
             fetchRowToStageCache(stage, upstream, request, newSrcY, slot);
         } else {
             // Stage 1以降: 前段ステージから取得
-            fetchRowFromPrevStage(stageIndex, upstream, request, newSrcY, slot);
+            fetchRowFromPrevStage(stages, stageIndex, upstream, request, newSrcY, slot);
         }
 
         // 新しい行を列合計に加算
@@ -462,22 +478,16 @@ void VerticalBlurNode::fetchRowToStageCache(BlurStage &stage, Node *upstream, co
         return;
     }
 
+    RenderContext *ctx     = context();
     RenderResponse &result = upstream->pullProcess(upstreamReq);
     if (!result.isValid()) {
+        ctx->releaseResponse(result);
         return;
     }
 
     // バッファ準備
     consolidateIfNeeded(result);
 
-    // upstreamOriginX_はpullProcessPipelineで出力のorigin.x計算に使用
-    // アフィン変換された場合、各行のorigin.xが異なる可能性があるため、
-    // AABBのorigin.x（cacheOriginX_、onPullPrepareで設定済み）を使用する
-    if (!upstreamOriginXSet_) {
-        upstreamOriginX_    = cacheOriginX_;
-        upstreamOriginXSet_ = true;
-    }
-
     ImageBuffer converted = convertFormat(ImageBuffer(result.buffer()), PixelFormatIDs::RGBA8_Straight);
     ViewPort srcView      = converted.view();
 
@@ -494,39 +504,35 @@ void VerticalBlurNode::fetchRowToStageCache(BlurStage &stage, Node *upstream, co
         std::memcpy(static_cast<uint8_t *>(dstView.data) + dstStartX * 4, srcPtr, static_cast<size_t>(copyWidth) * 4);
     }
 
+    // 行キャッシュへコピー済みのため上流Responseを返却（プール枯渇防止）
+    ctx->releaseResponse(result);
+
     (void)request;  // 現在は未使用（将来の拡張用）
 }
 
-void VerticalBlurNode::fetchRowFromPrevStage(int_fast16_t stageIndex, Node *upstream, const RenderRequest &request,
-                                             int_fast16_t srcY, int_fast16_t cacheIndex)
+void VerticalBlurNode::fetchRowFromPrevStage(std::vector<BlurStage> &stages, int_fast16_t stageIndex, Node *upstream,
+                                             const RenderRequest &request, int_fast16_t srcY, int_fast16_t cacheIndex)
 {
-    BlurStage &stage     = stages_[static_cast<size_t>(stageIndex)];
-    BlurStage &prevStage = stages_[static_cast<size_t>(stageIndex - 1)];
+    BlurStage &stage     = stages[static_cast<size_t>(stageIndex)];
+    BlurStage &prevStage = stages[static_cast<size_t>(stageIndex - 1)];
 
     // 前段ステージのキャッシュを更新
-    updateStageCache(stageIndex - 1, upstream, request, srcY);
+    updateStageCache(stages, stageIndex - 1, upstream, request, srcY);
 
     // 前段ステージの列合計から1行を計算してキャッシュに格納
     ViewPort dstView = stage.rowCache[static_cast<size_t>(cacheIndex)].view();
     uint8_t *dstRow  = static_cast<uint8_t *>(dstView.data);
 
-    // 有効範囲を追跡
+    filters::boxBlurNormalize(dstRow, prevStage.colSumR.data(), prevStage.colSumG.data(), prevStage.colSumB.data(),
+                              prevStage.colSumA.data(), cacheWidth_, kernelSize());
+
+    // 有効範囲（sumA > 0 の列）を追跡
     int16_t startX = static_cast<int16_t>(cacheWidth_);
     int16_t endX   = 0;
-
-    int_fast16_t ks = kernelSize();
     for (size_t x = 0; x < static_cast<size_t>(cacheWidth_); x++) {
-        size_t off = x * 4;
         if (prevStage.colSumA[x] > 0) {
-            dstRow[off]     = static_cast<uint8_t>(prevStage.colSumR[x] / prevStage.colSumA[x]);
-            dstRow[off + 1] = static_cast<uint8_t>(prevStage.colSumG[x] / prevStage.colSumA[x]);
-            dstRow[off + 2] = static_cast<uint8_t>(prevStage.colSumB[x] / prevStage.colSumA[x]);
-            dstRow[off + 3] = static_cast<uint8_t>(prevStage.colSumA[x] / static_cast<uint32_t>(ks));
-            // 有効範囲を更新
             if (static_cast<int16_t>(x) < startX) startX = static_cast<int16_t>(x);
             endX = static_cast<int16_t>(x + 1);
-        } else {
-            dstRow[off] = dstRow[off + 1] = dstRow[off + 2] = dstRow[off + 3] = 0;
         }
     }
 
@@ -554,18 +560,8 @@ void VerticalBlurNode::updateStageColSum(BlurStage &stage, int_fast16_t cacheInd
 void VerticalBlurNode::computeStageOutputRow(BlurStage &stage, ImageBuffer &output, int_fast16_t width)
 {
     uint8_t *outRow = static_cast<uint8_t *>(output.view().data);
-    int_fast16_t ks = kernelSize();
-    for (size_t x = 0; x < static_cast<size_t>(width); x++) {
-        size_t off = x * 4;
-        if (stage.colSumA[x] > 0) {
-            outRow[off]     = static_cast<uint8_t>(stage.colSumR[x] / stage.colSumA[x]);
-            outRow[off + 1] = static_cast<uint8_t>(stage.colSumG[x] / stage.colSumA[x]);
-            outRow[off + 2] = static_cast<uint8_t>(stage.colSumB[x] / stage.colSumA[x]);
-            outRow[off + 3] = static_cast<uint8_t>(stage.colSumA[x] / static_cast<uint32_t>(ks));
-        } else {
-            outRow[off] = outRow[off + 1] = outRow[off + 2] = outRow[off + 3] = 0;
-        }
-    }
+    filters::boxBlurNormalize(outRow, stage.colSumR.data(), stage.colSumG.data(), stage.colSumB.data(),
+                              stage.colSumA.data(), width, kernelSize());
 }
 
 // ========================================
@@ -578,8 +574,10 @@ void VerticalBlurNode::initializeStage(BlurStage &stage, int_fast16_t width)
     stage.rowCache.resize(cacheRows);
     stage.rowOriginX.assign(cacheRows, 0);
     stage.rowDataRange.assign(cacheRows, DataRange{0, 0});  // 空範囲で初期化
+    // 行キャッシュはスキャンラインを跨いで保持するため persistentAllocator から確保
+    core::memory::IAllocator *alloc = persistentAllocator();
     for (size_t i = 0; i < cacheRows; i++) {
-        stage.rowCache[i] = ImageBuffer(width, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero, allocator());
+        stage.rowCache[i] = ImageBuffer(width, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero, alloc);
     }
     stage.colSumR.assign(static_cast<size_t>(width), 0);
     stage.colSumG.assign(static_cast<size_t>(width), 0);
@@ -592,12 +590,45 @@ void VerticalBlurNode::initializeStage(BlurStage &stage, int_fast16_t width)
 void VerticalBlurNode::initializeStages(int_fast16_t width)
 {
     cacheWidth_ = static_cast<int16_t>(width);
-    stages_.resize(static_cast<size_t>(passes_));
+    initializeStages(stages_, width);
+}
+
+void VerticalBlurNode::initializeStages(std::vector<BlurStage> &stages, int_fast16_t width)
+{
+    stages.resize(static_cast<size_t>(passes_));
     for (size_t i = 0; i < static_cast<size_t>(passes_); i++) {
-        initializeStage(stages_[i], width);
+        initializeStage(stages[i], width);
     }
 }
 
+void VerticalBlurNode::resetStageWindow(BlurStage &stage)
+{
+    // 行キャッシュと列合計をゼロに戻す（initializeStage直後と同じ状態）
+    for (auto &row : stage.rowCache) {
+        std::memset(row.view().data, 0, static_cast<size_t>(cacheWidth_) * 4);
+    }
+    std::fill(stage.rowDataRange.begin(), stage.rowDataRange.end(), DataRange{0, 0});
+    std::fill(stage.colSumR.begin(), stage.colSumR.end(), 0u);
+    std::fill(stage.colSumG.begin(), stage.colSumG.end(), 0u);
+    std::fill(stage.colSumB.begin(), stage.colSumB.end(), 0u);
+    std::fill(stage.colSumA.begin(), stage.colSumA.end(), 0u);
+    stage.cacheReady = false;
+}
+
+std::vector<VerticalBlurNode::BlurStage> &VerticalBlurNode::pullStages()
+{
+    auto worker = RenderContext::currentWorkerIndex();
+    if (worker == 0) {
+        return stages_;
+    }
+    // ワーカー1以降: 初回使用時にワーカー自身のアロケータで確保
+    std::vector<BlurStage> &stages = workerStages_[static_cast<size_t>(worker - 1)];
+    if (stages.empty()) {
+        initializeStages(stages, cacheWidth_);
+    }
+    return stages;
+}
+
 // ========================================
 // push型用ヘルパー関数
 // ========================================
@@ -612,20 +643,11 @@ void VerticalBlurNode::propagatePipelineStages()
         BlurStage &stage     = stages_[static_cast<size_t>(s)];
 
         // 前段ステージの列合計から1行を計算
-        ImageBuffer stageInput(cacheWidth_, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized);
+        ImageBuffer stageInput(cacheWidth_, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized, allocator());
         uint8_t *stageRow = static_cast<uint8_t *>(stageInput.view().data);
 
-        for (size_t x = 0; x < static_cast<size_t>(cacheWidth_); x++) {
-            size_t off = x * 4;
-            if (prevStage.colSumA[x] > 0) {
-                stageRow[off]     = static_cast<uint8_t>(prevStage.colSumR[x] / prevStage.colSumA[x]);
-                stageRow[off + 1] = static_cast<uint8_t>(prevStage.colSumG[x] / prevStage.colSumA[x]);
-                stageRow[off + 2] = static_cast<uint8_t>(prevStage.colSumB[x] / prevStage.colSumA[x]);
-                stageRow[off + 3] = static_cast<uint8_t>(prevStage.colSumA[x] / static_cast<uint32_t>(ks));
-            } else {
-                stageRow[off] = stageRow[off + 1] = stageRow[off + 2] = stageRow[off + 3] = 0;
-            }
-        }
+        filters::boxBlurNormalize(stageRow, prevStage.colSumR.data(), prevStage.colSumG.data(),
+                                  prevStage.colSumB.data(), prevStage.colSumA.data(), cacheWidth_, ks);
 
         // 前段の出力行カウントを更新
         prevStage.pushOutputY++;
@@ -663,20 +685,11 @@ void VerticalBlurNode::emitBlurredLinePipeline()
     BlurStage &lastStage = stages_[static_cast<size_t>(passes_ - 1)];
     int_fast16_t ks      = kernelSize();
 
-    ImageBuffer output(cacheWidth_, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized);
+    ImageBuffer output(cacheWidth_, 1, PixelFormatIDs::RGBA8_Straight, InitPolicy::Uninitialized, allocator());
     uint8_t *outRow = static_cast<uint8_t *>(output.view().data);
 
-    for (size_t x = 0; x < static_cast<size_t>(cacheWidth_); x++) {
-        size_t off = x * 4;
-        if (lastStage.colSumA[x] > 0) {
-            outRow[off]     = static_cast<uint8_t>(lastStage.colSumR[x] / lastStage.colSumA[x]);
-            outRow[off + 1] = static_cast<uint8_t>(lastStage.colSumG[x] / lastStage.colSumA[x]);
-            outRow[off + 2] = static_cast<uint8_t>(lastStage.colSumB[x] / lastStage.colSumA[x]);
-            outRow[off + 3] = static_cast<uint8_t>(lastStage.colSumA[x] / static_cast<uint32_t>(ks));
-        } else {
-            outRow[off] = outRow[off + 1] = outRow[off + 2] = outRow[off + 3] = 0;
-        }
-    }
+    filters::boxBlurNormalize(outRow, lastStage.colSumR.data(), lastStage.colSumG.data(), lastStage.colSumB.data(),
+                              lastStage.colSumA.data(), cacheWidth_, ks);
 
     lastStage.pushOutputY++;
 
@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <cstdint>
 
+#include "filters_simd.inl"
+
 namespace FLEXIMG_NAMESPACE {
 namespace filters {
 
@@ -60,5 +62,53 @@ void alpha_line(uint8_t *pixels, int_fast16_t count, const LineFilterParams &par
     }
 }
 
+
+// ========================================================================
+// ボックスブラー正規化
+// ========================================================================
+//
+// n / d（n < 2^25, d >= 1）を逆数 inv = (2^32 - 1) / d の乗算で求める。
+// (n * inv) >> 32 は真の商と等しいか1小さいため、1回の補正で一致する。
+// A / kernelSize の逆数は行ごとに1回だけ計算する。
+//
+
+static inline uint32_t boxBlurDivide(uint32_t n, uint32_t d, uint32_t inv)
+{
+    auto q = static_cast<uint32_t>((static_cast<uint64_t>(n) * inv) >> 32);
+    if (n - q * d >= d) q++;
+    return q;
+}
+
+void boxBlurNormalizeScalar(uint8_t *dst, const uint32_t *sumR, const uint32_t *sumG, const uint32_t *sumB,
+                            const uint32_t *sumA, int_fast16_t count, int_fast16_t kernelSize)
+{
+    auto ks       = static_cast<uint32_t>(kernelSize);
+    uint32_t invK = 0xFFFFFFFFu / ks;
+    for (int_fast16_t x = 0; x < count; x++) {
+        uint32_t a = sumA[x];
+        uint8_t *d = dst + x * 4;
+        if (a > 0) {
+            uint32_t inv = 0xFFFFFFFFu / a;
+            d[0]         = static_cast<uint8_t>(boxBlurDivide(sumR[x], a, inv));
+            d[1]         = static_cast<uint8_t>(boxBlurDivide(sumG[x], a, inv));
+            d[2]         = static_cast<uint8_t>(boxBlurDivide(sumB[x], a, inv));
+            d[3]         = static_cast<uint8_t>(boxBlurDivide(a, ks, invK));
+        } else {
+            d[0] = d[1] = d[2] = d[3] = 0;
+        }
+    }
+}
+
+void boxBlurNormalize(uint8_t *dst, const uint32_t *sumR, const uint32_t *sumG, const uint32_t *sumB,
+                      const uint32_t *sumA, int_fast16_t count, int_fast16_t kernelSize)
+{
+#ifdef FLEXIMG_SIMD_X86
+    static const auto func = selectBoxBlurNormalize();
+    func(dst, sumR, sumG, sumB, sumA, count, kernelSize);
+#else
+    boxBlurNormalizeScalar(dst, sumR, sumG, sumB, sumA, count, kernelSize);
+#endif
+}
+
 }  // namespace filters
 }  // namespace FLEXIMG_NAMESPACE
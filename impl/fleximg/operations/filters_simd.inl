@@ -0,0 +1,76 @@
+/**
+ * @file filters_simd.inl
+ * @brief boxBlurNormalize の SIMD 実装（x86: AVX2）
+ * @see impl/fleximg/operations/filters.inl
+ *
+ * 共通部（有効判定・CPU機能判定）は image/pixel_format/simd_x86.inl
+ * 合計値がSoA（チャンネルごとの配列）で渡されるため、8ピクセル（8列）を1命令で処理する。
+ * 除算は近似逆数（rcpps）の乗算と整数での補正で行い、結果は整数除算と一致する。
+ */
+
+#include "../image/pixel_format/simd_x86.inl"
+
+#ifdef FLEXIMG_SIMD_X86
+
+namespace FLEXIMG_NAMESPACE {
+namespace filters {
+
+using BoxBlurNormalizeFunc = void (*)(uint8_t *, const uint32_t *, const uint32_t *, const uint32_t *,
+                                      const uint32_t *, int_fast16_t, int_fast16_t);
+
+// ========================================================================
+// 商 n / d（8レーン、n < 2^24, 商 <= 255）
+//
+// rcpps の相対誤差は 1.5 * 2^-12 以下のため、n * rcp(d) の切り捨ては
+// 真の商との差が ±1 以内。q * d と n の比較で上下1回ずつ補正する。
+// ========================================================================
+
+__attribute__((target("avx2"))) static inline __m256i boxBlurDivide_avx2(__m256i n, __m256i d, __m256 rcp)
+{
+    __m256i q    = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(n), rcp));
+    __m256i rem  = _mm256_sub_epi32(n, _mm256_mullo_epi32(q, d));
+    __m256i over = _mm256_cmpgt_epi32(_mm256_setzero_si256(), rem);  // rem < 0: 1大きい
+    q            = _mm256_add_epi32(q, over);
+    rem          = _mm256_add_epi32(rem, _mm256_and_si256(over, d));
+    __m256i less = _mm256_cmpgt_epi32(rem, _mm256_sub_epi32(d, _mm256_set1_epi32(1)));  // rem >= d: 1小さい
+    return _mm256_sub_epi32(q, less);
+}
+
+__attribute__((target("avx2"))) static void boxBlurNormalize_avx2(uint8_t *dst, const uint32_t *sumR,
+                                                                  const uint32_t *sumG, const uint32_t *sumB,
+                                                                  const uint32_t *sumA, int_fast16_t count,
+                                                                  int_fast16_t kernelSize)
+{
+    const __m256i ks    = _mm256_set1_epi32(static_cast<int>(kernelSize));
+    const __m256 rcpK   = _mm256_set1_ps(1.0f / static_cast<float>(kernelSize));
+    const __m256i zero  = _mm256_setzero_si256();
+    int_fast16_t x      = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(sumA + x));
+        // sumA == 0 のレーンは rcp が無限大になるが、最後にマスクで 0 にする
+        __m256 rcpA = _mm256_rcp_ps(_mm256_cvtepi32_ps(a));
+        __m256i r   = boxBlurDivide_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(sumR + x)), a, rcpA);
+        __m256i g   = boxBlurDivide_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(sumG + x)), a, rcpA);
+        __m256i b   = boxBlurDivide_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(sumB + x)), a, rcpA);
+        __m256i al  = boxBlurDivide_avx2(a, ks, rcpK);
+        __m256i px  = _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+                                      _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_slli_epi32(al, 24)));
+        px          = _mm256_andnot_si256(_mm256_cmpeq_epi32(a, zero), px);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x * 4), px);
+    }
+    if (x < count) {
+        boxBlurNormalizeScalar(dst + x * 4, sumR + x, sumG + x, sumB + x, sumA + x, count - x, kernelSize);
+    }
+}
+
+// CPU機能に応じた実装を選択（AVX2 > スカラー）
+static BoxBlurNormalizeFunc selectBoxBlurNormalize()
+{
+    if (pixel_format::detail::cpuFeatures().avx2) return boxBlurNormalize_avx2;
+    return boxBlurNormalizeScalar;
+}
+
+}  // namespace filters
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_SIMD_X86
@@ -23,6 +23,7 @@ namespace FLEXIMG_NAMESPACE {
 // は維持）
 // - setTranslation(): tx,ty のみ変更（a,b,c,d は維持）
 // - setMatrix(): 全要素を設定
+// - いずれのセッターも onTransformChanged() を呼ぶ（Node側で markDirty() に接続）
 //
 
 class AffineCapability {
@@ -37,6 +38,7 @@ public:
     void setMatrix(const AffineMatrix &m)
     {
         localMatrix_ = m;
+        onTransformChanged();
     }
     const AffineMatrix &matrix() const
     {
@@ -56,6 +58,7 @@ public:
         localMatrix_.b = -s;
         localMatrix_.c = s;
         localMatrix_.d = c;
+        onTransformChanged();
     }
 
     // スケールを設定（a,b,c,d のみ変更、tx,ty は維持）
@@ -65,6 +68,7 @@ public:
         localMatrix_.b = 0;
         localMatrix_.c = 0;
         localMatrix_.d = sy;
+        onTransformChanged();
     }
 
     // 平行移動を設定（tx,ty のみ変更、a,b,c,d は維持）
@@ -72,6 +76,7 @@ public:
     {
         localMatrix_.tx = tx;
         localMatrix_.ty = ty;
+        onTransformChanged();
     }
 
     // 回転+スケールを設定（a,b,c,d のみ変更、tx,ty は維持）
@@ -83,6 +88,7 @@ public:
         localMatrix_.b = -s * sy;
         localMatrix_.c = s * sx;
         localMatrix_.d = c * sy;
+        onTransformChanged();
     }
 
     // ========================================
@@ -98,6 +104,11 @@ public:
 
 protected:
     AffineMatrix localMatrix_;  // ローカル変換行列（デフォルトは単位行列）
+
+    // 行列変更時のフック（Nodeと併用するクラスで markDirty() を呼ぶ）
+    virtual void onTransformChanged()
+    {
+    }
 };
 
 }  // namespace FLEXIMG_NAMESPACE
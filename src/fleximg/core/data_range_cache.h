@@ -8,6 +8,7 @@
 
 #include "../image/data_range.h"
 #include "../image/render_types.h"
+#include "render_context.h"
 #include "types.h"
 #include <cstdint>
 
@@ -38,6 +39,11 @@ namespace core {
 //     cache_.invalidate();  // 準備フェーズで無効化
 //   }
 //
+// バンド並列実行:
+// - ワーカーごとに独立したスロットを持ち、RenderContext::currentWorkerIndex()
+//   で選択する（ワーカー間でキャッシュを共有しないためロック不要）
+// - invalidate() は全スロットを無効化する（prepare時のみ呼ばれる前提）
+//
 
 class DataRangeCache {
 public:
@@ -49,14 +55,14 @@ public:
     /// @return true=キャッシュヒット, false=キャッシュミス
     bool tryGet(const RenderRequest &request, DataRange &out) const
     {
-        if (!valid_) {
+        const Slot &slot = slots_[RenderContext::currentWorkerIndex()];
+        if (!slot.valid) {
             return false;
         }
-        if (cachedOrigin_.x != request.origin.x || cachedOrigin_.y != request.origin.y ||
-            cachedWidth_ != request.width) {
+        if (slot.origin.x != request.origin.x || slot.origin.y != request.origin.y || slot.width != request.width) {
             return false;
         }
-        out = cachedRange_;
+        out = slot.range;
         return true;
     }
 
@@ -65,29 +71,35 @@ public:
     /// @param range 範囲（値）
     void set(const RenderRequest &request, const DataRange &range)
     {
-        cachedOrigin_ = request.origin;
-        cachedWidth_  = request.width;
-        cachedRange_  = range;
-        valid_        = true;
+        Slot &slot  = slots_[RenderContext::currentWorkerIndex()];
+        slot.origin = request.origin;
+        slot.width  = request.width;
+        slot.range  = range;
+        slot.valid  = true;
     }
 
-    /// @brief キャッシュ無効化（Prepare時に呼び出し）
+    /// @brief キャッシュ無効化（Prepare時に呼び出し、全ワーカー分）
     void invalidate()
     {
-        valid_ = false;
+        for (auto &slot : slots_) {
+            slot.valid = false;
+        }
     }
 
     /// @brief キャッシュが有効か問い合わせ（テスト/デバッグ用）
     bool isValid() const
     {
-        return valid_;
+        return slots_[RenderContext::currentWorkerIndex()].valid;
     }
 
 private:
-    Point cachedOrigin_    = {0, 0};
-    int16_t cachedWidth_   = 0;
-    DataRange cachedRange_ = {0, 0};
-    bool valid_            = false;
+    struct Slot {
+        Point origin    = {0, 0};
+        int16_t width   = 0;
+        DataRange range = {0, 0};
+        bool valid      = false;
+    };
+    Slot slots_[RenderContext::MAX_WORKERS];
 };
 
 }  // namespace core
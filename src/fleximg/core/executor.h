@@ -0,0 +1,59 @@
+/**
+ * @file executor.h
+ * @brief 並列実行インターフェース（バンド並列レンダリング用）
+ */
+
+#ifndef FLEXIMG_CORE_EXECUTOR_H
+#define FLEXIMG_CORE_EXECUTOR_H
+
+#include <cstdint>
+
+#include "common.h"
+
+namespace FLEXIMG_NAMESPACE {
+namespace core {
+
+// ========================================================================
+// IParallelExecutor - 並列実行インターフェース
+// ========================================================================
+//
+// RendererNode のバンド並列実行で使用するタスク実行器。
+// スレッドの生成・管理方法はプラットフォームごとに異なるため、
+// IAllocator と同様にインターフェースとして抽象化している。
+//
+// 実装例:
+// - ThreadPoolExecutor（thread_pool_executor.h、std::thread ベース）
+// - FreeRTOS タスクによる実装（ESP32 デュアルコア等）
+//
+// 契約:
+// - parallelFor() は count 個のタスク func(0..count-1, userData) を実行し、
+//   全タスクの完了を待ってから戻る
+// - 各インデックスはちょうど1回だけ実行される
+// - 実行順序・実行スレッドは保証しない（呼び出し元スレッドで実行してもよい）
+//
+
+class IParallelExecutor {
+public:
+    /// @brief タスク関数（index: 0..count-1）
+    using TaskFunc = void (*)(int_fast16_t index, void *userData);
+
+    virtual ~IParallelExecutor() = default;
+
+    /// @brief count個のタスクを並列実行し、全完了まで待機
+    /// @param count タスク数
+    /// @param func タスク関数
+    /// @param userData タスク関数に渡すユーザーデータ
+    virtual void parallelFor(int_fast16_t count, TaskFunc func, void *userData) = 0;
+
+    /// @brief 同時実行可能なタスク数（呼び出し元スレッドを含む）
+    virtual int_fast16_t concurrency() const = 0;
+};
+
+}  // namespace core
+
+// 親名前空間に公開
+using core::IParallelExecutor;
+
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_CORE_EXECUTOR_H
@@ -9,6 +9,11 @@
 #include <cstddef>
 #include <cstdint>
 
+#ifdef FLEXIMG_TRAP_DEFAULT_ALLOCATOR
+#include <atomic>
+#include <cassert>
+#endif
+
 #ifdef _WIN32
 #include <malloc.h>
 #else
@@ -56,12 +61,20 @@ public:
         static bool enabled = false;
         return enabled;
     }
+
+    // デバッグ用: allocate() の呼び出し回数（トラップ無効時も計数）
+    static std::atomic<uint32_t> &allocationCount()
+    {
+        static std::atomic<uint32_t> count{0};
+        return count;
+    }
 #endif
 
     void *allocate(size_t bytes, size_t alignment = 16) override
     {
 #ifdef FLEXIMG_TRAP_DEFAULT_ALLOCATOR
         // デバッグ用: トラップ有効時にDefaultAllocatorが使われたら停止
+        allocationCount().fetch_add(1, std::memory_order_relaxed);
         if (trapEnabled()) {
             assert(false && "DefaultAllocator::allocate() called - use backtrace to find caller");
         }
@@ -4,6 +4,8 @@
  *
  * 固定サイズブロックのプールを管理し、
  * フラグメンテーションを軽減します。
+ * - PoolAllocator: 単一ブロックサイズ、最大32ブロック（組込み向け）
+ * - SizeClassPoolAllocator: 複数サイズクラス、階層ビットマップ（大きなキャンバス向け）
  */
 
 #ifndef FLEXIMG_CORE_MEMORY_POOL_ALLOCATOR_H
@@ -50,6 +52,7 @@ struct PoolStats {
 // ========================================================================
 //
 // 最大32ブロックまで対応（uint32_tビットマップ制限）
+// それ以上のブロック数が必要な場合は SizeClassPoolAllocator を使用する
 //
 
 class PoolAllocator {
@@ -146,11 +149,169 @@ private:
     bool initialized_ = false;
 };
 
+// ========================================================================
+// SizeClassPoolAllocator - サイズクラス別スラブアロケータ
+// ========================================================================
+//
+// ブロックサイズの異なる複数のサイズクラス（スラブ）を持つプールアロケータ。
+// - 確保は要求サイズが収まる最小のクラスから行い、満杯なら次に大きいクラスを使う
+// - 1回の確保は常に1ブロック（連続ブロック探索なし）
+// - 各クラスの空きブロックは2階層ビットマップで管理し、
+//   サマリワード → 空きワードの ctz 2回で O(1) に空きを発見する
+// - クラスあたり最大 kMaxBlocksPerClass ブロック、最大 kMaxSizeClasses クラス
+//
+// 使用例:
+//   static const SizeClassPoolAllocator::SizeClassConfig classes[] = {
+//       {256, 256}, {1024, 128}, {4096, 64}, {16384, 16}};
+//   size_t bytes = SizeClassPoolAllocator::requiredMemory(classes, 4);
+//   SizeClassPoolAllocator pool;
+//   pool.initialize(memory, classes, 4);  // memoryは16バイト境界、bytes以上
+//   PoolAllocatorAdapter adapter(pool);
+//   renderer.setAllocator(&adapter);
+//
+
+class SizeClassPoolAllocator {
+public:
+    static constexpr size_t kMaxSizeClasses    = 8;
+    static constexpr size_t kWordBits          = 32;
+    static constexpr size_t kMaxWordsPerClass  = 32;  // サマリワード（uint32_t）のビット数
+    static constexpr size_t kMaxBlocksPerClass = kWordBits * kMaxWordsPerClass;
+    static constexpr size_t kBlockAlign        = 16;  // ブロックサイズの丸め単位
+
+    /// @brief サイズクラス設定
+    struct SizeClassConfig {
+        size_t blockSize;   // ブロックサイズ（kBlockAlignの倍数に切り上げ）
+        size_t blockCount;  // ブロック数（最大kMaxBlocksPerClass）
+    };
+
+    SizeClassPoolAllocator() = default;
+
+    // コピー禁止
+    SizeClassPoolAllocator(const SizeClassPoolAllocator &)            = delete;
+    SizeClassPoolAllocator &operator=(const SizeClassPoolAllocator &) = delete;
+
+    /// @brief 設定に必要なメモリサイズを計算
+    /// @param configs サイズクラス設定（blockSize昇順）
+    /// @param count サイズクラス数
+    static size_t requiredMemory(const SizeClassConfig *configs, size_t count);
+
+    /// @brief プールの初期化
+    /// @param memory プール用メモリ領域（外部で確保済み、requiredMemory()以上）
+    /// @param configs サイズクラス設定（blockSize昇順）
+    /// @param count サイズクラス数（最大kMaxSizeClasses）
+    /// @param isPSRAM プールがPSRAMかどうか
+    /// @return 初期化成功ならtrue
+    bool initialize(void *memory, const SizeClassConfig *configs, size_t count, bool isPSRAM = false);
+
+    /// @brief メモリ確保（プールから）
+    /// @param size 確保サイズ
+    /// @return 確保したメモリへのポインタ（失敗時はnullptr）
+    void *allocate(size_t size);
+
+    /// @brief メモリ解放（プールへ）
+    /// @param ptr 解放するメモリのポインタ
+    /// @return プール内のポインタならtrue
+    bool deallocate(void *ptr);
+
+    /// @brief プールがPSRAMかどうか
+    bool isPSRAM() const
+    {
+        return isPSRAM_;
+    }
+
+    /// @brief 初期化済みかどうか
+    bool isInitialized() const
+    {
+        return initialized_;
+    }
+
+    /// @brief サイズクラス数取得
+    size_t sizeClassCount() const
+    {
+        return classCount_;
+    }
+
+    /// @brief 指定クラスのブロックサイズ取得
+    size_t blockSize(size_t classIndex) const
+    {
+        return classIndex < classCount_ ? classes_[classIndex].blockSize : 0;
+    }
+
+    /// @brief 総ブロック数取得
+    size_t blockCount() const;
+
+    /// @brief 使用中ブロック数取得
+    size_t usedBlockCount() const;
+
+    /// @brief 空きブロック数取得
+    size_t freeBlockCount() const
+    {
+        return blockCount() - usedBlockCount();
+    }
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    /// @brief 統計情報取得（デバッグビルド時のみ）
+    /// @note allocatedBitmap は最小クラスの先頭32ブロックの使用状況
+    const PoolStats &stats() const
+    {
+        return stats_;
+    }
+
+    /// @brief 統計情報リセット（デバッグビルド時のみ）
+    void resetStats()
+    {
+        stats_.reset();
+    }
+
+    /// @brief ピーク使用ブロック数のみリセット（デバッグビルド時のみ）
+    void resetPeakStats()
+    {
+        stats_.peakUsedBlocks = 0;
+    }
+#endif
+
+private:
+    // サイズクラス（スラブ）
+    struct SizeClass {
+        uint8_t *base                        = nullptr;  // ブロック領域の先頭
+        size_t blockSize                     = 0;
+        size_t blockCount                    = 0;
+        size_t usedBlocks                    = 0;
+        uint32_t freeSummary                 = 0;   // bit w: freeBits[w] に空きあり
+        uint32_t freeBits[kMaxWordsPerClass] = {};  // bit=1: 空きブロック
+    };
+
+    SizeClass classes_[kMaxSizeClasses];
+    size_t classCount_ = 0;
+    bool isPSRAM_      = false;
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    PoolStats stats_;
+#endif
+    bool initialized_ = false;
+
+    static size_t alignedBlockSize(size_t blockSize)
+    {
+        return (blockSize + kBlockAlign - 1) & ~(kBlockAlign - 1);
+    }
+
+    static int_fast8_t countTrailingZeros(uint32_t value);
+
+#ifdef FLEXIMG_DEBUG_PERF_METRICS
+    // 最小クラスの先頭32ブロックの使用状況（PoolStats::allocatedBitmap用）
+    uint32_t leadingUsedBitmap() const
+    {
+        const SizeClass &cls = classes_[0];
+        uint32_t valid       = (cls.blockCount >= kWordBits) ? ~0U : ((1U << cls.blockCount) - 1);
+        return ~cls.freeBits[0] & valid;
+    }
+#endif
+};
+
 // ========================================================================
 // PoolAllocatorAdapter - IAllocatorインターフェースアダプタ
 // ========================================================================
 //
-// PoolAllocatorをIAllocatorインターフェースでラップします。
+// PoolAllocator / SizeClassPoolAllocator をIAllocatorインターフェースでラップします。
 // - プールから確保できない場合はDefaultAllocatorにフォールバック
 // - FLEXIMG_DEBUG_PERF_METRICS定義時は統計情報を記録
 //
@@ -185,7 +346,22 @@ public:
     /// @param allowFallback
     /// プール確保失敗時にDefaultAllocatorへフォールバックするか
     explicit PoolAllocatorAdapter(PoolAllocator &pool, bool allowFallback = true)
-        : pool_(pool), allowFallback_(allowFallback)
+        : pool_(&pool),
+          allocateFn_(&poolAllocate<PoolAllocator>),
+          deallocateFn_(&poolDeallocate<PoolAllocator>),
+          allowFallback_(allowFallback)
+    {
+    }
+
+    /// @brief コンストラクタ（サイズクラス別プール）
+    /// @param pool 使用するSizeClassPoolAllocator
+    /// @param allowFallback
+    /// プール確保失敗時にDefaultAllocatorへフォールバックするか
+    explicit PoolAllocatorAdapter(SizeClassPoolAllocator &pool, bool allowFallback = true)
+        : pool_(&pool),
+          allocateFn_(&poolAllocate<SizeClassPoolAllocator>),
+          deallocateFn_(&poolDeallocate<SizeClassPoolAllocator>),
+          allowFallback_(allowFallback)
     {
     }
 
@@ -194,7 +370,7 @@ public:
 #ifdef FLEXIMG_DEBUG_PERF_METRICS
         stats_.lastAllocSize = bytes;
 #endif
-        void *ptr = pool_.allocate(bytes);
+        void *ptr = allocateFn_(pool_, bytes);
         if (ptr) {
 #ifdef FLEXIMG_DEBUG_PERF_METRICS
             stats_.poolHits++;
@@ -214,7 +390,7 @@ public:
 
     void deallocate(void *ptr) override
     {
-        if (pool_.deallocate(ptr)) {
+        if (deallocateFn_(pool_, ptr)) {
 #ifdef FLEXIMG_DEBUG_PERF_METRICS
             stats_.poolDeallocs++;
 #endif
@@ -249,7 +425,21 @@ public:
 #endif
 
 private:
-    PoolAllocator &pool_;
+    // プール種別ごとの呼び出し（コンストラクタで選択）
+    template <typename Pool>
+    static void *poolAllocate(void *pool, size_t bytes)
+    {
+        return static_cast<Pool *>(pool)->allocate(bytes);
+    }
+    template <typename Pool>
+    static bool poolDeallocate(void *pool, void *ptr)
+    {
+        return static_cast<Pool *>(pool)->deallocate(ptr);
+    }
+
+    void *pool_;
+    void *(*allocateFn_)(void *pool, size_t bytes);
+    bool (*deallocateFn_)(void *pool, void *ptr);
     bool allowFallback_;
 #ifdef FLEXIMG_DEBUG_PERF_METRICS
     Stats stats_;
@@ -0,0 +1,155 @@
+/**
+ * @file scanline_arena.h
+ * @brief スキャンライン単位で一括解放するバンプポインタアロケータ
+ */
+
+#ifndef FLEXIMG_CORE_MEMORY_SCANLINE_ARENA_H
+#define FLEXIMG_CORE_MEMORY_SCANLINE_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../common.h"
+#include "allocator.h"
+
+namespace FLEXIMG_NAMESPACE {
+namespace core {
+namespace memory {
+
+// ========================================================================
+// ScanlineArenaAllocator - スキャンライン用アリーナアロケータ
+// ========================================================================
+//
+// 1スキャンラインの処理中に確保されるバッファ（RenderResponse、
+// 合成・フィルタの作業バッファ等）をバンプポインタで切り出す。
+// RenderContext::resetScanlineResources() で reset() が呼ばれ、O(1) で巻き戻す。
+//
+// - deallocate() は使用中カウントを減らすだけで、メモリは再利用しない
+// - 現在のチャンクに収まらない場合は上位アロケータから追加チャンクを確保
+// - 追加チャンクが発生した後の reset() で、最大使用量（ハイウォーターマーク）
+//   を収める単一チャンクに統合する。以降の定常状態では上位アロケータを呼ばない
+// - reset() 時に使用中の確保が残っている場合は巻き戻さない（安全側）
+//
+// スキャンラインを跨いで保持するバッファ（VerticalBlurNodeの行キャッシュ等）は
+// RenderContext::persistentAllocator() から確保すること。
+//
+// スレッド安全ではない。バンド並列実行時はワーカーごとに1つ持つ。
+//
+
+class ScanlineArenaAllocator : public IAllocator {
+public:
+    /// @brief コンストラクタ
+    /// @param backing チャンク確保に使う上位アロケータ（nullptrでDefaultAllocator）
+    explicit ScanlineArenaAllocator(IAllocator *backing = nullptr) : backing_(backing)
+    {
+    }
+
+    ~ScanlineArenaAllocator() override
+    {
+        release();
+    }
+
+    // コピー禁止
+    ScanlineArenaAllocator(const ScanlineArenaAllocator &)            = delete;
+    ScanlineArenaAllocator &operator=(const ScanlineArenaAllocator &) = delete;
+
+    void *allocate(size_t bytes, size_t alignment = 16) override;
+    void deallocate(void *ptr) override;
+
+    const char *name() const override
+    {
+        return "ScanlineArenaAllocator";
+    }
+
+    /// @brief 上位アロケータを設定
+    /// @note 変更時は保持中のチャンクを旧アロケータへ返却する
+    void setBacking(IAllocator *backing);
+
+    /// @brief 事前にチャンクを確保（初回スキャンラインの追加確保を避ける）
+    /// @param bytes 確保する容量（現在の容量以下なら何もしない）
+    void reserve(size_t bytes);
+
+    /// @brief 全確保を巻き戻す（スキャンライン終了時）
+    /// @return 巻き戻した場合true（使用中の確保が残っていればfalse）
+    bool reset();
+
+    /// @brief 保持中の全チャンクを上位アロケータへ返却
+    void release();
+
+    // ========================================
+    // 統計情報
+    // ========================================
+
+    /// @brief 保持中のチャンク容量の合計（バイト）
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    /// @brief 前回の reset() 以降に切り出したバイト数（アライメント分を含む）
+    size_t used() const
+    {
+        return used_;
+    }
+
+    /// @brief used() の最大値
+    size_t highWater() const
+    {
+        return highWater_;
+    }
+
+    /// @brief 未解放の確保数
+    size_t liveCount() const
+    {
+        return liveCount_;
+    }
+
+    /// @brief 上位アロケータからのチャンク確保回数（累計）
+    size_t chunkAllocations() const
+    {
+        return chunkAllocations_;
+    }
+
+private:
+    // チャンクヘッダ（データ領域はヘッダ直後から kChunkAlign 境界で開始）
+    struct Chunk {
+        Chunk *next;  // 1つ前に確保したチャンク
+        size_t size;  // データ領域のサイズ
+    };
+
+    static constexpr size_t kChunkAlign   = 16;
+    static constexpr size_t kMinChunkSize = 4096;
+
+    IAllocator *backing_     = nullptr;
+    Chunk *head_             = nullptr;  // 現在切り出し中のチャンク
+    size_t offset_           = 0;        // head_ 内の切り出し位置
+    size_t capacity_         = 0;
+    size_t used_             = 0;
+    size_t highWater_        = 0;
+    size_t liveCount_        = 0;
+    size_t chunkAllocations_ = 0;
+
+    IAllocator &backing() const
+    {
+        return backing_ ? *backing_ : DefaultAllocator::instance();
+    }
+
+    static uint8_t *chunkData(Chunk *chunk)
+    {
+        return reinterpret_cast<uint8_t *>(chunk) + chunkHeaderSize();
+    }
+
+    static constexpr size_t chunkHeaderSize()
+    {
+        return (sizeof(Chunk) + kChunkAlign - 1) & ~(kChunkAlign - 1);
+    }
+
+    // 新しいチャンクを確保して head_ に据える
+    bool pushChunk(size_t minSize);
+};
+
+}  // namespace memory
+}  // namespace core
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_CORE_MEMORY_SCANLINE_ARENA_H
@@ -11,6 +11,11 @@
 #include <vector>
 
 namespace FLEXIMG_NAMESPACE {
+
+namespace filters {
+struct LineKernel;  // operations/filters.h
+}
+
 namespace core {
 
 // ========================================================================
@@ -36,7 +41,11 @@ namespace core {
 
 class Node {
 public:
-    virtual ~Node() = default;
+    // 破棄時は接続を解除（接続先に破棄済みポートへの参照を残さない）
+    virtual ~Node()
+    {
+        disconnectAll();
+    }
 
     // ========================================
     // コピー/ムーブ操作
@@ -78,6 +87,7 @@ public:
             initPorts(static_cast<int_fast16_t>(other.inputs_.size()),
                       static_cast<int_fast16_t>(other.outputs_.size()));
             prepareResponse_.status = PrepareStatus::Idle;
+            preparedValid_          = false;
             context_                = nullptr;
         }
         return *this;
@@ -98,6 +108,7 @@ public:
                 port.owner = this;
             }
             prepareResponse_.status = PrepareStatus::Idle;
+            preparedValid_          = false;
             context_                = nullptr;
         }
         return *this;
@@ -211,8 +222,8 @@ public:
     // 戻り値: RenderContext所有のResponse参照（借用）
     virtual RenderResponse &pullProcess(const RenderRequest &request) final
     {
-        // 共通処理: スキャンライン処理チェック
-        FLEXIMG_ASSERT(request.height == 1, "Scanline processing requires height == 1");
+        // 共通処理: スキャンライン処理チェック（ストリップは対応ノードのみ）
+        FLEXIMG_ASSERT(request.height == 1 || canProcessStrip(), "Strip request to scanline-only node");
         // 共通処理: 準備完了状態チェック
         if (prepareResponse_.status != PrepareStatus::Prepared) {
             return makeEmptyResponse(request.origin);
@@ -239,11 +250,17 @@ public:
         // 共通処理: コンテキストを保持
         context_ = request.context;
 
+        // 共通処理: 差分prepare（自身・要求・上流が前回から不変なら結果を再利用）
+        if (reusePreparedState(request)) {
+            return prepareResponse_;
+        }
+
         // 派生クラスのカスタム処理を呼び出し
         PrepareResponse result = onPullPrepare(request);
 
         // 共通処理: 状態更新・結果キャッシュ
         prepareResponse_ = result;
+        recordPreparedState(request);
         return result;
     }
 
@@ -275,8 +292,8 @@ public:
     // 派生クラスはonPushProcess()をオーバーライド
     virtual void pushProcess(RenderResponse &input, const RenderRequest &request) final
     {
-        // 共通処理: スキャンライン処理チェック
-        FLEXIMG_ASSERT(request.height == 1, "Scanline processing requires height == 1");
+        // 共通処理: スキャンライン処理チェック（ストリップは対応ノードのみ）
+        FLEXIMG_ASSERT(request.height == 1 || canProcessStrip(), "Strip request to scanline-only node");
         // 共通処理: 準備完了状態チェック
         if (prepareResponse_.status != PrepareStatus::Prepared) {
             return;
@@ -364,6 +381,15 @@ public:
         return DataRange{0, 0};  // 上流なしはデータなし
     }
 
+    // このノードのデータ範囲を区間列として out に追加（和集合）
+    // 離れた複数の領域を持つノードが区間の隙間を下流に伝えるために使用
+    // デフォルト: getDataRange() の1区間（区間の隙間を持たないノード）
+    // 派生クラス: 複数の上流を合成するノード（CompositeNode等）はオーバーライド
+    virtual void getDataSpans(const RenderRequest &request, DataRangeList &out) const
+    {
+        out.add(getDataRange(request));
+    }
+
     // このノードの出力データ範囲の上限（AABB由来）を取得
     // 全スキャンラインに共通する最大範囲を返す（バッファサイズ見積もり用）
     // Prepare段階で計算済みのAABBを使用するため、計算コストはほぼゼロ
@@ -372,6 +398,68 @@ public:
         return prepareResponse_.getDataRange(request);
     }
 
+    // ========================================
+    // フィルタ列の融合
+    // ========================================
+
+    // インプレースのラインカーネルを取得（融合可能なノードのみtrueを返す）
+    // RGBA8_Straightの1行をその場で加工し、データ範囲・座標を変えないノードが対象。
+    // RenderContext::isFilterFusionEnabled() 時、連続するカーネルはprepareで
+    // 1つのカーネル列にまとめられ、中間ノードの pullProcess / getDataRange を省略する
+    virtual bool getLineKernel(filters::LineKernel &kernel) const
+    {
+        (void)kernel;
+        return false;
+    }
+
+    // ========================================
+    // ストリップ処理（複数行リクエスト）
+    // ========================================
+
+    // height > 1 のリクエスト（ストリップ）を処理できるか（prepare後に評価）
+    // 対応ノードは複数行のバッファを返す/受け取る。返すバッファは要求内の矩形で、
+    // 全行が同じデータ範囲を持つこと（行ごとに範囲が変わるノードは非対応のまま）
+    // RendererNode::setStripHeight() 指定時、上流・下流の全ノードが対応していれば
+    // ストリップ単位で処理し、1つでも非対応ならスキャンライン単位にフォールバックする
+    virtual bool canProcessStrip() const
+    {
+        return false;
+    }
+
+    // このノードと全上流ノードがストリップ処理可能か
+    bool isPullStripCapable() const;
+
+    // このノードと全下流ノードがストリップ処理可能か
+    bool isPushStripCapable() const;
+
+    // ========================================
+    // 差分描画（ダメージ追跡）
+    // ========================================
+
+    // 出力内容の変更を通知する（変更カウンタを進める）
+    // パラメータ・行列のセッターは自動で呼び出す。画像データの書き換え等、
+    // ノードが検知できない変更の後はアプリケーションから呼び出すこと
+    // RendererNode::setDamageTrackingEnabled() 時、変更されたノードのprepare後AABBの
+    // 前フレームとの和集合がダメージ領域になる
+    void markDirty()
+    {
+        ++revision_;
+    }
+
+    // 変更カウンタ
+    uint32_t revision() const
+    {
+        return revision_;
+    }
+
+    // 上流のダメージがこのノードの出力に波及する範囲の拡張量（ピクセル、片側）
+    // 近傍ピクセルを参照するノード（ブラー等）はオーバーライド
+    virtual void damageMargin(int_fast16_t &marginX, int_fast16_t &marginY) const
+    {
+        marginX = 0;
+        marginY = 0;
+    }
+
     // prepare応答を取得（派生クラスでの判定用）
     const PrepareResponse &lastPrepareResponse() const
     {
@@ -404,25 +492,39 @@ public:
     // コンテキストアクセス
     // ========================================
 
-    // prepare時に設定されたコンテキストを取得
-    // 設定されていない場合はnullptrを返す
+    // 処理中のコンテキストを取得
+    // バンド並列実行中はワーカースレッドにバインドされたコンテキストを優先し、
+    // それ以外はprepare時に設定されたコンテキストを返す（未設定ならnullptr）
+    // 注: process中のResponse取得・バッファ確保は必ずこの関数経由で行うこと
     RenderContext *context() const
     {
-        return context_;
+        RenderContext *bound = RenderContext::boundToCurrentThread();
+        return bound ? bound : context_;
     }
 
-    // prepare時に設定されたアロケータを取得（context経由）
+    // 処理中のアロケータを取得（context経由）
     // 設定されていない場合はnullptrを返す
+    // 注: スキャンラインアリーナ使用時、確保したバッファはスキャンライン終了までに解放すること
     core::memory::IAllocator *allocator() const
     {
-        return context_ ? context_->allocator() : nullptr;
+        RenderContext *ctx = context();
+        return ctx ? ctx->allocator() : nullptr;
+    }
+
+    // スキャンラインを跨いで保持するバッファ用のアロケータを取得（context経由）
+    // 設定されていない場合はnullptrを返す
+    core::memory::IAllocator *persistentAllocator() const
+    {
+        RenderContext *ctx = context();
+        return ctx ? ctx->persistentAllocator() : nullptr;
     }
 
-    // prepare時に設定されたエントリプールを取得（context経由）
+    // 処理中のエントリプールを取得（context経由）
     // 設定されていない場合はnullptrを返す
     ImageBufferEntryPool *entryPool() const
     {
-        return context_ ? context_->entryPool() : nullptr;
+        RenderContext *ctx = context();
+        return ctx ? ctx->entryPool() : nullptr;
     }
 
     // ========================================
@@ -456,6 +558,22 @@ protected:
     // status フィールドで循環参照検出にも使用
     PrepareResponse prepareResponse_;
 
+    // 変更カウンタ（markDirty()で加算、差分描画・差分prepareの変更検知用）
+    uint32_t revision_ = 0;
+
+    // 差分prepare用: 前回 onPullPrepare() を実行した時点の状態
+    // （RenderContext::isIncrementalPrepareEnabled() 時のみ記録）
+    struct PreparedInput {
+        const Node *node;
+        uint32_t generation;
+    };
+    PrepareRequest preparedRequest_;
+    std::vector<PreparedInput> preparedInputs_;  // 上流の接続とprepare世代
+    uint32_t preparedRevision_  = 0;
+    uint32_t preparedEpoch_     = 0;
+    uint32_t prepareGeneration_ = 0;  // onPullPrepare() の実行ごとに加算
+    bool preparedValid_         = false;
+
     // RendererNodeから伝播されるコンテキスト（prepare時に保持、finalize時にクリア）
     // allocator, entryPool 等のパイプラインリソースを統合管理
     RenderContext *context_ = nullptr;
@@ -565,10 +683,30 @@ protected:
         finalize();
     }
 
+    // 差分prepareで前回の結果を再利用できるノードか
+    // onPullPrepare() で入力ポート以外のノード（内部ノード等）を準備するノードはfalseを返す
+    virtual bool isPrepareReusable() const
+    {
+        return true;
+    }
+
+    // 前回の準備結果を次のフレームへ持ち越すか
+    // trueの間、finalize() は準備済みのリソース（キャッシュ等）を解放せず、フレーム単位の状態のみ戻す
+    bool keepsPreparedState() const
+    {
+        return preparedValid_;
+    }
+
     // ========================================
     // ヘルパーメソッド
     // ========================================
 
+    // 差分prepare: 前回の準備結果が使えれば上流を再準備して状態を復元（戻り値: 再利用したか）
+    bool reusePreparedState(const PrepareRequest &request);
+
+    // 差分prepare: onPullPrepare() 実行後の状態を記録
+    void recordPreparedState(const PrepareRequest &request);
+
     // 循環参照チェック（pullPrepare/pushPrepare共通）
     // prepareResponse_.status を参照・更新する
     bool checkPrepareStatus(bool &shouldContinue);
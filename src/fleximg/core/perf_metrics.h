@@ -57,13 +57,17 @@ constexpr int VerticalBlur   = 11;
 constexpr int NinePatch = 12;  // 9patch画像
 // 合成系
 constexpr int Matte = 13;  // マット合成（3入力）
+// キャッシュ系
+constexpr int Cache = 14;  // サブツリー描画結果キャッシュ
+// フィルタ系（追加）
+constexpr int GaussianBlur = 15;  // 2次元ガウスぼかし
 
-constexpr int Count = 14;
+constexpr int Count = 16;
 }  // namespace NodeType
 
 // コンパイル時チェック: 最後のノードタイプ + 1 == Count
 // ノード追加時に Count の更新を忘れるとここでエラーになる
-static_assert(NodeType::Matte + 1 == NodeType::Count,
+static_assert(NodeType::GaussianBlur + 1 == NodeType::Count,
               "NodeType::Count must equal last node type + 1. "
               "Also update demo/web/cpp-sync-types.js NODE_TYPES.");
 static_assert(NodeType::VerticalBlur == 11,
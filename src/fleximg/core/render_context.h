@@ -10,6 +10,24 @@
 #include "../image/render_types.h"
 #include "common.h"
 #include "memory/allocator.h"
+#include "memory/scanline_arena.h"
+
+// ========================================================================
+// 並列ワーカー数の上限（コンパイル時設定）
+// ========================================================================
+//
+// バンド並列実行時のワーカー数上限。ワーカー単位のキャッシュ
+// （DataRangeCache 等）はこの数だけスロットを持つ。
+// デフォルトは組込み環境（デュアルコア想定）で 2、それ以外で 8。
+// 1 を定義すると並列実行が無効化され、スロット分のメモリも節約される。
+//
+#ifndef FLEXIMG_MAX_RENDER_WORKERS
+#if defined(ARDUINO) || defined(ESP_PLATFORM)
+#define FLEXIMG_MAX_RENDER_WORKERS 2
+#else
+#define FLEXIMG_MAX_RENDER_WORKERS 8
+#endif
+#endif
 
 // 前方宣言（循環参照回避）
 namespace FLEXIMG_NAMESPACE {
@@ -28,6 +46,18 @@ namespace core {
 // - PrepareRequest.context経由で全ノードに伝播
 // - 各ノードはcontext_ポインタとして保持
 //
+// バンド並列実行:
+// - RendererNodeがワーカーごとに RenderContext を所有する
+// - ワーカースレッドは処理中のコンテキストを bindToCurrentThread() で登録し、
+//   Node::context() はバインド中のコンテキストを優先して返す
+// - 行の順序に依存する（状態を持つ）ノードは prepare 時に
+//   requireSequential() を呼び、並列実行を抑止する
+//
+// スキャンラインアリーナ:
+// - setScanlineArena() でアリーナを設定すると、allocator() はアリーナを返し、
+//   resetScanlineResources() でアリーナを巻き戻す
+// - スキャンラインを跨いで保持するバッファは persistentAllocator() から確保する
+//
 // 将来の拡張予定:
 // - PerfMetrics*: パフォーマンス計測
 // - TextureCache*: テクスチャキャッシュ
@@ -41,6 +71,10 @@ public:
     static constexpr int MAX_RESPONSES_BITS = 3;  // 2^3 = 8
     static constexpr int MAX_RESPONSES      = 1 << MAX_RESPONSES_BITS;
 
+    /// @brief 並列ワーカー数の上限
+    static constexpr int MAX_WORKERS = FLEXIMG_MAX_RENDER_WORKERS;
+    static_assert(MAX_WORKERS >= 1, "FLEXIMG_MAX_RENDER_WORKERS must be >= 1");
+
     /// @brief エラー種別
     enum class Error {
         None = 0,
@@ -54,12 +88,25 @@ public:
     // アクセサ
     // ========================================
 
-    /// @brief アロケータを取得
+    /// @brief スキャンライン処理用アロケータを取得
+    /// @note アリーナ設定時はアリーナ（resetScanlineResources()まで有効）
     memory::IAllocator *allocator() const
+    {
+        return scanlineArena_ ? static_cast<memory::IAllocator *>(scanlineArena_) : allocator_;
+    }
+
+    /// @brief スキャンラインを跨いで保持するバッファ用のアロケータを取得
+    memory::IAllocator *persistentAllocator() const
     {
         return allocator_;
     }
 
+    /// @brief スキャンラインアリーナを取得（未設定ならnullptr）
+    memory::ScanlineArenaAllocator *scanlineArena() const
+    {
+        return scanlineArena_;
+    }
+
     /// @brief エントリプールを取得
     ImageBufferEntryPool *entryPool() const
     {
@@ -73,16 +120,116 @@ public:
     /// @brief アロケータとエントリプールを一括設定
     /// @param alloc メモリアロケータ
     /// @param pool エントリプール
-    void setup(memory::IAllocator *alloc, ImageBufferEntryPool *pool)
+    /// @param arena スキャンラインアリーナ（nullptrで不使用）
+    void setup(memory::IAllocator *alloc, ImageBufferEntryPool *pool, memory::ScanlineArenaAllocator *arena = nullptr)
     {
-        allocator_ = alloc;
-        entryPool_ = pool;
+        allocator_          = alloc;
+        entryPool_          = pool;
+        scanlineArena_      = arena;
+        sequentialRequired_ = false;
         for (uint_fast8_t i = 0; i < MAX_RESPONSES; ++i) {
-            responsePool_[i].setAllocator(allocator_);
+            responsePool_[i].setAllocator(allocator());
             responsePool_[i].setPool(entryPool_);
         }
     }
 
+    /// @brief ワーカーインデックスを設定（RendererNodeがワーカー用コンテキストに設定）
+    void setWorkerIndex(int_fast16_t index)
+    {
+        workerIndex_ = static_cast<uint8_t>(index);
+    }
+
+    /// @brief ワーカーインデックスを取得（0 = メインコンテキスト）
+    int_fast16_t workerIndex() const
+    {
+        return workerIndex_;
+    }
+
+    // ========================================
+    // バンド並列実行サポート
+    // ========================================
+
+    /// @brief 現在のスレッドにバインドされたコンテキストを取得
+    /// @return バインド中のコンテキスト（未バインドならnullptr）
+    static RenderContext *boundToCurrentThread()
+    {
+        return threadBinding();
+    }
+
+    /// @brief 現在のスレッドにコンテキストをバインド
+    /// @param ctx バインドするコンテキスト（nullptrで解除）
+    /// @return 直前にバインドされていたコンテキスト（復元用）
+    static RenderContext *bindToCurrentThread(RenderContext *ctx)
+    {
+        RenderContext *prev = threadBinding();
+        threadBinding()     = ctx;
+        return prev;
+    }
+
+    /// @brief 現在のスレッドのワーカーインデックスを取得
+    /// @note ワーカー単位キャッシュのスロット選択に使用（未バインドなら0）
+    static int_fast16_t currentWorkerIndex()
+    {
+        RenderContext *ctx = threadBinding();
+        return ctx ? ctx->workerIndex_ : 0;
+    }
+
+    // ========================================
+    // フィルタ列の融合
+    // ========================================
+
+    /// @brief prepare時のフィルタ列の融合を有効化（RendererNodeが設定）
+    void setFilterFusionEnabled(bool enabled)
+    {
+        filterFusion_ = enabled;
+    }
+
+    /// @brief フィルタ列の融合が有効か（ノードがprepare時に参照）
+    bool isFilterFusionEnabled() const
+    {
+        return filterFusion_;
+    }
+
+    // ========================================
+    // 差分prepare
+    // ========================================
+
+    /// @brief 差分prepareを有効化（RendererNodeが設定）
+    void setIncrementalPrepareEnabled(bool enabled)
+    {
+        incrementalPrepare_ = enabled;
+    }
+
+    /// @brief 差分prepareが有効か（ノードがprepare結果の記録・再利用時に参照）
+    bool isIncrementalPrepareEnabled() const
+    {
+        return incrementalPrepare_;
+    }
+
+    /// @brief 全ノードの前回の準備結果を無効化（アロケータ等の設定変更時にRendererNodeが呼ぶ）
+    void invalidatePreparedState()
+    {
+        ++prepareEpoch_;
+    }
+
+    /// @brief 準備結果の世代（invalidatePreparedState() で進む）
+    uint32_t prepareEpoch() const
+    {
+        return prepareEpoch_;
+    }
+
+    /// @brief 逐次実行を要求（行の処理順序に依存するノードがprepare時に呼ぶ）
+    void requireSequential()
+    {
+        sequentialRequired_ = true;
+    }
+
+    /// @brief 逐次実行が要求されているか
+    bool isSequentialRequired() const
+    {
+        return sequentialRequired_;
+    }
+
     // ========================================
     // ValidSegmentsプール（バンプアロケータ）
     // ========================================
@@ -125,7 +272,7 @@ public:
         // フォールバック: 最後のエントリを強制再利用（エラー状態）
         RenderResponse &fallback = responsePool_[MAX_RESPONSES - 1];
         fallback.setPool(entryPool_);
-        fallback.setAllocator(allocator_);
+        fallback.setAllocator(allocator());
         fallback.clear();
         return fallback;
     }
@@ -171,6 +318,11 @@ public:
         }
         nextHint_      = 0;
         segmentOffset_ = 0;
+
+        // 全Responseを返却した後でアリーナを巻き戻す
+        if (scanlineArena_) {
+            scanlineArena_->reset();
+        }
     }
 
     // ========================================
@@ -196,13 +348,26 @@ public:
     }
 
 private:
-    memory::IAllocator *allocator_   = nullptr;
-    ImageBufferEntryPool *entryPool_ = nullptr;
+    memory::IAllocator *allocator_                 = nullptr;
+    ImageBufferEntryPool *entryPool_               = nullptr;
+    memory::ScanlineArenaAllocator *scanlineArena_ = nullptr;
 
     // RenderResponseプール（ImageBufferEntryPoolと同様の管理）
     RenderResponse responsePool_[MAX_RESPONSES];
-    Error error_           = Error::None;
-    uint_fast8_t nextHint_ = 0;  // 次回探索開始位置（循環探索用）
+    Error error_             = Error::None;
+    uint_fast8_t nextHint_   = 0;      // 次回探索開始位置（循環探索用）
+    uint8_t workerIndex_     = 0;      // ワーカーインデックス（0 = メイン）
+    bool sequentialRequired_ = false;  // 逐次実行要求フラグ
+    bool filterFusion_       = false;  // フィルタ列の融合有効フラグ
+    bool incrementalPrepare_ = false;  // 差分prepare有効フラグ
+    uint32_t prepareEpoch_   = 0;      // 準備結果の世代
+
+    // スレッドごとのバインド先コンテキスト
+    static RenderContext *&threadBinding()
+    {
+        static thread_local RenderContext *s_bound = nullptr;
+        return s_bound;
+    }
 
     // ValidSegmentsプール（バンプアロケータ）
     // CompositeNode等がImageBufferのvalidSegments追跡用に借用する
@@ -0,0 +1,164 @@
+/**
+ * @file thread_pool_executor.h
+ * @brief std::thread ベースの IParallelExecutor 実装（ヘッダオンリー）
+ *
+ * std::thread を利用できる環境（PC / ESP32 Arduino 等）向けのスレッドプール。
+ * fleximg.cpp には含まれないため、使用する側で明示的にインクルードする。
+ * リンク時に -pthread が必要な環境がある。
+ */
+
+#ifndef FLEXIMG_CORE_THREAD_POOL_EXECUTOR_H
+#define FLEXIMG_CORE_THREAD_POOL_EXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "executor.h"
+
+namespace FLEXIMG_NAMESPACE {
+namespace core {
+
+// ========================================================================
+// ThreadPoolExecutor - 固定スレッド数のスレッドプール
+// ========================================================================
+//
+// threadCount-1 本のワーカースレッドを常駐させ、parallelFor() 呼び出し元の
+// スレッドも含めた threadCount 並列でタスクを処理する。
+// タスクはアトミックカウンタで動的に割り当てる（負荷の偏りを吸収）。
+//
+// 使用例:
+//   ThreadPoolExecutor executor(4);
+//   renderer.setParallelExecutor(&executor);
+//   renderer.exec();
+//
+
+class ThreadPoolExecutor : public IParallelExecutor {
+public:
+    /// @brief コンストラクタ
+    /// @param threadCount 並列数（呼び出し元スレッドを含む、0以下でハードウェアスレッド数）
+    explicit ThreadPoolExecutor(int_fast16_t threadCount = 0)
+    {
+        if (threadCount <= 0) {
+            threadCount = static_cast<int_fast16_t>(std::thread::hardware_concurrency());
+            if (threadCount <= 0) threadCount = 1;
+        }
+        concurrency_ = threadCount;
+        threads_.reserve(static_cast<size_t>(threadCount - 1));
+        for (int_fast16_t i = 1; i < threadCount; ++i) {
+            threads_.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~ThreadPoolExecutor() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wakeCv_.notify_all();
+        for (auto &t : threads_) {
+            t.join();
+        }
+    }
+
+    // コピー・ムーブ禁止（ワーカーが this を参照するため）
+    ThreadPoolExecutor(const ThreadPoolExecutor &)            = delete;
+    ThreadPoolExecutor &operator=(const ThreadPoolExecutor &) = delete;
+
+    void parallelFor(int_fast16_t count, TaskFunc func, void *userData) override
+    {
+        if (count <= 0 || !func) return;
+
+        // ワーカーなし or 単一タスク: 呼び出し元で直接実行
+        if (threads_.empty() || count == 1) {
+            for (int_fast16_t i = 0; i < count; ++i) {
+                func(i, userData);
+            }
+            return;
+        }
+
+        // ジョブ設定（ワーカーはロック取得後に参照するため可視性は保証される）
+        // 前回ジョブに遅れて起床したワーカーが残っていれば離脱を待つ
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            doneCv_.wait(lock, [this]() { return active_ == 0; });
+            func_     = func;
+            userData_ = userData;
+            count_    = count;
+            next_.store(0, std::memory_order_relaxed);
+            ++generation_;
+        }
+        wakeCv_.notify_all();
+
+        // 呼び出し元スレッドもタスクを処理
+        runTasks();
+
+        // 全タスクの割り当て済み + 実行中ワーカーなし = 完了
+        std::unique_lock<std::mutex> lock(mutex_);
+        doneCv_.wait(lock, [this]() { return active_ == 0; });
+    }
+
+    int_fast16_t concurrency() const override
+    {
+        return concurrency_;
+    }
+
+private:
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wakeCv_;  // ジョブ開始通知
+    std::condition_variable doneCv_;  // ワーカー処理完了通知
+
+    // 現在のジョブ（mutex_ で保護、実行中は不変）
+    TaskFunc func_       = nullptr;
+    void *userData_      = nullptr;
+    int_fast16_t count_  = 0;
+    uint32_t generation_ = 0;  // ジョブ世代（ワーカーの起床判定用）
+    int_fast16_t active_ = 0;  // ジョブ処理中のワーカー数
+    bool stop_           = false;
+
+    std::atomic<int_fast16_t> next_{0};  // 次に割り当てるタスクインデックス
+    int_fast16_t concurrency_ = 1;
+
+    void runTasks()
+    {
+        for (;;) {
+            auto index = next_.fetch_add(1, std::memory_order_relaxed);
+            if (index >= count_) break;
+            func_(index, userData_);
+        }
+    }
+
+    void workerLoop()
+    {
+        uint32_t seenGeneration = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeCv_.wait(lock, [&]() { return stop_ || generation_ != seenGeneration; });
+                if (stop_) return;
+                seenGeneration = generation_;
+                ++active_;
+            }
+            runTasks();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --active_;
+            }
+            doneCv_.notify_all();
+        }
+    }
+};
+
+}  // namespace core
+
+// 親名前空間に公開
+using core::ThreadPoolExecutor;
+
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_CORE_THREAD_POOL_EXECUTOR_H
@@ -223,6 +223,81 @@ struct AffineMatrix {
     }
 };
 
+// ========================================================================
+// PerspectiveMatrix - 射影変換行列（3x3 ホモグラフィ）
+// ========================================================================
+//
+// | a   b   tx |    x' = (a * x + b * y + tx) / w
+// | c   d   ty |    y' = (c * x + d * y + ty) / w
+// | px  py  pw |    w  =  px * x + py * y + pw
+//
+// px = py = 0, pw = 1 でアフィン変換と同じ。
+//
+
+struct PerspectiveMatrix {
+    float a = 1, b = 0, tx = 0;
+    float c = 0, d = 1, ty = 0;
+    float px = 0, py = 0, pw = 1;
+
+    PerspectiveMatrix() = default;
+    PerspectiveMatrix(float a_, float b_, float tx_, float c_, float d_, float ty_, float px_, float py_, float pw_)
+        : a(a_), b(b_), tx(tx_), c(c_), d(d_), ty(ty_), px(px_), py(py_), pw(pw_)
+    {
+    }
+    explicit PerspectiveMatrix(const AffineMatrix &m) : a(m.a), b(m.b), tx(m.tx), c(m.c), d(m.d), ty(m.ty)
+    {
+    }
+
+    // 単位行列
+    static PerspectiveMatrix identity()
+    {
+        return {};
+    }
+
+    // Y軸回りの回転（ラジアン）を、平面から distance 離れた視点で透視投影（左右のカードめくり）
+    // 原点（pivot）を通る縦軸で回転し、radians > 0 で右側が奥に遠ざかる
+    static PerspectiveMatrix rotateY(float radians, float distance)
+    {
+        return {std::cos(radians), 0, 0, 0, 1, 0, std::sin(radians) / distance, 0, 1};
+    }
+
+    // X軸回りの回転（ラジアン）を透視投影（上下のカードめくり）、radians > 0 で下側が奥に遠ざかる
+    static PerspectiveMatrix rotateX(float radians, float distance)
+    {
+        return {1, 0, 0, 0, std::cos(radians), 0, 0, std::sin(radians) / distance, 1};
+    }
+
+    // 行列の乗算（合成）: this * other
+    PerspectiveMatrix operator*(const PerspectiveMatrix &o) const
+    {
+        return PerspectiveMatrix(a * o.a + b * o.c + tx * o.px, a * o.b + b * o.d + tx * o.py,
+                                 a * o.tx + b * o.ty + tx * o.pw,  // 1行目
+                                 c * o.a + d * o.c + ty * o.px, c * o.b + d * o.d + ty * o.py,
+                                 c * o.tx + d * o.ty + ty * o.pw,  // 2行目
+                                 px * o.a + py * o.c + pw * o.px, px * o.b + py * o.d + pw * o.py,
+                                 px * o.tx + py * o.ty + pw * o.pw  // 3行目
+        );
+    }
+
+    // 逆行列（余因子行列 / 行列式）、特異行列の場合は false
+    bool inverse(PerspectiveMatrix &out) const
+    {
+        const float ca  = d * pw - ty * py;
+        const float cc  = ty * px - c * pw;
+        const float cpx = c * py - d * px;
+        const float det = a * ca + b * cc + tx * cpx;
+        if (std::abs(det) < 1e-10f) {
+            return false;
+        }
+        const float invDet = 1.0f / det;
+        out = PerspectiveMatrix(ca * invDet, (tx * py - b * pw) * invDet, (b * ty - tx * d) * invDet,  // 1行目
+                                cc * invDet, (a * pw - tx * px) * invDet, (tx * c - a * ty) * invDet,  // 2行目
+                                cpx * invDet, (b * px - a * py) * invDet, (a * d - b * c) * invDet     // 3行目
+        );
+        return true;
+    }
+};
+
 // ========================================================================
 // 行列変換関数
 // ========================================================================
@@ -328,7 +403,7 @@ inline AffinePrecomputed precomputeInverseAffine(const AffineMatrix &m)
 // 既存コードの移行には MIGRATION_GUIDE.md を参照してください。
 //
 // 削除予定の using:
-// - AffineMatrix, AffinePrecomputed
+// - AffineMatrix, AffinePrecomputed, PerspectiveMatrix
 // - int_fixed, INT_FIXED_* constants
 // - Point, Matrix2x2, Matrix2x2_fixed
 // - 数値関数 (div_fixed, mul_fixed, fixed_to_float, float_to_fixed, etc.)
@@ -351,6 +426,7 @@ using core::inverseFixed;
 using core::Matrix2x2;
 using core::Matrix2x2_fixed;
 using core::mul_fixed;
+using core::PerspectiveMatrix;
 using core::Point;
 using core::precomputeInverseAffine;
 using core::to_fixed;
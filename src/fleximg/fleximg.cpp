@@ -15,9 +15,12 @@
 #include "core/affine_capability.h"
 #include "core/memory/platform.h"
 #include "core/memory/pool_allocator.h"
+#include "core/memory/scanline_arena.h"
 #include "core/node.h"
 
 // Image
+#include "image/damage_region.h"
+#include "image/data_range.h"
 #include "image/pixel_format.h"
 #include "image/viewport.h"
 
@@ -26,9 +29,11 @@
 
 // Nodes
 #include "nodes/affine_node.h"
+#include "nodes/cache_node.h"
 #include "nodes/composite_node.h"
 #include "nodes/distributor_node.h"
 #include "nodes/filter_node_base.h"
+#include "nodes/gaussian_blur_node.h"
 #include "nodes/horizontal_blur_node.h"
 #include "nodes/matte_node.h"
 #include "nodes/ninepatch_source_node.h"
@@ -44,9 +49,12 @@
 // Core
 #include "../../impl/fleximg/core/memory/platform.inl"
 #include "../../impl/fleximg/core/memory/pool_allocator.inl"
+#include "../../impl/fleximg/core/memory/scanline_arena.inl"
 #include "../../impl/fleximg/core/node.inl"
 
 // Image
+#include "../../impl/fleximg/image/damage_region.inl"
+#include "../../impl/fleximg/image/data_range.inl"
 #include "../../impl/fleximg/image/pixel_format.inl"
 #include "../../impl/fleximg/image/viewport.inl"
 
@@ -55,9 +63,11 @@
 
 // Nodes
 #include "../../impl/fleximg/nodes/affine_node.inl"
+#include "../../impl/fleximg/nodes/cache_node.inl"
 #include "../../impl/fleximg/nodes/composite_node.inl"
 #include "../../impl/fleximg/nodes/distributor_node.inl"
 #include "../../impl/fleximg/nodes/filter_node_base.inl"
+#include "../../impl/fleximg/nodes/gaussian_blur_node.inl"
 #include "../../impl/fleximg/nodes/horizontal_blur_node.inl"
 #include "../../impl/fleximg/nodes/matte_node.inl"
 #include "../../impl/fleximg/nodes/ninepatch_source_node.inl"
@@ -0,0 +1,136 @@
+/**
+ * @file damage_region.h
+ * @brief 差分描画用のダメージ領域（スクリーン座標の矩形集合）
+ */
+
+#ifndef FLEXIMG_DAMAGE_REGION_H
+#define FLEXIMG_DAMAGE_REGION_H
+
+#include <algorithm>
+#include <cstdint>
+
+#include "../core/common.h"
+#include "data_range.h"
+
+namespace FLEXIMG_NAMESPACE {
+
+// ========================================================================
+// DamageRect - ダメージ矩形（スクリーン座標、右・下端は排他）
+// ========================================================================
+//
+// 画面外にはみ出した座標もそのまま保持する（マージン拡張で画面内に掛かる場合があるため）。
+// 画面へのクリップは DamageRegion::clip() で行う。
+
+// ダメージ座標をint16_tに飽和させる
+inline int16_t clampDamageCoord(int32_t v)
+{
+    return static_cast<int16_t>(std::min<int32_t>(std::max<int32_t>(v, INT16_MIN), INT16_MAX));
+}
+
+struct DamageRect {
+    int16_t x0 = 0;
+    int16_t y0 = 0;
+    int16_t x1 = 0;
+    int16_t y1 = 0;
+
+    bool empty() const
+    {
+        return x0 >= x1 || y0 >= y1;
+    }
+
+    int32_t area() const
+    {
+        return empty() ? 0 : static_cast<int32_t>(x1 - x0) * static_cast<int32_t>(y1 - y0);
+    }
+
+    bool intersects(const DamageRect &other) const
+    {
+        return x0 < other.x1 && other.x0 < x1 && y0 < other.y1 && other.y0 < y1;
+    }
+
+    bool contains(const DamageRect &other) const
+    {
+        return x0 <= other.x0 && y0 <= other.y0 && other.x1 <= x1 && other.y1 <= y1;
+    }
+
+    // 両方を含む最小の矩形
+    DamageRect united(const DamageRect &other) const;
+
+    // 共通部分（交差しなければ空）
+    DamageRect intersected(const DamageRect &other) const;
+};
+
+// ========================================================================
+// DamageRegion - ダメージ領域
+// ========================================================================
+//
+// 前フレームから変化したスクリーン領域を、固定上限の矩形集合で保持する。
+// RendererNode の差分描画で、再描画するスキャンラインとX区間の決定に使用。
+//
+// - 重なる矩形は外接矩形に統合する
+// - 上限（MAX_RECTS）を超える場合は、面積の増加が最小になる矩形と統合する
+// - 統合により実際の変化より広くなることはあるが、狭くなることはない
+//
+
+class DamageRegion {
+public:
+    /// @brief 保持する矩形の上限
+    static constexpr int MAX_RECTS = 8;
+
+    /// @brief 空にする
+    void clear()
+    {
+        count_ = 0;
+    }
+
+    /// @brief 矩形を追加
+    void add(const DamageRect &rect);
+
+    /// @brief 別の領域の全矩形を追加
+    void add(const DamageRegion &other);
+
+    /// @brief 各矩形を上下左右に拡張（ブラー等の影響範囲）
+    void expand(int_fast16_t marginX, int_fast16_t marginY);
+
+    /// @brief 各矩形を指定矩形内にクリップ（空になった矩形は除去）
+    void clip(const DamageRect &bounds);
+
+    bool empty() const
+    {
+        return count_ == 0;
+    }
+
+    int count() const
+    {
+        return count_;
+    }
+
+    const DamageRect &rect(int index) const
+    {
+        return rects_[index];
+    }
+
+    /// @brief 全矩形の外接矩形
+    DamageRect bounds() const;
+
+    /// @brief 全矩形の面積の合計（矩形は互いに重ならない）
+    int32_t area() const;
+
+    /// @brief 行範囲 [y0, y1) と交差するX区間を列挙（昇順、重なりは統合）
+    /// @param out 出力先（maxSpans 要素以上）
+    /// @return 区間数
+    int_fast16_t spans(int_fast16_t y0, int_fast16_t y1, DataRange *out, int_fast16_t maxSpans) const;
+
+private:
+    DamageRect rects_[MAX_RECTS];
+    int count_ = 0;
+
+    void removeAt(int index)
+    {
+        rects_[index] = rects_[--count_];
+    }
+};
+
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_DAMAGE_REGION_H
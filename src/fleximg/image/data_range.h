@@ -28,6 +28,44 @@ struct DataRange {
     }
 };
 
+// ========================================================================
+// DataRangeList - 有効データ範囲の区間列（X方向）
+// ========================================================================
+//
+// 離れた複数の領域（画面の両端のスプライト等）を1つの外接範囲にまとめず、
+// 区間ごとに扱うための小さな区間列。区間は昇順・非重複・非隣接に保たれる。
+// - 格納領域は呼び出し側が用意する（通常は RenderContext::acquireSegments()）
+// - 容量を超える場合は最も狭い隙間を埋めて統合する（範囲は狭めない）
+//
+
+struct DataRangeList {
+    DataRange *spans      = nullptr;
+    int_fast16_t count    = 0;
+    int_fast16_t capacity = 0;
+
+    DataRangeList() = default;
+    DataRangeList(DataRange *storage, int_fast16_t storageCapacity) : spans(storage), capacity(storageCapacity)
+    {
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    // 区間を追加（重なる・隣接する区間と統合）
+    void add(DataRange range);
+
+    // 幅 minGap 未満の隙間を埋めて区間を統合
+    void closeGaps(int_fast16_t minGap);
+
+    // 全区間の外接範囲
+    DataRange bounds() const
+    {
+        return count > 0 ? DataRange{spans[0].startX, spans[count - 1].endX} : DataRange{};
+    }
+};
+
 }  // namespace FLEXIMG_NAMESPACE
 
 #endif  // FLEXIMG_DATA_RANGE_H
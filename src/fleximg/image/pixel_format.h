@@ -255,6 +255,12 @@ void copyRowDDA_2Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count,
 void copyRowDDA_3Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param);
 void copyRowDDA_4Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param);
 
+// スカラー版 DDA転写関数（SIMD版との比較・検証用）
+// 上記の 1/2/4 バイト版は x86 (AVX2) で SIMD 版を使用する。SIMD無効時は同一の処理
+void copyRowDDA_1ByteScalar(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param);
+void copyRowDDA_2ByteScalar(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param);
+void copyRowDDA_4ByteScalar(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param);
+
 // BytesPerPixel別 DDA 4ピクセル抽出関数（前方宣言）
 void copyQuadDDA_1Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param);
 void copyQuadDDA_2Byte(uint8_t *dst, const uint8_t *srcData, int_fast16_t count, const DDAParam *param);
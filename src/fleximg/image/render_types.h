@@ -118,6 +118,21 @@ struct PrepareRequest {
 
     // 希望フォーマット（下流から上流へ伝播、フォーマット交渉用）
     PixelFormatID preferredFormat = PixelFormatIDs::RGBA8_Straight;
+
+    // 同じ要求か（差分prepareの再利用判定用）
+    bool sameAs(const PrepareRequest &other) const
+    {
+        return width == other.width && height == other.height && origin.x == other.origin.x &&
+               origin.y == other.origin.y && hasAffine == other.hasAffine &&
+               sameMatrix(affineMatrix, other.affineMatrix) && hasPushAffine == other.hasPushAffine &&
+               sameMatrix(pushAffineMatrix, other.pushAffineMatrix) && context == other.context &&
+               preferredFormat == other.preferredFormat;
+    }
+
+    static bool sameMatrix(const AffineMatrix &m1, const AffineMatrix &m2)
+    {
+        return m1.a == m2.a && m1.b == m2.b && m1.c == m2.c && m1.d == m2.d && m1.tx == m2.tx && m1.ty == m2.ty;
+    }
 };
 
 // ========================================================================
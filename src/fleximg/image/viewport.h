@@ -124,6 +124,7 @@ void copyRowDDA(void *dst, const ViewPort &src, int_fast16_t count, int_fixed sr
 
 // DDA行転写（バイリニア補間）
 // copyQuadDDA → フォーマット変換 → bilinearBlend_RGBA8888 のパイプライン
+// （RGBA8_Straight の内部ピクセルは x86 (AVX2) で1パスのSIMD版を使用、結果は同一）
 // copyQuadDDA未対応フォーマットは最近傍にフォールバック
 // edgeFadeMask:
 // EdgeFadeFlagsの値。フェード有効な辺のみ境界ピクセルのアルファを0化 srcAux:
@@ -131,6 +132,27 @@ void copyRowDDA(void *dst, const ViewPort &src, int_fast16_t count, int_fixed sr
 void copyRowDDABilinear(void *dst, const ViewPort &src, int_fast16_t count, int_fixed srcX, int_fixed srcY,
                         int_fixed incrX, int_fixed incrY, uint8_t edgeFadeMask, const PixelAuxInfo *srcAux);
 
+// ========================================================================
+// 列テーブル転写（回転・せん断なしの拡大縮小用）
+// ========================================================================
+//
+// 行列の b == c == 0 では全出力行が同じソース列を参照するため、
+// 列ごとのソース座標を事前に計算したテーブル（columns、ViewPort基準の列インデックス）から
+// 1行分のピクセルを取得する。
+//
+
+// 列テーブル行転写（最近傍補間）
+// srcY: ソース行（ViewPort基準）、columns[i]: 出力 i のソース列（0 <= columns[i] < src.width）
+// 1/2/3/4 バイト/ピクセルのフォーマットのみ（bit-packed 非対応）
+void copyRowColumnMap(void *dst, const ViewPort &src, int_fast16_t srcY, const int32_t *columns, int_fast16_t count);
+
+// 列テーブル行転写（バイリニア補間、RGBA8_Straight のみ）
+// srcY: ソースY座標（Q16.16、ピクセル左上基準）、weights[i]: 出力 i のX方向の重み（0〜255）
+// 4近傍がすべてソース内（columns[i] < src.width - 1 かつ 0 <= srcY の行 < src.height - 1）の
+// ピクセル専用。重み・補間式は copyRowDDABilinear と同一（結果はビット単位で一致）
+void copyRowColumnMapBilinear(void *dst, const ViewPort &src, int_fixed srcY, const int32_t *columns,
+                              const uint8_t *weights, int_fast16_t count);
+
 // アフィン変換転写（DDA方式）
 // 複数行を一括処理する高レベル関数
 void affineTransform(ViewPort &dst, const ViewPort &src, int_fixed invTx, int_fixed invTy,
@@ -63,6 +63,18 @@ protected:
     // onPushProcess: AffineNodeは行列を保持するのみ、パススルー
     void onPushProcess(RenderResponse &input, const RenderRequest &request) override;
 
+    // ストリップ処理: パススルーのため常に対応
+    bool canProcessStrip() const override
+    {
+        return true;
+    }
+
+    // 行列変更を差分描画の変更として記録
+    void onTransformChanged() override
+    {
+        markDirty();
+    }
+
     int nodeTypeForMetrics() const override
     {
         return NodeType::Affine;
@@ -32,6 +32,7 @@ public:
     void setScale(float scale)
     {
         params_.value1 = scale;
+        markDirty();
     }
     float scale() const
     {
@@ -27,6 +27,7 @@ public:
     void setAmount(float amount)
     {
         params_.value1 = amount;
+        markDirty();
     }
     float amount() const
     {
@@ -0,0 +1,156 @@
+#ifndef FLEXIMG_CACHE_NODE_H
+#define FLEXIMG_CACHE_NODE_H
+
+#include <vector>
+
+#include "../core/node.h"
+#include "../core/perf_metrics.h"
+#include "../image/image_buffer.h"
+#include "../image/pixel_format.h"
+
+namespace FLEXIMG_NAMESPACE {
+
+// ========================================================================
+// CacheNode - 上流サブツリーの描画結果キャッシュノード
+// ========================================================================
+//
+// 上流サブツリーをprepare時に一度だけ画像バッファへ描画して保持し、
+// 以降のフレームではキャッシュからスキャンラインを返します。
+// - 入力: 1ポート
+// - 出力: 1ポート
+//
+// キャッシュの有効判定（prepareごと）:
+// - 上流サブツリーの全ノードの変更カウンタ（Node::revision()）と接続が前回と同じ
+// - PrepareRequest（スクリーンサイズ・下流のアフィン行列・要求フォーマット等）が同じ
+// - いずれかが変化した場合は上流を準備し直し、キャッシュを再描画する
+//   （上流ノードの setter は markDirty() を呼ぶため、パラメータ変更は自動で検知される）
+// - キャッシュ有効時は上流の prepare / process を一切呼ばない
+//
+// 注意:
+// - 画像データの書き換え等、ノードが検知できない変更は invalidate() で通知する
+// - キャッシュは上流のAABB全体を保持する（メモリ = AABB面積 × フォーマットのバイト数）
+// - キャッシュはRendererNodeの persistentAllocator() から確保し、フレームを跨いで保持する
+// - 下流のフィルタがバッファをその場で加工してもキャッシュが壊れないよう、
+//   スキャンラインごとにデータ範囲のみをコピーして返す
+//
+// 使用例:
+//   // 重い静的背景（9patch + ブラー + マット）をキャッシュし、スプライトのみ毎フレーム描画
+//   CacheNode cache;
+//   background >> hblur >> vblur >> cache;
+//   cache.connectTo(composite, 0);
+//   sprite.connectTo(composite, 1);
+//
+
+class CacheNode : public Node {
+public:
+    CacheNode()
+    {
+        initPorts(1, 1);  // 1入力、1出力
+    }
+
+    // ========================================
+    // パラメータ設定
+    // ========================================
+
+    // キャッシュのピクセルフォーマット（デフォルト: RGBA8_Straight）
+    // 1ピクセル1バイト以上の直接色フォーマットのみ指定可能（インデックス・bit-packedは無視）
+    // RGB565等を指定するとメモリを削減できるが、アルファや色精度は失われる
+    void setCacheFormat(PixelFormatID format)
+    {
+        if (!format || format->isIndexed || format->bitsPerPixel % 8 != 0) return;
+        format_ = format;
+        invalidate();
+    }
+
+    PixelFormatID cacheFormat() const
+    {
+        return format_;
+    }
+
+    // 次回のprepareでキャッシュを再描画する
+    void invalidate()
+    {
+        cacheValid_ = false;
+        markDirty();
+    }
+
+    // ========================================
+    // 状態取得
+    // ========================================
+
+    // 有効なキャッシュを保持しているか
+    bool isCacheValid() const
+    {
+        return cacheValid_;
+    }
+
+    // キャッシュの描画回数（統計用）
+    uint32_t renderCount() const
+    {
+        return renderCount_;
+    }
+
+    // キャッシュバッファ（origin はキャッシュ左上のワールド座標）
+    const ImageBuffer &cacheBuffer() const
+    {
+        return cache_;
+    }
+
+    // ========================================
+    // Node インターフェース
+    // ========================================
+
+    const char *name() const override
+    {
+        return "CacheNode";
+    }
+
+    // getDataRange: キャッシュ有効時は描画時に記録した行ごとの範囲を返す
+    DataRange getDataRange(const RenderRequest &request) const override;
+
+protected:
+    int nodeTypeForMetrics() const override
+    {
+        return NodeType::Cache;
+    }
+
+    // ========================================
+    // Template Method フック
+    // ========================================
+
+    // onPullPrepare: キャッシュの有効判定、無効なら上流を準備して再描画
+    PrepareResponse onPullPrepare(const PrepareRequest &request) override;
+
+    // onPullProcess: キャッシュから要求範囲をコピーして返す
+    RenderResponse &onPullProcess(const RenderRequest &request) override;
+
+private:
+    // 有効判定用: 上流サブツリーのノードと変更カウンタ（深さ優先順、未接続はnullptr）
+    struct SubtreeEntry {
+        const Node *node;
+        uint32_t revision;
+    };
+
+    PixelFormatID format_ = PixelFormatIDs::RGBA8_Straight;
+    ImageBuffer cache_;
+    std::vector<DataRange> rowRanges_;  // 行ごとのデータ範囲（キャッシュ座標系）
+    Point cacheOrigin_;                 // キャッシュ左上のワールド座標
+    PrepareResponse cachedResponse_;
+    PrepareRequest cachedRequest_;
+    std::vector<SubtreeEntry> cachedSubtree_;
+    std::vector<SubtreeEntry> currentSubtree_;
+    core::memory::IAllocator *cacheAllocator_ = nullptr;
+    uint32_t renderCount_                     = 0;
+    bool cacheValid_                          = false;
+    bool cacheActive_                         = false;  // 今回のフレームでキャッシュから返すか
+
+    // 上流サブツリーのノードと変更カウンタを収集
+    static void collectSubtree(const Node *node, std::vector<SubtreeEntry> &out);
+
+    // 上流をスキャンライン単位で描画し、キャッシュを作成
+    bool renderCache(Node *upstream, const PrepareRequest &request, const PrepareResponse &upstreamResult);
+};
+
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_CACHE_NODE_H
@@ -27,6 +27,11 @@ namespace FLEXIMG_NAMESPACE {
 // - 入力ポート1以降が順に背面に合成
 // - 既に不透明なピクセルは後のレイヤー処理をスキップ
 //
+// アクティブリスト（多数の入力向け）:
+// - prepare時に各上流のAABBのY範囲で入力をバケット（行帯）に振り分ける
+// - スキャンラインごとに、その行を含むバケットの入力のみを getDataRange / pullProcess する
+// - 処理量は全入力数ではなく、その行に掛かる入力数に比例する
+//
 // アフィン変換はAffineCapability Mixinから継承:
 // - setMatrix(), matrix()
 // - setRotation(), setScale(), setTranslation(), setRotationScale()
@@ -94,15 +99,53 @@ public:
     // getDataRange: 全上流のgetDataRange和集合を返す
     DataRange getDataRange(const RenderRequest &request) const override;
 
+    // getDataSpans: 全上流の区間列の和集合（離れた入力の間の隙間を保持）
+    void getDataSpans(const RenderRequest &request, DataRangeList &out) const override;
+
 protected:
     int nodeTypeForMetrics() const override
     {
         return NodeType::Composite;
     }
 
+    // 行列変更を差分描画の変更として記録
+    void onTransformChanged() override
+    {
+        markDirty();
+    }
+
 private:
+    // 入力のY範囲（prepare時のAABB由来、ワールド座標の整数行 [top, bottom)）
+    struct InputSpan {
+        int32_t top    = 0;
+        int32_t bottom = 0;
+
+        bool covers(int32_t y0, int32_t y1) const
+        {
+            return top < y1 && y0 < bottom;
+        }
+    };
+
+    // アクティブリストのバケット数上限（行帯の高さは 2^bucketShift_）
+    static constexpr int32_t MAX_ACTIVE_BUCKETS = 64;
+
     // getDataRangeキャッシュ（同一スキャンラインでの重複計算を回避）
     mutable core::DataRangeCache dataRangeCache_;
+
+    // アクティブリスト（prepare時に構築、process中は読み取りのみ）
+    std::vector<InputSpan> inputSpans_;    // 入力ポート順
+    std::vector<uint16_t> activeInputs_;   // データを持つ入力ポート番号（ポート順）
+    std::vector<uint32_t> bucketOffsets_;  // バケットごとの bucketInputs_ 開始位置（バケット数 + 1）
+    std::vector<uint16_t> bucketInputs_;   // バケットに掛かる入力ポート番号（バケットごとにポート順）
+    int32_t bucketTop_  = 0;
+    int32_t bucketRows_ = 0;
+    int bucketShift_    = 0;
+
+    // 入力のY範囲からバケットを構築
+    void buildActiveList();
+
+    // 要求行に掛かり得る入力ポート番号の列 [first, last) を取得（ポート順）
+    void activeInputsFor(const RenderRequest &request, const uint16_t *&first, const uint16_t *&last) const;
 };
 
 }  // namespace FLEXIMG_NAMESPACE
@@ -89,6 +89,18 @@ public:
 
     // onPushProcess: 全出力に参照モードで配信
     void onPushProcess(RenderResponse &input, const RenderRequest &request) override;
+
+    // ストリップ処理: バッファを参照で配信するため常に対応（可否は下流次第）
+    bool canProcessStrip() const override
+    {
+        return true;
+    }
+
+    // 行列変更を差分描画の変更として記録
+    void onTransformChanged() override
+    {
+        markDirty();
+    }
 };
 
 }  // namespace FLEXIMG_NAMESPACE
@@ -5,6 +5,8 @@
 #include "../core/perf_metrics.h"
 #include "../image/image_buffer.h"
 #include "../operations/filters.h"
+#include <algorithm>
+#include <vector>
 
 namespace FLEXIMG_NAMESPACE {
 
@@ -15,7 +17,7 @@ namespace FLEXIMG_NAMESPACE {
 // フィルタ系ノードの共通基底クラスです。
 // - 入力: 1ポート
 // - 出力: 1ポート
-// - スキャンライン必須仕様（height=1）前提で動作
+// - スキャンライン単位で動作（入力マージン0のフィルタはストリップにも対応）
 //
 // 派生クラスの実装:
 //   - getFilterFunc() でフィルタ関数を返す
@@ -35,6 +37,14 @@ namespace FLEXIMG_NAMESPACE {
 //       } const char* name() const override { return "BrightnessNode"; }
 //   };
 //
+// フィルタ列の融合:
+// - RenderContext::isFilterFusionEnabled() 時、prepare()で上流に連続する
+//   融合可能なノード（getLineKernel()がtrue）を1つのカーネル列にまとめる
+// - 列の末端（最も下流）のノードだけが上流を辿ってカーネル列を持ち（途中のノードは辿らない）、
+//   列の手前の上流から1回だけpullし、
+//   同じ行バッファに各カーネルを上流側から順に適用する
+// - 中間ノードの pullProcess / getDataRange / フォーマット変換を省略する
+//
 
 class FilterNodeBase : public Node {
 public:
@@ -59,6 +69,37 @@ public:
     // onPullProcess: マージン追加とメトリクス記録を行い、process() に委譲
     RenderResponse &onPullProcess(const RenderRequest &request) override;
 
+    // getDataRange: カーネル列コンパイル時は列の手前の上流へ直接問い合わせる
+    DataRange getDataRange(const RenderRequest &request) const override;
+
+    // getDataSpans: 入力マージン0のフィルタは上流の区間列をそのまま返す
+    void getDataSpans(const RenderRequest &request, DataRangeList &out) const override;
+
+    // 入力マージン0のフィルタはラインカーネルとして融合可能
+    bool getLineKernel(filters::LineKernel &kernel) const override;
+
+    // 差分描画: 入力マージン分だけ上流の変更が波及する
+    void damageMargin(int_fast16_t &marginX, int_fast16_t &marginY) const override
+    {
+        marginX = marginY = static_cast<int_fast16_t>(computeInputMargin());
+    }
+
+    // 入力マージン0のフィルタは行ごとにラインフィルタを適用してストリップを処理できる
+    bool canProcessStrip() const override
+    {
+        return computeInputMargin() == 0;
+    }
+
+    // 準備・終了処理（カーネル列のコンパイル・破棄）
+    void prepare(const RenderRequest &screenInfo) override;
+    void finalize() override;
+
+    // コンパイル済みカーネル列の要素数（0 = 通常経路、列の末端のノードのみ2以上）
+    size_t compiledKernelCount() const
+    {
+        return compiledKernels_.size();
+    }
+
 protected:
     // ========================================
     // 派生クラスがオーバーライドするフック
@@ -77,7 +118,7 @@ protected:
     int nodeTypeForMetrics() const override = 0;
 
     // process() 共通実装
-    // スキャンライン必須仕様（height=1）前提の共通処理
+    // 入力バッファの各行にラインフィルタを適用する
     RenderResponse &process(RenderResponse &input, const RenderRequest &request) override;
 
     // ========================================
@@ -85,6 +126,13 @@ protected:
     // ========================================
 
     filters::LineFilterParams params_;
+
+private:
+    // コンパイル済みカーネル列（実行順 = 上流側から、2要素以上のときのみ有効）
+    std::vector<filters::LineKernel> compiledKernels_;
+    Node *compiledSource_ = nullptr;  // カーネル列の手前の上流ノード
+
+    RenderResponse &pullCompiled(const RenderRequest &request);
 };
 
 }  // namespace FLEXIMG_NAMESPACE
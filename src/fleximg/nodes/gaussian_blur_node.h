@@ -0,0 +1,185 @@
+#ifndef FLEXIMG_GAUSSIAN_BLUR_NODE_H
+#define FLEXIMG_GAUSSIAN_BLUR_NODE_H
+
+#include "../core/data_range_cache.h"
+#include "../core/node.h"
+#include "../core/perf_metrics.h"
+#include "../image/image_buffer.h"
+#include <algorithm>
+#include <cstdint>  // for int32_t, uint64_t
+#include <cstring>
+#include <vector>
+
+namespace FLEXIMG_NAMESPACE {
+
+// ========================================================================
+// GaussianBlurNode - 2次元ガウスぼかしフィルタノード（スキャンライン対応）
+// ========================================================================
+//
+// 入力画像に縦横のガウスぼかし（ボックスフィルタ3回の畳み込みで近似）を適用します。
+// - sigma: 標準偏差（0〜kMaxSigma）。ボックス半径 r = round((sqrt(4σ² + 1) - 1) / 2)
+//   に丸められ、実際の標準偏差は sqrt(r² + r) になる
+// - 結果は HorizontalBlurNode + VerticalBlurNode（radius=r, passes=3）と同じ重み
+//   （端数の丸めは2次元の合計から1回のみ）
+//
+// 再帰形式（積分器＋櫛形フィルタ）:
+// - ボックス3回 = (1 - z^-K)^3 / (1 - z^-1)^3（K = 2r + 1）を、
+//   入力の4タップ差分（+1, -3, +3, -1、間隔K）と3段の累積和で計算する
+// - ピクセルあたりの演算量は sigma に依存しない（垂直4タップ + 水平4タップ + 累積和6回）
+// - 整数（uint64、剰余演算）で計算するため誤差が蓄積しない
+//
+// メモリ消費量（pull型）:
+// - 垂直方向の状態は列ごとに累積和3段 × RGBA（uint64）: width * 96 bytes
+// - 例: width=2048 → 約192KB（半径によらない）
+// - 差分タップの行は保持せず、上流から再取得する（出力1行あたり最大4行をpull）
+//
+// push型:
+// - 入力行は1回しか届かないため、差分タップ用に 3 * K 行（RGBA8）のリングバッファを持つ
+//   （VerticalBlurNode の passes=3 と同程度）
+// - 出力サイズ = 入力サイズ（エッジはゼロパディング）、逐次実行のみ
+//
+// バンド分割（pull型）:
+// - 最初の要求行、または前回から 6r + 1 行を超えて離れた行への移動では状態を作り直し、
+//   上方向 3r 行から累積し直す（それより上の行は出力に影響しない）
+// - バンド並列実行時はワーカーごとに独立した状態を持つ
+//
+// 使用例:
+//   GaussianBlurNode gblur;
+//   gblur.setSigma(8.0f);
+//   src >> gblur >> sink;
+//
+
+class GaussianBlurNode : public Node {
+public:
+    GaussianBlurNode()
+    {
+        initPorts(1, 1);
+    }
+
+    // ========================================
+    // パラメータ設定
+    // ========================================
+
+    // パラメータ上限（合計値が uint64 に収まる範囲: K^6 * 255 * 255 < 2^64）
+    static constexpr int kMaxRadius = 127;
+    static constexpr float kMaxSigma = 127.5f;  // sqrt(127 * 128)
+
+    void setSigma(float sigma);
+
+    float sigma() const
+    {
+        return sigma_;
+    }
+    // ボックスフィルタ1回分の半径
+    int16_t boxRadius() const
+    {
+        return radius_;
+    }
+    int_fast16_t kernelSize() const
+    {
+        return radius_ * 2 + 1;
+    }
+    // 片側の影響範囲（ボックス3回分）
+    int_fast16_t margin() const
+    {
+        return radius_ * 3;
+    }
+
+    // ========================================
+    // Node インターフェース
+    // ========================================
+
+    const char *name() const override
+    {
+        return "GaussianBlurNode";
+    }
+
+    // getDataRange: 上下 margin 行の上流DataRange和集合を左右に margin 拡張して返す
+    // （出力行のみで決まり、累積状態やバンド分割に依存しない）
+    DataRange getDataRange(const RenderRequest &request) const override;
+
+    // 差分描画: 上流の変更は上下左右 margin ピクセルに波及する
+    void damageMargin(int_fast16_t &marginX, int_fast16_t &marginY) const override
+    {
+        marginX = margin();
+        marginY = margin();
+    }
+
+    void finalize() override;
+
+    // Template Method フック
+    PrepareResponse onPullPrepare(const PrepareRequest &request) override;
+    PrepareResponse onPushPrepare(const PrepareRequest &request) override;
+    void onPushProcess(RenderResponse &input, const RenderRequest &request) override;
+    void onPushFinalize() override;
+
+protected:
+    int nodeTypeForMetrics() const override
+    {
+        return NodeType::GaussianBlur;
+    }
+    RenderResponse &onPullProcess(const RenderRequest &request) override;
+
+private:
+    float sigma_    = 0.0f;
+    int16_t radius_ = 0;
+
+    // ========================================
+    // 垂直方向の累積状態
+    // ========================================
+    // 列×RGBA（インターリーブ）のプリマルチプライド値
+    // sum1 には差分タップを加算し、sum2 += sum1, sum3 += sum2 で累積する
+    // sum3 は出力行の垂直方向ボックス3回の合計になる
+    struct BlurState {
+        std::vector<uint64_t> sum1;
+        std::vector<uint64_t> sum2;
+        std::vector<uint64_t> sum3;
+        int32_t currentY    = 0;      // 最後に累積した入力行（pull型用）
+        int32_t windowStart = 0;      // 累積開始行（これより上の入力行はゼロとみなす）
+        bool ready          = false;  // 累積状態が有効か
+
+        void clear()
+        {
+            sum1.clear();
+            sum2.clear();
+            sum3.clear();
+            currentY    = 0;
+            windowStart = 0;
+            ready       = false;
+        }
+    };
+
+    // ワーカー0（逐次実行・push型）用
+    BlurState state_;
+    // ワーカー1以降用（要素数はprepareで確定、各要素は初回使用時に確保）
+    std::vector<BlurState> workerStates_;
+    int16_t cacheWidth_     = 0;
+    int_fixed cacheOriginX_ = 0;  // 状態の列0のワールドX座標
+
+    // push型処理用の状態
+    std::vector<ImageBuffer> pushRows_;  // 差分タップ用の入力行リング（3 * K 行）
+    int32_t pushInputY_         = 0;
+    int32_t pushOutputY_        = 0;
+    int16_t pushOutputHeight_   = 0;
+    int_fixed lastInputOriginY_ = 0;
+
+    // getDataRange/pullProcess 間のキャッシュ（ワーカー単位）
+    mutable core::DataRangeCache rangeCache_;
+
+    // 内部実装（宣言のみ）
+    BlurState &pullState();
+    void initializeState(BlurState &state, int_fast16_t width);
+    void resetState(BlurState &state);
+    void advanceState(BlurState &state, Node *upstream, int32_t outputY);
+    void accumulateUpstreamRow(BlurState &state, Node *upstream, int32_t srcY, int32_t weight);
+    void accumulateRow(BlurState &state, const uint8_t *row, int_fast16_t offset, int_fast16_t count,
+                       int32_t weight);
+    void integrateState(BlurState &state);
+    void normalizeRow(uint8_t *dst, const uint64_t *sum, int_fast16_t begin, int_fast16_t end) const;
+    void pushInputRow(const ImageBuffer *input, int_fast16_t xOffset);
+    void emitPushRow();
+};
+
+}  // namespace FLEXIMG_NAMESPACE
+
+#endif  // FLEXIMG_GAUSSIAN_BLUR_NODE_H
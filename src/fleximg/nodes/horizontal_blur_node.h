@@ -4,6 +4,7 @@
 #include "../core/node.h"
 #include "../core/perf_metrics.h"
 #include "../image/image_buffer.h"
+#include "../operations/filters.h"
 #include <algorithm>  // for std::min, std::max
 #include <cstring>    // for std::memcpy
 
@@ -55,11 +56,13 @@ public:
     void setRadius(int_fast16_t radius)
     {
         radius_ = static_cast<int16_t>((radius < 0) ? 0 : (radius > kMaxRadius) ? kMaxRadius : radius);
+        markDirty();
     }
 
     void setPasses(int_fast16_t passes)
     {
         passes_ = static_cast<int16_t>((passes < 1) ? 1 : (passes > kMaxPasses) ? kMaxPasses : passes);
+        markDirty();
     }
 
     int16_t radius() const
@@ -84,6 +87,13 @@ public:
         return "HorizontalBlurNode";
     }
 
+    // 差分描画: 上流の変更は左右 radius * passes ピクセルに波及する
+    void damageMargin(int_fast16_t &marginX, int_fast16_t &marginY) const override
+    {
+        marginX = static_cast<int_fast16_t>(radius_ * passes_);
+        marginY = 0;
+    }
+
     // getDataRange: 上流データ範囲をブラー分拡張して返す
     DataRange getDataRange(const RenderRequest &request) const override
     {
@@ -159,20 +169,6 @@ private:
     // 水平方向ブラー処理（共通）
     void applyHorizontalBlur(const ViewPort &srcView, int_fast16_t inputOffset, ImageBuffer &output);
 
-    // ブラー済みピクセルを書き込み
-    void writeBlurredPixel(uint8_t *row, int_fast16_t x, uint32_t sumR, uint32_t sumG, uint32_t sumB, uint32_t sumA)
-    {
-        auto off    = static_cast<int_fast16_t>(x * 4);
-        uint32_t ks = static_cast<uint32_t>(kernelSize());
-        if (sumA > 0) {
-            row[off]     = static_cast<uint8_t>(sumR / sumA);
-            row[off + 1] = static_cast<uint8_t>(sumG / sumA);
-            row[off + 2] = static_cast<uint8_t>(sumB / sumA);
-            row[off + 3] = static_cast<uint8_t>(sumA / ks);
-        } else {
-            row[off] = row[off + 1] = row[off + 2] = row[off + 3] = 0;
-        }
-    }
 };
 
 }  // namespace FLEXIMG_NAMESPACE
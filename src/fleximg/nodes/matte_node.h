@@ -60,6 +60,9 @@ public:
     // getDataRange: 上流データ範囲の和集合を返す
     DataRange getDataRange(const RenderRequest &request) const override;
 
+    // getDataSpans: bg の区間列 ∪ (fg の区間列 ∩ mask範囲)
+    void getDataSpans(const RenderRequest &request, DataRangeList &out) const override;
+
 #if defined(BENCH_M5STACK) || defined(BENCH_NATIVE)
     // ========================================
     // ベンチマーク用公開API
@@ -153,16 +156,30 @@ private:
     // ========================================
     struct RangeCache {
         Point origin{};          // キャッシュ時のリクエストorigin
+        int16_t width = 0;       // キャッシュ時のリクエスト幅
         DataRange fgRange{};     // fg のデータ範囲
         DataRange bgRange{};     // bg のデータ範囲
         DataRange maskRange{};   // mask のデータ範囲
         DataRange unionRange{};  // 全体の和集合
         bool valid = false;      // キャッシュ有効フラグ
     };
-    mutable RangeCache rangeCache_;
+    // バンド並列実行時の競合を避けるためワーカーごとに保持
+    mutable RangeCache rangeCache_[RenderContext::MAX_WORKERS];
+
+    RangeCache &workerRangeCache() const
+    {
+        return rangeCache_[RenderContext::currentWorkerIndex()];
+    }
 
     // 上流データ範囲を計算（キャッシュに保存）
     DataRange calcUpstreamRanges(const RenderRequest &request) const;
+
+    // キャッシュが request に対して有効か（同一行でも幅の異なる分割リクエストは別扱い）
+    static bool rangeCacheMatches(const RangeCache &cache, const RenderRequest &request)
+    {
+        return cache.valid && cache.origin.x == request.origin.x && cache.origin.y == request.origin.y &&
+               cache.width == request.width;
+    }
 };
 
 }  // namespace FLEXIMG_NAMESPACE
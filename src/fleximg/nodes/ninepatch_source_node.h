@@ -64,6 +64,7 @@ public:
         effectiveSrcBottom_ = static_cast<int16_t>(bottom);
         sourceValid_        = image.isValid();
         geometryValid_      = false;
+        markDirty();
 
         // 各区画のソースサイズを計算
         calcSrcPatchSizes();
@@ -124,6 +125,7 @@ public:
             outputWidth_   = width;
             outputHeight_  = height;
             geometryValid_ = false;
+            markDirty();
         }
     }
 
@@ -134,6 +136,7 @@ public:
             pivotX_        = x;
             pivotY_        = y;
             geometryValid_ = false;  // アフィン行列の再計算が必要
+            markDirty();
         }
     }
 
@@ -144,6 +147,7 @@ public:
             positionX_     = x;
             positionY_     = y;
             geometryValid_ = false;  // アフィン行列の再計算が必要
+            markDirty();
         }
     }
 
@@ -153,6 +157,7 @@ public:
         if (interpolationMode_ != mode) {
             interpolationMode_ = mode;
             geometryValid_     = false;  // ソースビュー再設定が必要
+            markDirty();
         }
         for (int i = 0; i < 9; i++) {
             patches_[i].setInterpolationMode(mode);
@@ -217,12 +222,25 @@ public:
     // onPullFinalize: 各区画のSourceNodeに終了を伝播
     void onPullFinalize() override;
 
+    // 内部SourceNodeは入力ポート経由ではないため、差分prepareでは常に再準備する
+    // （内部ノード自身の準備結果は各々で再利用される）
+    bool isPrepareReusable() const override
+    {
+        return false;
+    }
+
     // onPullProcess: 全9区画を処理して合成
     RenderResponse &onPullProcess(const RenderRequest &request) override;
 
     // getDataRange: 全パッチのデータ範囲の和集合を返す
     DataRange getDataRange(const RenderRequest &request) const override;
 
+    // 行列変更を差分描画の変更として記録
+    void onTransformChanged() override
+    {
+        markDirty();
+    }
+
 private:
     // 内部SourceNode（9区画）
     SourceNode patches_[9];
@@ -1,14 +1,18 @@
 #ifndef FLEXIMG_RENDERER_NODE_H
 #define FLEXIMG_RENDERER_NODE_H
 
+#include "../core/executor.h"
 #include "../core/format_metrics.h"
 #include "../core/node.h"
 #include "../core/perf_metrics.h"
 #include "../core/render_context.h"
 #include "../core/types.h"
+#include "../image/damage_region.h"
 #include "../image/image_buffer_entry_pool.h"
 #include "../image/render_types.h"
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace FLEXIMG_NAMESPACE {
 
@@ -34,9 +38,81 @@ namespace FLEXIMG_NAMESPACE {
 //   renderer.setTileConfig({64, 64});
 //   renderer.exec();
 //
+// バンド並列実行（オプトイン）:
+//   ThreadPoolExecutor executor(4);        // core/thread_pool_executor.h
+//   renderer.setParallelExecutor(&executor);
+//   renderer.exec();  // 仮想スクリーンを水平バンドに分割し並列処理
+//
+// - ワーカーごとに RenderContext / ImageBufferEntryPool / アロケータを持つ
+// - ワーカー0はメインの context_ / entryPool_ / setAllocator() のアロケータを使用
+// - ワーカー1以降のアロケータは setWorkerAllocator() で指定（未指定時は
+//   DefaultAllocator。スレッドセーフでないアロケータを共有しないこと）
+// - 行順序に依存するノード（push型VerticalBlurNode等）を含む場合は逐次実行に戻る
+//
+// フィルタ列の融合（オプトイン）:
+//   renderer.setFilterFusionEnabled(true);
+//
+// - prepare時に連続するインプレースフィルタ（Brightness/Grayscale/Alpha等）を
+//   1つのカーネル列に融合し、スキャンラインごとの中間ノード呼び出しを省略する
+//
+// ストリップ処理（オプトイン）:
+//   renderer.setStripHeight(16);
+//
+// - 複数行（height > 1）のリクエストで上流・下流を呼び出し、ノードごとの
+//   リクエスト単位のオーバーヘッド（getDataRange・Response取得・変換関数解決等）を
+//   行数分で償却する
+// - prepare後、上流・下流の全ノードが Node::canProcessStrip() を返す場合のみ有効。
+//   非対応ノードを含むグラフはスキャンライン単位（height=1）で処理する
+//
+// 差分prepare（オプトイン）:
+//   renderer.setIncrementalPrepareEnabled(true);
+//
+// - 変更のないノード（変更カウンタ・prepare要求・上流が前回と同じ）は前回の準備結果を再利用する
+// - 多数のSourceNodeのうち一部のみが毎フレーム変化するグラフで、prepareの負荷を変化分に限定する
+// - 画像データの書き換え等はノードが検知できないため、markDirty() を呼ぶ
+//
+// 差分描画（オプトイン）:
+//   renderer.setDamageTrackingEnabled(true);
+//   renderer.exec();           // 初回は全画面
+//   sprite.setRotation(0.2f);  // 変更したノードが markDirty() される
+//   renderer.exec();           // 変化した領域のみ再描画
+//
+// - 上流ノードの変更カウンタ（Node::revision()）・prepare後のAABB・接続を前回のexec()と
+//   比較し、変化したノードの新旧AABBの和集合をダメージ領域とする
+// - ダメージは下流へ伝播し、ブラー等は Node::damageMargin() 分だけ拡張される
+// - ダメージ領域と交差するスキャンラインのX区間のみを処理し、それ以外の出力先は変更しない。
+//   区間内はデータのない部分も透明で書き込む（全画面クリア後の描画と同じ結果）
+// - 下流（Sink等）・仮想スクリーン・pivotが変化した場合は全画面を描画する
+// - 画像データの書き換え等はノードが検知できないため、markDirty() / invalidate() を呼ぶ
+//
+// データ区間分割（オプトイン）:
+//   renderer.setSpanSplitEnabled(true);
+//
+// - タイルごとに上流の Node::getDataSpans() を問い合わせ、データのある区間ごとに
+//   リクエストを分割する（画面の両端のスプライト等で、間の隙間を確保・クリア・合成・転送しない）
+// - 隙間の出力先は変更しない（無効時は外接範囲の隙間も透明で書き込む）
+// - 差分描画と併用した場合は差分区間内でのみ分割し、区間内の隙間は従来どおり透明で書き込む
+// - MIN_SPAN_GAP 未満の隙間は分割せず、区間数は MAX_DATA_SPANS に制限される
+//
+// スキャンラインアリーナ（オプトイン）:
+//   renderer.setScanlineArenaEnabled(true);
+//
+// - スキャンライン内の一時バッファをワーカーごとのアリーナから切り出し、
+//   スキャンライン終了時に一括で巻き戻す（定常状態でアロケータ呼び出しなし）
+// - アリーナのチャンクは設定済みアロケータから確保し、exec()を跨いで保持する
+//
 
 class RendererNode : public Node {
 public:
+    /// @brief ストリップ高さの上限（行数）
+    static constexpr int_fast16_t MAX_STRIP_HEIGHT = 64;
+
+    /// @brief データ区間分割時の区間数の上限
+    static constexpr int_fast16_t MAX_DATA_SPANS = 16;
+
+    /// @brief データ区間分割で分割しない隙間の幅（ピクセル、これ未満の隙間は区間を統合）
+    static constexpr int_fast16_t MIN_SPAN_GAP = 16;
+
     RendererNode()
     {
         initPorts(1, 1);  // 1入力・1出力
@@ -96,6 +172,132 @@ public:
     void setAllocator(core::memory::IAllocator *allocator)
     {
         pipelineAllocator_ = allocator;
+        context_.invalidatePreparedState();
+    }
+
+    // フィルタ列の融合設定
+    // 有効時、prepareで融合可能なノード列をカーネル列にまとめる（出力は同一）
+    void setFilterFusionEnabled(bool enabled)
+    {
+        filterFusion_ = enabled;
+        context_.invalidatePreparedState();
+    }
+
+    // 差分prepare設定
+    // 有効時、変更カウンタ・要求・上流が前回と同じノードは前回の準備結果を再利用し、
+    // アフィン事前計算やキャッシュの再確保を省略する（準備済みのリソースはフレームを跨いで保持）
+    void setIncrementalPrepareEnabled(bool enabled)
+    {
+        incrementalPrepare_ = enabled;
+        context_.invalidatePreparedState();
+    }
+
+    // データ区間分割設定
+    // 有効時、上流のデータ区間ごとにリクエストを分割し、区間の隙間は処理・転送しない
+    void setSpanSplitEnabled(bool enabled)
+    {
+        spanSplit_ = enabled;
+    }
+
+    bool isSpanSplitEnabled() const
+    {
+        return spanSplit_;
+    }
+
+    // ストリップ高さ設定（1 = スキャンライン単位、デフォルト）
+    // MAX_STRIP_HEIGHT でクランプされる。実際に使われる高さは activeStripHeight() で確認
+    void setStripHeight(int_fast16_t rows)
+    {
+        stripHeight_ = static_cast<int16_t>(std::max<int_fast16_t>(1, std::min<int_fast16_t>(rows, MAX_STRIP_HEIGHT)));
+    }
+
+    int_fast16_t stripHeight() const
+    {
+        return stripHeight_;
+    }
+
+    // 直近のexecPrepare()で決定したストリップ高さ（非対応ノードがあれば1）
+    int_fast16_t activeStripHeight() const
+    {
+        return activeStripHeight_;
+    }
+
+    // 差分描画設定
+    // 有効時、前回のexec()から変化した領域のみを再描画する
+    // 切り替え直後のexec()は全画面を描画する
+    void setDamageTrackingEnabled(bool enabled)
+    {
+        damageTracking_ = enabled;
+        invalidate();
+    }
+
+    // 次回のexec()で全画面を描画させる（出力先を外部で書き換えた場合等）
+    void invalidate()
+    {
+        damageValid_ = false;
+    }
+
+    // 直近のexecPrepare()で決定した描画領域（全画面描画時は画面全体の矩形）
+    // 表示デバイスへの部分転送範囲として利用できる
+    const DamageRegion &lastDamage() const
+    {
+        return damage_;
+    }
+
+    // 直近のexecPrepare()が部分描画（差分描画）だったか
+    bool lastFrameWasPartial() const
+    {
+        return partialFrame_;
+    }
+
+    // スキャンラインアリーナ設定
+    // 有効時、スキャンライン内のバッファ確保をアリーナで処理する
+    // 無効化するとアリーナが保持するチャンクを解放する
+    void setScanlineArenaEnabled(bool enabled)
+    {
+        useScanlineArena_ = enabled;
+        if (!enabled) {
+            scanlineArena_.release();
+            for (int_fast16_t i = 0; i < workerSlotCount_; ++i) {
+                workerSlot(i).arena.release();
+            }
+        }
+    }
+
+    // メインコンテキスト（ワーカー0）のスキャンラインアリーナ（統計取得用）
+    const core::memory::ScanlineArenaAllocator &scanlineArena() const
+    {
+        return scanlineArena_;
+    }
+
+    // 並列実行器設定（バンド並列実行）
+    // nullptrの場合は逐次実行（デフォルト）
+    void setParallelExecutor(core::IParallelExecutor *executor)
+    {
+        executor_ = executor;
+    }
+
+    // 並列ワーカー数設定（0 = executor->concurrency() に従う）
+    // RenderContext::MAX_WORKERS でクランプされる
+    void setWorkerCount(int_fast16_t count)
+    {
+        requestedWorkers_ = static_cast<int16_t>(count < 0 ? 0 : count);
+    }
+
+    // ワーカー別アロケータ設定（index 1 以降、0 は setAllocator() を使用）
+    // nullptrの場合はDefaultAllocatorを使用
+    void setWorkerAllocator(int_fast16_t index, core::memory::IAllocator *allocator)
+    {
+        if (index >= 1 && index < RenderContext::MAX_WORKERS) {
+            workerAllocators_[index] = allocator;
+            context_.invalidatePreparedState();
+        }
+    }
+
+    // 直近のexecProcess()で使用したバンド数（1 = 逐次実行）
+    int_fast16_t lastBandCount() const
+    {
+        return lastBandCount_;
     }
 
     // デバッグ用チェッカーボード
@@ -172,6 +374,9 @@ public:
 
         // エントリプールを一括解放
         entryPool_.releaseAll();
+        for (int_fast16_t i = 0; i < workerSlotCount_; ++i) {
+            workerSlot(i).entryPool.releaseAll();
+        }
     }
 
     // パフォーマンス計測結果を取得
@@ -192,14 +397,24 @@ protected:
     // タイル処理（派生クラスでカスタマイズ可能）
     // 注: exec()全体の時間はnodes[NodeType::Renderer]に記録される
     //     各ノードの合計との差分がオーバーヘッド（タイル管理、データ受け渡し等）
+    // 注: バンド並列実行時は複数スレッドから同時に呼ばれる。
+    //     スキャンラインリソースは activeContext() 経由で扱うこと
     virtual void processTile(int_fast16_t tileX, int_fast16_t tileY)
     {
         RenderRequest request = createTileRequest(tileX, tileY);
+        RenderContext &ctx    = activeContext();
 
         // 上流からプル
         Node *upstream = upstreamNode(0);
         if (!upstream) {
-            context_.resetScanlineResources();
+            ctx.resetScanlineResources();
+            return;
+        }
+
+        // データ区間分割: 区間ごとに処理（データ区間がない場合は従来どおり転送）
+        // （差分描画時は出力を透明で消去する必要があるため、分割は差分区間の処理内で行う）
+        if (spanSplit_ && !damageTracking_ && !debugDataRange_ && processDataSpans(upstream, request)) {
+            ctx.resetScanlineResources();
             return;
         }
 
@@ -217,27 +432,127 @@ protected:
         }
 
         // タイル処理完了後にResponseプールをリセット
-        context_.resetScanlineResources();
+        ctx.resetScanlineResources();
+    }
+
+    // 処理中スレッドのコンテキストを取得
+    // バンド並列実行中はワーカー用コンテキスト、それ以外はメインのcontext_
+    RenderContext &activeContext()
+    {
+        RenderContext *bound = RenderContext::boundToCurrentThread();
+        return bound ? *bound : context_;
     }
 
     // デバッグ用: DataRange可視化処理（resultを直接変更）
     void applyDataRangeDebug(Node *upstream, const RenderRequest &request, RenderResponse &result);
 
+    // 上流のデータ区間を取得（MIN_SPAN_GAP 未満の隙間は統合し、request範囲にクリップ）
+    void collectDataSpans(Node *upstream, const RenderRequest &request, DataRangeList &spans);
+
+    // データ区間ごとに上流からプルして下流へプッシュ
+    // データ区間がない・作業領域が確保できない場合は何もせず false
+    bool processDataSpans(Node *upstream, const RenderRequest &request);
+
 private:
     int16_t virtualWidth_  = 0;
     int16_t virtualHeight_ = 0;
     int_fixed pivotX_      = 0;
     int_fixed pivotY_      = 0;
     TileConfig tileConfig_;
+    int16_t stripHeight_                         = 1;  // 要求されたストリップ高さ
+    int16_t activeStripHeight_                   = 1;  // execPrepareで決定した高さ
+    bool damageTracking_                         = false;
+    bool damageValid_                            = false;  // 前回の記録が比較に使えるか
+    bool partialFrame_                           = false;
     bool debugCheckerboard_                      = false;
     bool debugDataRange_                         = false;
+    bool useScanlineArena_                       = false;
+    bool filterFusion_                           = false;
+    bool incrementalPrepare_                     = false;
+    bool spanSplit_                              = false;
     core::memory::IAllocator *pipelineAllocator_ = nullptr;  // パイプライン用アロケータ
+    core::memory::ScanlineArenaAllocator scanlineArena_;     // スキャンラインアリーナ（ワーカー0用、プールより後に破棄）
     ImageBufferEntryPool entryPool_;                         // RenderResponse用エントリプール
     RenderContext context_;                                  // レンダリングコンテキスト（allocator + entryPool を統合）
 
+    // ========================================
+    // 差分描画
+    // ========================================
+
+    // ノードごとの前回の状態（ノードのアドレス順に整列）
+    struct DamageRecord {
+        const Node *node;
+        uint32_t revision;
+        uint32_t inputsKey;  // 上流の接続状態
+        DamageRect bounds;   // 出力AABB（スクリーン座標）
+    };
+
+    // 今回の評価結果（DAG共有ノードの重複評価防止を兼ねる）
+    struct DamageWork {
+        DamageRecord record;
+        DamageRegion region;  // このノードの出力に生じたダメージ
+    };
+
+    std::vector<DamageRecord> damageRecords_;
+    std::vector<DamageWork> damageWork_;
+    uint32_t pushStateKey_ = 0;
+    DamageRegion damage_;
+
+    // ダメージ領域を求め、部分描画するかを決定する（execPrepareから呼ぶ）
+    void updateDamage(Node *upstream, Node *downstream);
+
+    // nodeの出力のダメージを上流から再帰的に求める（戻り値: damageWork_ のインデックス）
+    size_t collectDamage(Node *node);
+
+    // 下流側の状態（ノード・変更カウンタ・仮想スクリーン・pivot）のキー
+    uint32_t computePushStateKey(Node *downstream) const;
+
+    // prepare後のAABBをスクリーン座標の矩形に変換（丸め誤差分1px拡張、画面外も保持）
+    DamageRect toScreenRect(const PrepareResponse &aabb) const;
+
+    // ダメージ区間 [x0, x1) のタイル行 tileY を処理
+    void processDamageSpan(int_fast16_t x0, int_fast16_t x1, int_fast16_t tileY);
+
+    // ========================================
+    // バンド並列実行
+    // ========================================
+
+    // ワーカー1以降が使用するリソース一式（ワーカー0はcontext_/entryPool_）
+    struct WorkerSlot {
+        core::memory::ScanlineArenaAllocator arena;  // エントリプールより後に破棄
+        ImageBufferEntryPool entryPool;
+        RenderContext context;
+    };
+
+    core::IParallelExecutor *executor_ = nullptr;
+    std::unique_ptr<WorkerSlot[]> workers_;  // workerSlotCount_ 個（MAX_WORKERS-1 以下）
+    core::memory::IAllocator *workerAllocators_[RenderContext::MAX_WORKERS] = {};
+    int16_t workerSlotCount_  = 0;
+    int16_t requestedWorkers_ = 0;
+    int16_t bandCount_        = 1;  // execPrepareで決定したバンド数
+    int16_t lastBandCount_    = 1;
+
+    WorkerSlot &workerSlot(int_fast16_t index)
+    {
+        return workers_[static_cast<size_t>(index)];
+    }
+
+    // バンド数を決定し、必要なワーカースロットを準備する
+    void setupWorkers();
+
+    // バンド処理（index番目のバンドの全スキャンラインを処理）
+    void processBand(int_fast16_t bandIndex);
+    static void bandTask(int_fast16_t bandIndex, void *userData)
+    {
+        static_cast<RendererNode *>(userData)->processBand(bandIndex);
+    }
+
+    // 指定範囲のスキャンラインを処理
+    void processRows(int_fast16_t tyBegin, int_fast16_t tyEnd);
+
     // タイルサイズ取得
-    // 注: パイプライン上のリクエストは必ずスキャンライン（height=1）
-    //     これにより各ノードの最適化が可能になる
+    // 注: パイプライン上のリクエストは原則スキャンライン（height=1）
+    //     ストリップ処理は全ノードが対応している場合のみ（activeStripHeight_）
     int_fast16_t effectiveTileWidth() const
     {
         return tileConfig_.isEnabled() ? tileConfig_.tileWidth : virtualWidth_;
@@ -245,9 +560,9 @@ private:
 
     int_fast16_t effectiveTileHeight() const
     {
-        // スキャンライン必須（height=1）
+        // スキャンライン（height=1）またはストリップ
         // TileConfig の tileHeight は無視される
-        return 1;
+        return activeStripHeight_;
     }
 
     // タイル数取得
@@ -47,6 +47,7 @@ public:
     void setTarget(const ViewPort &vp)
     {
         target_ = vp;
+        markDirty();
     }
 
     // pivot 設定（出力バッファ座標、変換の中心点）
@@ -54,11 +55,13 @@ public:
     {
         pivotX_ = x;
         pivotY_ = y;
+        markDirty();
     }
     void setPivot(float x, float y)
     {
         pivotX_ = float_to_fixed(x);
         pivotY_ = float_to_fixed(y);
+        markDirty();
     }
 
     // 便利メソッド: ターゲット中央を pivot に設定
@@ -66,6 +69,7 @@ public:
     {
         pivotX_ = to_fixed(target_.width / 2);
         pivotY_ = to_fixed(target_.height / 2);
+        markDirty();
     }
 
     // アクセサ
@@ -124,6 +128,18 @@ protected:
     // SinkNodeは終端なので下流への伝播なし
     void onPushProcess(RenderResponse &input, const RenderRequest &request) override;
 
+    // ストリップ処理: 非アフィン時は入力の全行をそのまま転送できる
+    bool canProcessStrip() const override
+    {
+        return !hasAffine_;
+    }
+
+    // 行列変更を差分描画の変更として記録
+    void onTransformChanged() override
+    {
+        markDirty();
+    }
+
 private:
     ViewPort target_;
     int_fixed pivotX_ = 0;  // 変換の中心点X（出力バッファ座標、固定小数点 Q16.16）
@@ -7,7 +7,9 @@
 #include "../core/perf_metrics.h"
 #include "../image/image_buffer.h"
 #include "../image/viewport.h"
+#include "../operations/filters.h"
 #include "../operations/transform.h"
+#include <vector>
 #ifdef FLEXIMG_DEBUG_PERF_METRICS
 #include <cstdio>
 #endif
@@ -19,8 +21,19 @@ namespace FLEXIMG_NAMESPACE {
 // ========================================================================
 
 enum class InterpolationMode {
-    Nearest,  // 最近傍補間（デフォルト）
-    Bilinear  // バイリニア補間（RGBA8888のみ対応）
+    Nearest,   // 最近傍補間（デフォルト）
+    Bilinear,  // バイリニア補間（RGBA8888のみ対応）
+    Area       // 面積平均（回転なしの縮小時のみ、それ以外はBilinearと同じ）
+};
+
+// ========================================================================
+// MipmapMode - ミップマップ（縮小時のレベル選択）
+// ========================================================================
+
+enum class MipmapMode {
+    None,     // ミップマップなし（デフォルト）
+    Nearest,  // 縮小率に最も近いレベルを使用
+    Linear    // 隣接する2レベルを合成（トリリニア、Bilinear時のみ。それ以外はNearestと同じ）
 };
 
 // ========================================================================
@@ -48,7 +61,7 @@ public:
     }
 
     SourceNode(const ViewPort &vp, int_fixed pivotX = 0, int_fixed pivotY = 0)
-        : source_(vp), pivotX_(pivotX), pivotY_(pivotY)
+        : source_(vp), view_(vp), pivotX_(pivotX), pivotY_(pivotY)
     {
         initPorts(0, 1);
     }
@@ -56,13 +69,21 @@ public:
     // ソース設定
     void setSource(const ViewPort &vp)
     {
-        source_  = vp;
-        palette_ = PaletteData();
+        source_    = vp;
+        view_      = vp;
+        palette_   = PaletteData();
+        trimValid_ = false;
+        mipValid_  = false;
+        markDirty();
     }
     void setSource(const ViewPort &vp, const PaletteData &palette)
     {
-        source_  = vp;
-        palette_ = palette;
+        source_    = vp;
+        view_      = vp;
+        palette_   = palette;
+        trimValid_ = false;
+        mipValid_  = false;
+        markDirty();
     }
 
     // 基準点設定（pivot: 画像内のアンカーポイント）
@@ -70,11 +91,13 @@ public:
     {
         pivotX_ = x;
         pivotY_ = y;
+        markDirty();
     }
     void setPivot(float x, float y)
     {
         pivotX_ = float_to_fixed(x);
         pivotY_ = float_to_fixed(y);
+        markDirty();
     }
 
     // アクセサ
@@ -110,35 +133,200 @@ public:
     {
         colorKeyRGBA8_   = colorKeyRGBA8;
         colorKeyReplace_ = replaceRGBA8;
+        trimValid_       = false;
+        mipValid_        = false;
+        markDirty();
     }
     void clearColorKey()
     {
         colorKeyRGBA8_   = 0;
         colorKeyReplace_ = 0;
+        trimValid_       = false;
+        mipValid_        = false;
+        markDirty();
     }
 
     // 補間モード設定
     void setInterpolationMode(InterpolationMode mode)
     {
         interpolationMode_ = mode;
+        markDirty();
     }
     InterpolationMode interpolationMode() const
     {
         return interpolationMode_;
     }
 
+    // 補間モード Area（面積平均）:
+    // - 回転・せん断なし（逆行列の b == c == 0）で、いずれかの軸が縮小の場合に有効
+    //   それ以外の行列ではBilinearと同じ（バイリニア非対応フォーマットは最近傍）
+    // - 出力ピクセルの矩形（ソース座標で |invA| x |invD|）に掛かるソースピクセルを、
+    //   重なり面積で重み付けしたα加重平均を出力する（出力はRGBA8_Straight）
+    // - 有効範囲は最近傍と同じ（出力ピクセル中心がソース内）、矩形のソース外部分は透明として扱う
+    // - ソース行は出力行ごとに1回だけ読み、水平方向に縮小した行を垂直方向に累積する
+    //   隣接する出力行の境界の行は縮小結果を再利用するため、上から順に要求される限り
+    //   ソースの各バイトは1回しか読まない
+    // 面積平均パスの使用判定（prepare後に有効）
+    bool isAreaAveraging() const
+    {
+        return useArea_;
+    }
+
+    // ミップマップ設定（デフォルト: None）
+    // 縮小時（出力1ピクセルあたりのソース上の移動量 ρ > 1）に、元画像を 1/2 ずつ縮小したレベル
+    // （RGBA8_Straight、2x2 のα加重平均）からサンプリングする。回転を含む縮小でも
+    // 出力ピクセルあたりに読むソースの範囲が縮小率によらず一定になる
+    // - レベルは prepare 時に逆行列の縮小率から選択（Nearest: round(log2 ρ)、Linear: floor(log2 ρ)）
+    // - Linear かつ Bilinear 補間では、隣接する2レベルの結果を縮小率の端数で合成（トリリニア）
+    // - 必要なレベルまで prepare 時に作成し、setSource() / カラーキー変更まで保持する
+    //   （メモリ: 元画像の RGBA8 換算で最大約 1/3、persistentAllocator から確保）
+    // - 補間モード Area では使用しない（面積平均が縮小を直接扱う）
+    void setMipmapMode(MipmapMode mode)
+    {
+        mipmapMode_ = mode;
+        if (mode == MipmapMode::None) {
+            mipLevels_.clear();
+        }
+        markDirty();
+    }
+    MipmapMode mipmapMode() const
+    {
+        return mipmapMode_;
+    }
+    // prepare で選択されたレベル（0: 元画像）と、作成済みのレベル数
+    int mipLevel() const
+    {
+        return mipLevel_;
+    }
+    int mipLevelCount() const
+    {
+        return static_cast<int>(mipLevels_.size());
+    }
+
     // エッジフェードアウト設定（バイリニア補間時のみ有効）
     // フェード有効な辺では出力範囲が0.5ピクセル拡張され、境界がなめらかに透明化
     // フェード無効な辺では出力範囲はNearestと同じ、境界ピクセルはクランプ
     void setEdgeFade(uint8_t flags)
     {
         edgeFadeFlags_ = flags;
+        markDirty();
     }
     uint8_t edgeFade() const
     {
         return edgeFadeFlags_;
     }
 
+    // 行範囲テーブル設定（アフィン変換時のみ使用、デフォルト: 有効）
+    // prepare時にAABBの各行（スクリーン内のみ）の有効範囲を事前計算し、
+    // getDataRange / process ごとの範囲計算（除算）を配列参照に置き換える
+    // メモリ: 8バイト × 行数（フレームを跨いで再利用）
+    void setRowSpanTableEnabled(bool enabled)
+    {
+        rowSpanTableEnabled_ = enabled;
+        markDirty();
+    }
+    bool isRowSpanTableEnabled() const
+    {
+        return rowSpanTableEnabled_;
+    }
+
+    // 列テーブル設定（回転・せん断なし（逆行列の b == c == 0）の拡大縮小時のみ使用、デフォルト: 有効）
+    // 全出力行が同じソース列を参照するため、prepare時にスクリーンの各列のソース列
+    // （バイリニアはX方向の重みも）を事前計算し、行ごとのDDA計算をテーブル参照に置き換える
+    // - 最近傍: 1/2/3/4 バイト/ピクセルのフォーマット（bit-packed は DDA のまま）
+    // - バイリニア: RGBA8_Straight（ミップレベルを含む）の4近傍がソース内の列のみ、両端はDDA
+    //   （カラーキー指定時は DDA のまま）
+    // - 最近傍で縦方向に拡大する場合、同じソース行を参照する連続した要求は直前の行を複製する
+    // メモリ: 5バイト × スクリーン幅（フレームを跨いで再利用）+ ワーカーごとに1行分の行キャッシュ
+    void setColumnMapEnabled(bool enabled)
+    {
+        columnMapEnabled_ = enabled;
+        markDirty();
+    }
+    bool isColumnMapEnabled() const
+    {
+        return columnMapEnabled_;
+    }
+    // 列テーブルパスの使用判定（prepare後に有効）
+    bool isColumnMapActive() const
+    {
+        return useColumnMap_;
+    }
+
+    // 転置キャッシュ設定（90度/270度回転（逆行列の a == d == 0）の最近傍補間時のみ使用、デフォルト: 有効）
+    // 90度回転では出力1行がソースの1列を縦に読むため、ピクセルごとに別のキャッシュラインに触れる
+    // ソースの TransposeBlock 列分を転置した帯を作成し、出力行は帯の1行を横に読む DDA で転写する
+    // - 帯は要求行が参照するソース行の範囲（TransposeBlock 行単位）のみ作成し、
+    //   続く出力行（隣接するソース列）では作り直さない（ソースの各ピクセルは1回だけ読む）
+    // - 1/2/3/4 バイト/ピクセルのフォーマット（bit-packed は DDA のまま）、結果は DDA と同一
+    // - 180度回転・左右上下反転は列テーブル（setColumnMapEnabled）で処理される
+    // メモリ: ワーカーごとに TransposeBlock × ソース高さ のピクセル
+    void setTransposeCacheEnabled(bool enabled)
+    {
+        transposeCacheEnabled_ = enabled;
+        markDirty();
+    }
+    bool isTransposeCacheEnabled() const
+    {
+        return transposeCacheEnabled_;
+    }
+    // 転置キャッシュの使用判定（prepare後に有効）
+    bool isTransposeCacheActive() const
+    {
+        return useTransposeCache_;
+    }
+
+    // 射影変換（3x3 ホモグラフィ、擬似3Dのカードめくり等）
+    // pivot 基準のソース座標に射影変換を適用してから、アフィン変換（matrix() と下流の AffineNode）を適用する
+    //   ワールド座標 = 下流のアフィン × matrix() × perspective × (ソース座標 - pivot)
+    // - スキャンラインごとの有効範囲は、ソース矩形の4辺と w > 0（視点の手前）の半直線の共通部分
+    // - 行内は PerspectiveSpan ピクセルごと（スクリーン列の境界に揃える）にソース座標を除算で求め、
+    //   その間は線形補間した DDA で転写する（タイル・差分描画の分割位置によらず同じ結果）
+    //   （中間バッファなし、1ピクセルあたりの処理はアフィン変換の DDA と同じ）
+    //   補間誤差がスクリーン上で 1/8 ピクセルを超える部分は区間を短くする
+    // - Nearest / Bilinear（Area は Bilinear と同じ）に対応
+    //   ミップマップ・列テーブル・転置キャッシュ・透明部分のトリミングは使用しない
+    // - w <= 0 の領域を含む場合（視点の後ろに回り込む）、出力範囲はスクリーン全体とする
+    void setPerspective(const PerspectiveMatrix &m)
+    {
+        perspective_        = m;
+        perspectiveEnabled_ = true;
+        markDirty();
+    }
+    void clearPerspective()
+    {
+        perspective_        = PerspectiveMatrix();
+        perspectiveEnabled_ = false;
+        markDirty();
+    }
+    bool hasPerspective() const
+    {
+        return perspectiveEnabled_;
+    }
+    const PerspectiveMatrix &perspective() const
+    {
+        return perspective_;
+    }
+
+    // 透明部分のトリミング設定（最近傍補間時のみ有効、デフォルト: 無効）
+    // ソース画像の各行で最初と最後の非透明ピクセル（alpha != 0）を記録し、
+    // 透明な余白をサンプリング・変換・合成しない（円形スプライトやアイコン向け）
+    // - 走査は有効化・setSource()・カラーキー変更後の最初のprepareで1回だけ行う
+    // - 画像データを書き換えた場合は setSource() を呼び直す
+    // - 回転時は非透明ピクセルを含む矩形、回転なし（拡大縮小・反転のみ）では行ごとの範囲で制限
+    // - 全ピクセル不透明な画像は行範囲を保持しない
+    // 注意: 余白の透明ピクセルは出力されないため、出力先に直接描画する場合は余白部分が書き換わらない
+    void setAlphaTrimEnabled(bool enabled)
+    {
+        alphaTrimEnabled_ = enabled;
+        trimValid_        = false;
+        markDirty();
+    }
+    bool isAlphaTrimEnabled() const
+    {
+        return alphaTrimEnabled_;
+    }
+
     const char *name() const override
     {
         return "SourceNode";
@@ -161,8 +349,22 @@ public:
     // AABB上限が必要な場合は getDataRangeBounds() を使用
     DataRange getDataRange(const RenderRequest &request) const override;
 
+    // ストリップ処理: 非アフィン時はサブビュー参照で複数行をそのまま返せる
+    // 透明部分のトリミング時は行ごとに範囲が異なるため非対応（余白を出力しない）
+    bool canProcessStrip() const override
+    {
+        return !hasAffine_ && !trimActive_;
+    }
+
+    // 行列変更を差分描画の変更として記録
+    void onTransformChanged() override
+    {
+        markDirty();
+    }
+
 private:
     ViewPort source_;
+    ViewPort view_;         // サンプリング対象（source_ またはミップレベル、prepareで決定）
     PaletteData palette_;   // パレット情報（インデックスフォーマット用、非所有）
     int_fixed pivotX_ = 0;  // 画像内の基準点X（pivot: 回転・配置の中心、固定小数点 Q16.16）
     int_fixed pivotY_ = 0;  // 画像内の基準点Y（pivot: 回転・配置の中心、固定小数点 Q16.16）
@@ -176,6 +378,7 @@ private:
     AffinePrecomputed affine_;  // 逆行列・ピクセル中心オフセット
     bool hasAffine_   = false;  // アフィン変換が伝播されているか
     bool useBilinear_ = false;  // バイリニア補間を使用するか（事前計算結果）
+    bool useArea_     = false;  // 面積平均を使用するか（事前計算結果）
 
     // フォーマット交渉（下流からの希望フォーマット）
     PixelFormatID preferredFormat_ = PixelFormatIDs::RGBA8_Straight;
@@ -196,6 +399,162 @@ private:
     // NinePatchSourceNode等から同一requestで複数回呼ばれるケースに対応
     mutable core::DataRangeCache dataRangeCache_;
 
+    // 行範囲テーブル（prepare origin 基準、行 rowSpanTop_ から）
+    // start/end は deltaX = 0 での有効範囲 [start, end)（リクエスト幅でのクリップ前）
+    // 要求 deltaX の範囲は [start - deltaX, end - deltaX) をリクエスト幅でクリップして得る
+    struct RowSpan {
+        int32_t start;
+        int32_t end;
+    };
+    // スクリーン内（0 <= deltaY < rowSpanScreenHeight_）のテーブル外の行はデータなし
+    std::vector<RowSpan> rowSpans_;
+    int32_t rowSpanTop_          = 0;
+    int32_t rowSpanScreenHeight_ = 0;  // 0: テーブルなし
+    bool rowSpanTableEnabled_    = true;
+
+    // 列テーブル（prepare origin 基準のスクリーン列 s → ViewPort基準のソース列）
+    // 最近傍: colMap_[s] はソース幅にクランプ済み
+    // バイリニア: colMap_[s] / colWeights_[s] は4近傍の左上の列とX方向の重み（0〜255）、
+    //            4近傍がソース内の列は [colInteriorStart_, colInteriorEnd_)（範囲外の列の値は未使用）
+    std::vector<int32_t> colMap_;
+    std::vector<uint8_t> colWeights_;
+    int32_t colInteriorStart_ = 0;
+    int32_t colInteriorEnd_   = 0;
+    bool columnMapEnabled_    = true;
+    bool useColumnMap_        = false;  // 今回のprepareで列テーブルを使用するか
+    bool colMapReuse_         = false;  // 最近傍で縦方向に拡大（連続する行が同じソース行を参照しうる）
+
+    // 最近傍の行キャッシュ（ワーカー単位）: ソース行 srcRow のスクリーン列 [start, end) の転写結果
+    struct ColumnMapRow {
+        std::vector<uint8_t> pixels;  // スクリーン列 s のピクセルは pixels[s * bytesPerPixel]
+        int32_t srcRow = -1;          // -1: なし
+        int32_t start  = 0;
+        int32_t end    = 0;
+    };
+    ColumnMapRow colMapRows_[RenderContext::MAX_WORKERS];
+
+    // 転置キャッシュ（ワーカー単位）: ソース列 [column, column + TransposeBlock) を転置した帯
+    // 帯の行 r はソース列 column + r、ソース行 y のピクセルは行内の位置 y（有効なのは [y0, y1)）
+    static constexpr int_fast16_t TransposeBlock = 32;
+    struct TransposeStrip {
+        std::vector<uint8_t> pixels;
+        int32_t column = -1;  // -1: なし
+        int32_t y0     = 0;
+        int32_t y1     = 0;
+    };
+    TransposeStrip transposeStrips_[RenderContext::MAX_WORKERS];
+    bool transposeCacheEnabled_ = true;
+    bool useTransposeCache_     = false;  // 今回のprepareで転置キャッシュを使用するか
+
+    // 射影変換（prepareで計算）
+    // perspectiveInv_: ワールド座標 (x, y, 1) → ソースピクセル座標の同次座標 (X, Y, W)（pivot を含む）
+    // perspMin/Max: ピクセル中心のソース座標の有効範囲 [min, max]（Q16.16、バイリニアはフェード分を含む）
+    static constexpr int_fast16_t PerspectiveSpan = 64;  // 除算の最大間隔（ピクセル）
+    PerspectiveMatrix perspective_;
+    PerspectiveMatrix perspectiveInv_;
+    int_fixed perspMinX_     = 0;
+    int_fixed perspMaxX_     = 0;
+    int_fixed perspMinY_     = 0;
+    int_fixed perspMaxY_     = 0;
+    bool perspectiveEnabled_ = false;
+    bool usePerspective_     = false;  // 今回のprepareで射影変換を使用するか（逆行列が有効）
+
+    // 透明部分のトリミング情報（ソース座標系）
+    // trimRows_: ソース行ごとの非透明ピクセル範囲 [startX, endX)（空行は {0, 0}）
+    //            全ピクセル不透明・全行が全幅の画像では空（トリミング不要）
+    // trimBounds_: 非透明ピクセルを含む矩形（空画像は幅0）
+    std::vector<DataRange> trimRows_;
+    DataRange trimBounds_;
+    int16_t trimTop_       = 0;
+    int16_t trimBottom_    = 0;
+    bool alphaTrimEnabled_ = false;
+    bool trimValid_        = false;  // trimRows_ が現在のソースに対して走査済みか
+    bool trimActive_       = false;  // 今回のprepareでトリミングを使用するか（最近傍のみ）
+    int_fixed trimOffsetX_ = 0;      // 有効矩形の左上（ソース座標、Q16.16）
+    int_fixed trimOffsetY_ = 0;
+
+    // 面積平均パスの状態（ワーカー単位、バッファはフレームを跨いで再利用）
+    // 列テーブル: 出力列 j はソース列 srcX0 + colFirst[j] から colTap[j + 1] - colTap[j] 個、
+    //            重みは weights[colTap[j]...]（各列の合計 256、ソース外の列は含まない）
+    // rowSum: 直近に水平縮小したソース行 cachedRow の列ごとのα加重合計（合計 ≤ 256 * 255 * 255）
+    //         acc と同じくチャンネルごとの配列（R[count], G[count], B[count], A[count]）
+    struct AreaState {
+        std::vector<int32_t> colFirst;
+        std::vector<uint32_t> colTap;
+        std::vector<uint16_t> weights;
+        std::vector<uint16_t> premul;  // 変換済みソース行（RGB × A, A）
+        std::vector<uint32_t> rowSum;
+        std::vector<uint32_t> acc;   // 出力行の累積（合計 ≤ 65536 * 255 * 255 < 2^32）
+        int32_t edgeX      = 0;      // 列テーブルの先頭列の端（ソース座標 Q16.16）
+        int32_t srcX0      = 0;      // 列テーブルが参照するソース列の範囲 [srcX0, srcX1)
+        int32_t srcX1      = 0;
+        int_fast16_t count = 0;
+        int32_t cachedRow  = -1;     // rowSum のソース行（-1: なし）
+        bool tableValid    = false;  // 列テーブルが現在のprepareで作成済みか
+    };
+    AreaState areaStates_[RenderContext::MAX_WORKERS];
+    FormatConverter rgbaConverter_;  // ソース → RGBA8_Straight（パレット・カラーキー適用）
+
+    // ミップマップ（mipLevels_[L - 1] がレベル L）
+    MipmapMode mipmapMode_ = MipmapMode::None;
+    std::vector<ImageBuffer> mipLevels_;
+    core::memory::IAllocator *mipAllocator_ = nullptr;  // mipLevels_ の確保に使ったアロケータ
+    int8_t mipLevel_                        = 0;        // 今回のprepareで使用するレベル
+    uint16_t mipBlend_                      = 0;        // レベル mipLevel_ + 1 の合成比率（0〜255、トリリニア）
+    bool mipValid_                          = false;    // mipLevels_ が現在のソースに対して作成済みか
+
+    bool selectMipLevel();
+    bool ensureMipLevels(int count);
+    ImageBuffer buildMipLevel(const ViewPort &src, bool convert) const;
+    static void blendMipRow(uint8_t *dst, const uint8_t *coarse, int_fast16_t count, uint_fast16_t weight);
+
+    // ソース → RGBA8_Straight の変換を rgbaConverter_ に解決（失敗時は false）
+    bool prepareRGBA8Converter();
+    // 面積平均で1行を出力（dst: RGBA8_Straight、count ピクセル）
+    void areaAverageRow(uint8_t *dst, int_fast16_t count, int32_t dxStart, int32_t baseX, int32_t baseY);
+    void buildAreaColumns(AreaState &state, int32_t edgeX, int_fast16_t count) const;
+    void reduceAreaRow(AreaState &state, int32_t srcY) const;
+
+    // 列テーブルを作成（b == c == 0 で、フォーマットが対応する場合のみ）
+    void buildColumnMap(int_fast16_t screenWidth);
+    // 列テーブルで最近傍の1行を出力（screenX: 先頭ピクセルのスクリーン列、srcY: ソース行）
+    void columnMapRow(uint8_t *dst, int32_t screenX, int_fast16_t count, int32_t srcY);
+    // 列テーブルでバイリニア補間の1行を出力（srcX, srcY: copyRowDDABilinear に渡す座標）
+    // 戻り値: false=テーブル対象外の行（呼び出し側でDDAを使用）
+    bool columnMapBilinearRow(uint32_t *dst, int32_t screenX, int_fast16_t count, int_fixed srcX,
+                              int_fixed srcY) const;
+
+    // 転置キャッシュ経由で最近傍の1行を出力（srcX, srcY: 先頭ピクセルのソース座標、srcX は行内で一定）
+    void transposedRow(uint8_t *dst, int_fast16_t count, int_fixed srcX, int_fixed srcY);
+
+    // 射影変換の prepare（合成アフィン行列 combined の前に perspective_ を適用）
+    void preparePerspective(const PrepareRequest &request, const AffineMatrix &combined, PrepareResponse &result);
+    // 射影変換のスキャンライン有効範囲 [dxStart, dxEnd]（戻り値: false=有効範囲なし）
+    bool calcPerspectiveRange(const RenderRequest &request, int32_t &dxStart, int32_t &dxEnd) const;
+    // 射影変換で1行を出力（output の幅 = 有効範囲のピクセル数、dxStart: 先頭ピクセルの要求内の位置）
+    void perspectiveRow(ImageBuffer &output, const RenderRequest &request, int32_t dxStart,
+                        const PixelAuxInfo *aux) const;
+
+    // ソース画像を走査し、行ごとの非透明範囲を記録
+    void updateAlphaTrim();
+
+    // 床関数除算（行範囲テーブル用）
+    static int32_t floorDiv(int32_t n, int32_t d);
+
+    // 回転なし時の行ごとのトリミング（baseY のソース行の範囲で [left, right) を制限）
+    // floorDivision: 行範囲テーブル用（床関数除算）
+    void clipToTrimRow(int32_t baseX, int32_t baseY, int32_t &left, int32_t &right, bool floorDivision) const;
+
+    // 非アフィン（平行移動のみ）の有効範囲を計算（onPullProcess/getDataRangeで共用）
+    bool calcTranslationRange(const RenderRequest &request, int32_t &srcBaseX, int32_t &srcBaseY,
+                              int32_t &dxStartX, int32_t &dxEndX, int32_t &dxStartY, int32_t &dxEndY) const;
+
+    // 行範囲テーブルを作成（アフィン変換時のみ、範囲はAABBとスクリーンの共通部分）
+    void buildRowSpanTable(const PrepareRequest &request, const PrepareResponse &aabb);
+
+    // deltaY 行の有効範囲を計算（deltaX = 0、幅クリップなし）
+    RowSpan calcRowSpan(int32_t deltaY) const;
+
     // スキャンライン有効範囲を計算（pullProcessWithAffineで使用）
     // 戻り値: true=有効範囲あり, false=有効範囲なし
     // baseXWithHalf/baseYWithHalf はオプショナル出力（nullptrなら出力しない）
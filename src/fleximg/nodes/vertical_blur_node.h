@@ -1,9 +1,11 @@
 #ifndef FLEXIMG_VERTICAL_BLUR_NODE_H
 #define FLEXIMG_VERTICAL_BLUR_NODE_H
 
+#include "../core/data_range_cache.h"
 #include "../core/node.h"
 #include "../core/perf_metrics.h"
 #include "../image/image_buffer.h"
+#include "../operations/filters.h"
 #include <algorithm>
 #include <cstdint>  // for int32_t, uint32_t
 #include <cstring>
@@ -34,6 +36,12 @@ namespace FLEXIMG_NAMESPACE {
 // - pullProcess()で行キャッシュと列合計を使用したスライディングウィンドウ処理
 // - finalize()でキャッシュを破棄
 //
+// バンド分割（pull型）:
+// - 最初の要求行、または kernelSize 行以上離れた行への移動をバンド開始とみなし、
+//   上方向 radius * passes 行のハロー行を上流からpullしてウィンドウを充填する
+// - バンド並列実行時はワーカーごとに独立したステージ（行キャッシュ・列合計）を持つ
+// - push型は入力行の順序に依存するため逐次実行のみ
+//
 // 使用例:
 //   VerticalBlurNode vblur;
 //   vblur.setRadius(6);
@@ -62,11 +70,13 @@ public:
     void setRadius(int_fast16_t radius)
     {
         radius_ = static_cast<int16_t>((radius < 0) ? 0 : (radius > kMaxRadius) ? kMaxRadius : radius);
+        markDirty();
     }
 
     void setPasses(int_fast16_t passes)
     {
         passes_ = static_cast<int16_t>((passes < 1) ? 1 : (passes > kMaxPasses) ? kMaxPasses : passes);
+        markDirty();
     }
 
     int16_t radius() const
@@ -96,8 +106,16 @@ public:
     }
 
     // getDataRange: 上下radius*passes行の上流DataRange和集合を返す
+    // （出力行のみで決まり、ウィンドウ状態やバンド分割に依存しない）
     DataRange getDataRange(const RenderRequest &request) const override;
 
+    // 差分描画: 上流の変更は上下 radius * passes 行に波及する
+    void damageMargin(int_fast16_t &marginX, int_fast16_t &marginY) const override
+    {
+        marginX = 0;
+        marginY = static_cast<int_fast16_t>(radius_ * passes_);
+    }
+
     // 準備・終了処理（pull型用）
     void prepare(const RenderRequest &screenInfo) override;
     void finalize() override;
@@ -161,7 +179,10 @@ private:
     };
 
     // パイプラインステージ（passes個、passes=1でもstages_[0]を使用）
+    // ワーカー0（逐次実行・push型）用
     std::vector<BlurStage> stages_;
+    // ワーカー1以降用（要素数はprepareで確定、各要素は初回使用時に確保）
+    std::vector<std::vector<BlurStage>> workerStages_;
     int16_t cacheWidth_        = 0;
     int_fixed cacheOriginX_    = 0;      // キャッシュの基準X座標（pull型用）
     int_fixed upstreamOriginX_ = 0;      // 上流pullProcessのorigin.x（radius=0と同じ出力用）
@@ -181,25 +202,24 @@ private:
     int_fixed pushInputOriginY_ = 0;
     int_fixed lastInputOriginY_ = 0;
 
-    // getDataRange/pullProcess 間のキャッシュ
-    struct DataRangeCache {
-        Point origin   = {INT32_MIN, INT32_MIN};  // キャッシュキー（無効値で初期化）
-        int16_t startX = 0;
-        int16_t endX   = 0;
-    };
-    mutable DataRangeCache rangeCache_;
+    // getDataRange/pullProcess 間のキャッシュ（ワーカー単位）
+    mutable core::DataRangeCache rangeCache_;
 
     // 内部実装（宣言のみ）
     RenderResponse &pullProcessPipeline(Node *upstream, const RenderRequest &request);
-    void updateStageCache(int_fast16_t stageIndex, Node *upstream, const RenderRequest &request, int_fast16_t newY);
+    std::vector<BlurStage> &pullStages();
+    void updateStageCache(std::vector<BlurStage> &stages, int_fast16_t stageIndex, Node *upstream,
+                          const RenderRequest &request, int_fast16_t newY);
     void fetchRowToStageCache(BlurStage &stage, Node *upstream, const RenderRequest &request, int_fast16_t srcY,
                               int_fast16_t cacheIndex);
-    void fetchRowFromPrevStage(int_fast16_t stageIndex, Node *upstream, const RenderRequest &request, int_fast16_t srcY,
-                               int_fast16_t cacheIndex);
+    void fetchRowFromPrevStage(std::vector<BlurStage> &stages, int_fast16_t stageIndex, Node *upstream,
+                               const RenderRequest &request, int_fast16_t srcY, int_fast16_t cacheIndex);
+    void resetStageWindow(BlurStage &stage);
     void updateStageColSum(BlurStage &stage, int_fast16_t cacheIndex, bool add);
     void computeStageOutputRow(BlurStage &stage, ImageBuffer &output, int_fast16_t width);
     void initializeStage(BlurStage &stage, int_fast16_t width);
     void initializeStages(int_fast16_t width);
+    void initializeStages(std::vector<BlurStage> &stages, int_fast16_t width);
     void propagatePipelineStages();
     void emitBlurredLinePipeline();
     void storeInputRowToStageCache(BlurStage &stage, const ImageBuffer &input, int_fast16_t cacheIndex,
@@ -24,6 +24,13 @@ struct LineFilterParams {
 /// ラインフィルタ関数型（RGBA8_Straight形式、インプレース処理）
 using LineFilterFunc = void (*)(uint8_t *pixels, int_fast16_t count, const LineFilterParams &params);
 
+/// ラインカーネル（フィルタ列の融合で直列実行する単位）
+struct LineKernel {
+    LineFilterFunc func            = nullptr;
+    const LineFilterParams *params = nullptr;  ///< ノードが所有するパラメータへの参照
+    int nodeType                   = 0;        ///< メトリクス用ノードタイプ
+};
+
 // ========================================================================
 // ラインフィルタ関数（スキャンライン処理用）
 // ========================================================================
@@ -44,6 +51,25 @@ void grayscale_line(uint8_t *pixels, int_fast16_t count, const LineFilterParams
 /// params.value1: アルファスケール（0.0〜1.0）
 void alpha_line(uint8_t *pixels, int_fast16_t count, const LineFilterParams &params);
 
+// ========================================================================
+// ボックスブラー正規化（HorizontalBlurNode / VerticalBlurNode 共通）
+// ========================================================================
+//
+// α加重の合計値（R×A, G×A, B×A, A）から RGBA8_Straight の1行を出力します。
+// 合計値はチャンネルごとの配列（SoA）で渡します。結果は整数除算と一致します:
+//   R = sumR / sumA, G = sumG / sumA, B = sumB / sumA, A = sumA / kernelSize
+//   （sumA == 0 のピクセルは全チャンネル 0）
+// 前提: sumA <= 255 * kernelSize, sumR/G/B <= 255 * sumA, kernelSize は 1〜256
+//
+
+/// ボックスブラー正規化（x86ではSIMD版を初回呼び出し時に選択）
+void boxBlurNormalize(uint8_t *dst, const uint32_t *sumR, const uint32_t *sumG, const uint32_t *sumB,
+                      const uint32_t *sumA, int_fast16_t count, int_fast16_t kernelSize);
+
+/// ボックスブラー正規化（スカラー版: 逆数乗算、除算はピクセルあたり1回）
+void boxBlurNormalizeScalar(uint8_t *dst, const uint32_t *sumR, const uint32_t *sumG, const uint32_t *sumB,
+                            const uint32_t *sumA, int_fast16_t count, int_fast16_t kernelSize);
+
 }  // namespace filters
 }  // namespace FLEXIMG_NAMESPACE
 
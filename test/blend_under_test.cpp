@@ -172,3 +172,134 @@ TEST_CASE("RGBA8_Straight blendUnderStraight verification") {
     }
   }
 }
+
+// =============================================================================
+// RGBA8_Straight blendUnderStraight Row Tests
+// =============================================================================
+//
+// 行単位の処理（4/8/16ピクセル単位の連続区間判定・SIMD版の端数処理）が
+// 1ピクセルずつの計算と一致することを検証
+
+namespace {
+
+// 1ピクセルのunder合成（スカラー版の正規化重み方式と同じ式）
+void blendUnderPixelReference(uint8_t *d, const uint8_t *s) {
+  uint32_t dstA = d[3];
+  uint32_t srcA = s[3];
+  if (dstA == 255 || srcA == 0) return;
+  if (dstA == 0) {
+    std::memcpy(d, s, 4);
+    return;
+  }
+  uint32_t total = dstA * 255 + srcA * (255 - dstA);
+  uint32_t dstW = (dstA * 255 * 256 + (total >> 1)) / total;
+  uint32_t srcW = 256 - dstW;
+  for (int c = 0; c < 3; c++) {
+    d[c] = static_cast<uint8_t>((d[c] * dstW + s[c] * srcW) >> 8);
+  }
+  d[3] = static_cast<uint8_t>((total + 127) / 255);
+}
+
+// 行をまとめて合成し、1ピクセルずつの参照結果と比較
+// dst・srcともに透明のピクセルは結果が経路依存のため、透明であることのみ確認
+bool verifyBlendUnderRow(const std::vector<uint8_t> &dstInit,
+                         const std::vector<uint8_t> &src, size_t offset,
+                         size_t pixelCount, std::string &errorMsg) {
+  std::vector<uint8_t> actual = dstInit;
+  std::vector<uint8_t> expected = dstInit;
+  PixelFormatIDs::RGBA8_Straight->blendUnderStraight(
+      actual.data() + offset * 4, src.data() + offset * 4, pixelCount,
+      nullptr);
+  for (size_t i = offset; i < offset + pixelCount; i++) {
+    blendUnderPixelReference(&expected[i * 4], &src[i * 4]);
+  }
+
+  for (size_t i = 0; i < dstInit.size() / 4; i++) {
+    const uint8_t *a = &actual[i * 4];
+    const uint8_t *e = &expected[i * 4];
+    bool inRange = i >= offset && i < offset + pixelCount;
+    bool bothTransparent = dstInit[i * 4 + 3] == 0 && src[i * 4 + 3] == 0;
+    bool ok = (inRange && bothTransparent) ? a[3] == 0 : compareRGBA8(a, e);
+    if (!ok) {
+      std::ostringstream oss;
+      oss << "Mismatch at pixel " << i << " (offset=" << offset
+          << " count=" << pixelCount << ") dst=" << rgba8ToString(&dstInit[i * 4])
+          << " src=" << rgba8ToString(&src[i * 4])
+          << " actual=" << rgba8ToString(a) << " expected=" << rgba8ToString(e);
+      errorMsg = oss.str();
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+TEST_CASE("RGBA8_Straight blendUnderStraight rows match per-pixel blend") {
+  std::string errorMsg;
+
+  SUBCASE("all dstA/srcA pairs") {
+    // 1行 = 1つのdstAに対する全srcA（256ピクセル）
+    std::vector<uint8_t> dst(256 * 4);
+    std::vector<uint8_t> src(256 * 4);
+    for (int dstA = 0; dstA < 256; dstA++) {
+      for (int srcA = 0; srcA < 256; srcA++) {
+        uint8_t *d = &dst[static_cast<size_t>(srcA) * 4];
+        uint8_t *s = &src[static_cast<size_t>(srcA) * 4];
+        d[0] = static_cast<uint8_t>(dstA * 7 + srcA);
+        d[1] = static_cast<uint8_t>(255 - srcA);
+        d[2] = static_cast<uint8_t>(dstA ^ srcA);
+        d[3] = static_cast<uint8_t>(dstA);
+        s[0] = static_cast<uint8_t>(srcA * 3 + dstA);
+        s[1] = static_cast<uint8_t>(dstA);
+        s[2] = static_cast<uint8_t>(255 - (dstA ^ srcA));
+        s[3] = static_cast<uint8_t>(srcA);
+      }
+      bool ok = verifyBlendUnderRow(dst, src, 0, 256, errorMsg);
+      CHECK_MESSAGE(ok, errorMsg);
+      if (!ok) break;
+    }
+  }
+
+  SUBCASE("random rows with runs, various offsets and lengths") {
+    // 不透明・透明の連続区間と半透明が混在する行（端数処理を含む長さ・位置）
+    constexpr size_t width = 80;
+    uint32_t seed = 12345;
+    auto next = [&seed]() {
+      seed = seed * 1103515245u + 12345u;
+      return static_cast<uint8_t>(seed >> 16);
+    };
+    auto randomAlpha = [&next](uint8_t mode) -> uint8_t {
+      if (mode < 64) return 0;
+      if (mode < 128) return 255;
+      return next();
+    };
+
+    std::vector<uint8_t> dst(width * 4);
+    std::vector<uint8_t> src(width * 4);
+    for (int iter = 0; iter < 200; iter++) {
+      uint8_t dstMode = next();
+      uint8_t srcMode = next();
+      for (size_t i = 0; i < width; i++) {
+        // 8ピクセルごとに区間の種類を切り替え
+        if ((i & 7) == 0) {
+          dstMode = next();
+          srcMode = next();
+        }
+        for (int c = 0; c < 3; c++) {
+          dst[i * 4 + static_cast<size_t>(c)] = next();
+          src[i * 4 + static_cast<size_t>(c)] = next();
+        }
+        dst[i * 4 + 3] = randomAlpha(dstMode);
+        src[i * 4 + 3] = randomAlpha(srcMode);
+      }
+      for (size_t offset = 0; offset < 4; offset++) {
+        for (size_t count = 0; offset + count <= width; count += 5) {
+          bool ok = verifyBlendUnderRow(dst, src, offset, count, errorMsg);
+          CHECK_MESSAGE(ok, errorMsg);
+          if (!ok) return;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,286 @@
+// fleximg CacheNode Tests
+// サブツリー描画結果キャッシュノードのテスト
+
+#include "doctest.h"
+
+#define FLEXIMG_NAMESPACE fleximg
+#include "fleximg/core/common.h"
+#include "fleximg/core/types.h"
+#include "fleximg/image/image_buffer.h"
+#include "fleximg/nodes/affine_node.h"
+#include "fleximg/nodes/brightness_node.h"
+#include "fleximg/nodes/cache_node.h"
+#include "fleximg/nodes/composite_node.h"
+#include "fleximg/nodes/horizontal_blur_node.h"
+#include "fleximg/nodes/renderer_node.h"
+#include "fleximg/nodes/sink_node.h"
+#include "fleximg/nodes/source_node.h"
+#include "fleximg/nodes/vertical_blur_node.h"
+
+#include <cstring>
+
+using namespace fleximg;
+
+// =============================================================================
+// Helper Functions
+// =============================================================================
+
+// onPullProcess() の呼び出し回数を数えるソース
+class PullCountingSourceNode : public SourceNode {
+public:
+  int processCount = 0;
+
+  RenderResponse &onPullProcess(const RenderRequest &request) override {
+    processCount++;
+    return SourceNode::onPullProcess(request);
+  }
+};
+
+static ImageBuffer createPatternImage(int width, int height, uint8_t seed) {
+  ImageBuffer img(width, height, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int x = 0; x < width; x++) {
+      row[x * 4 + 0] = static_cast<uint8_t>(x * 7 + seed);
+      row[x * 4 + 1] = static_cast<uint8_t>(y * 5 + seed);
+      row[x * 4 + 2] = static_cast<uint8_t>((x ^ y) + seed);
+      row[x * 4 + 3] = static_cast<uint8_t>(128 + ((x + y) & 127));
+    }
+  }
+  return img;
+}
+
+// 静的背景（回転ソース + ブラー）と動くスプライトを合成するシーン
+// useCache: 背景をCacheNode経由で合成するか
+struct BackgroundScene {
+  static constexpr int kSize = 80;
+  PullCountingSourceNode background;
+  HorizontalBlurNode hblur;
+  VerticalBlurNode vblur;
+  CacheNode cache;
+  SourceNode sprite;
+  CompositeNode composite{2};
+  AffineNode affine;
+  BrightnessNode brightness;
+  RendererNode renderer;
+  SinkNode sink;
+
+  BackgroundScene(ImageBuffer &dst, const ImageBuffer &bgImg,
+                  const ImageBuffer &spriteImg, bool useCache) {
+    int_fixed center = float_to_fixed(kSize / 2.0f);
+    background.setSource(bgImg.view());
+    background.setPivot(float_to_fixed(24.0f), float_to_fixed(24.0f));
+    background.setRotation(0.3f);
+    hblur.setRadius(2);
+    vblur.setRadius(3);
+    vblur.setPasses(2);
+    sprite.setSource(spriteImg.view());
+    sprite.setPivot(float_to_fixed(8.0f), float_to_fixed(8.0f));
+    sprite.setPosition(0.0f, 4.0f);
+    brightness.setAmount(0.0f);
+    sink.setTarget(dst.view());
+    sink.setPivot(center, center);
+
+    background >> hblur >> vblur;
+    if (useCache) {
+      vblur >> cache >> composite;
+    } else {
+      vblur >> composite;
+    }
+    sprite.connectTo(composite, 1);
+    composite >> affine >> brightness >> renderer >> sink;
+    renderer.setVirtualScreen(kSize, kSize);
+    renderer.setPivotCenter();
+  }
+};
+
+// 同じ設定の非キャッシュシーンで描画した結果と比較
+static bool matchesUncached(const ImageBuffer &dst, const ImageBuffer &bgImg,
+                            const ImageBuffer &spriteImg, float spriteX,
+                            int radius, float rotation) {
+  ImageBuffer ref(BackgroundScene::kSize, BackgroundScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  BackgroundScene scene(ref, bgImg, spriteImg, false);
+  scene.sprite.setPosition(spriteX, 4.0f);
+  scene.vblur.setRadius(radius);
+  scene.affine.setRotation(rotation);
+  scene.renderer.exec();
+  return std::memcmp(ref.data(), dst.data(),
+                     BackgroundScene::kSize * BackgroundScene::kSize * 4) == 0;
+}
+
+static void clearImage(ImageBuffer &img) {
+  std::memset(img.data(), 0, static_cast<size_t>(img.width() * img.height() * 4));
+}
+
+// =============================================================================
+// CacheNode Tests
+// =============================================================================
+
+TEST_CASE("CacheNode: serves static subtree without re-rendering") {
+  ImageBuffer bgImg = createPatternImage(48, 48, 31);
+  ImageBuffer spriteImg = createPatternImage(16, 16, 200);
+  ImageBuffer dst(BackgroundScene::kSize, BackgroundScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  BackgroundScene scene(dst, bgImg, spriteImg, true);
+
+  for (int frame = 0; frame < 4; frame++) {
+    CAPTURE(frame);
+    float x = static_cast<float>(frame * 6 - 10);
+    scene.sprite.setPosition(x, 4.0f);
+    clearImage(dst);
+    CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+    CHECK(matchesUncached(dst, bgImg, spriteImg, x, 3, 0.0f));
+  }
+
+  // 背景は初回のみ描画され、以降は上流を呼ばない
+  CHECK(scene.cache.isCacheValid());
+  CHECK(scene.cache.renderCount() == 1);
+  int pulls = scene.background.processCount;
+  scene.renderer.exec();
+  CHECK(scene.background.processCount == pulls);
+}
+
+TEST_CASE("CacheNode: upstream parameter change invalidates cache") {
+  ImageBuffer bgImg = createPatternImage(48, 48, 31);
+  ImageBuffer spriteImg = createPatternImage(16, 16, 200);
+  ImageBuffer dst(BackgroundScene::kSize, BackgroundScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  BackgroundScene scene(dst, bgImg, spriteImg, true);
+  scene.renderer.exec();
+  CHECK(scene.cache.renderCount() == 1);
+
+  // 上流ノードの setter は自動でキャッシュを無効化する
+  scene.vblur.setRadius(5);
+  clearImage(dst);
+  scene.renderer.exec();
+  CHECK(scene.cache.renderCount() == 2);
+  CHECK(matchesUncached(dst, bgImg, spriteImg, 0.0f, 5, 0.0f));
+
+  // 上流の行列変更
+  scene.background.setRotation(0.3f);
+  scene.renderer.exec();
+  CHECK(scene.cache.renderCount() == 3);
+
+  // 明示的な無効化（画像データの書き換え等）
+  scene.cache.invalidate();
+  scene.renderer.exec();
+  CHECK(scene.cache.renderCount() == 4);
+  scene.renderer.exec();
+  CHECK(scene.cache.renderCount() == 4);
+}
+
+TEST_CASE("CacheNode: downstream affine change re-renders in new space") {
+  ImageBuffer bgImg = createPatternImage(48, 48, 31);
+  ImageBuffer spriteImg = createPatternImage(16, 16, 200);
+  ImageBuffer dst(BackgroundScene::kSize, BackgroundScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  BackgroundScene scene(dst, bgImg, spriteImg, true);
+  scene.renderer.exec();
+
+  // 下流のアフィン変換はPrepareRequestとして伝播するため、キャッシュは再描画される
+  scene.affine.setRotation(0.5f);
+  clearImage(dst);
+  scene.renderer.exec();
+  CHECK(scene.cache.renderCount() == 2);
+  CHECK(matchesUncached(dst, bgImg, spriteImg, 0.0f, 3, 0.5f));
+
+  // 上流の切断でキャッシュは破棄される
+  scene.vblur.disconnectAll();
+  clearImage(dst);
+  scene.renderer.exec();
+  CHECK_FALSE(scene.cache.isCacheValid());
+}
+
+TEST_CASE("CacheNode: in-place downstream filter does not modify cache") {
+  ImageBuffer bgImg = createPatternImage(48, 48, 31);
+  ImageBuffer spriteImg = createPatternImage(16, 16, 200);
+  ImageBuffer dst(BackgroundScene::kSize, BackgroundScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  ImageBuffer first(BackgroundScene::kSize, BackgroundScene::kSize,
+                    PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  BackgroundScene scene(dst, bgImg, spriteImg, true);
+  scene.brightness.setAmount(0.2f);
+  scene.renderer.exec();
+  std::memcpy(first.data(), dst.data(),
+              BackgroundScene::kSize * BackgroundScene::kSize * 4);
+
+  // 毎フレーム同じ結果（キャッシュが累積的に明るくならない）
+  for (int i = 0; i < 3; i++) {
+    clearImage(dst);
+    scene.renderer.exec();
+    CHECK(std::memcmp(first.data(), dst.data(),
+                      BackgroundScene::kSize * BackgroundScene::kSize * 4) ==
+          0);
+  }
+  CHECK(scene.cache.renderCount() == 1);
+}
+
+TEST_CASE("CacheNode: cache format") {
+  CacheNode cache;
+  CHECK(cache.cacheFormat() == PixelFormatIDs::RGBA8_Straight);
+  cache.setCacheFormat(PixelFormatIDs::Index8); // インデックスは無視
+  CHECK(cache.cacheFormat() == PixelFormatIDs::RGBA8_Straight);
+  cache.setCacheFormat(PixelFormatIDs::Grayscale4_MSB); // bit-packedは無視
+  CHECK(cache.cacheFormat() == PixelFormatIDs::RGBA8_Straight);
+
+  // 不透明のRGB888背景をRGB888でキャッシュ: 出力はキャッシュなしと一致
+  ImageBuffer bgImg(40, 30, PixelFormatIDs::RGB888);
+  for (int y = 0; y < 30; y++) {
+    uint8_t *row = static_cast<uint8_t *>(bgImg.pixelAt(0, y));
+    for (int x = 0; x < 40 * 3; x++) {
+      row[x] = static_cast<uint8_t>(x * 3 + y * 11);
+    }
+  }
+  auto render = [&](ImageBuffer &dst, bool useCache) {
+    SourceNode src(bgImg.view(), float_to_fixed(20.0f), float_to_fixed(15.0f));
+    CacheNode node;
+    node.setCacheFormat(PixelFormatIDs::RGB888);
+    RendererNode renderer;
+    SinkNode sink(dst.view(), float_to_fixed(32.0f), float_to_fixed(32.0f));
+    if (useCache) {
+      src >> node >> renderer >> sink;
+    } else {
+      src >> renderer >> sink;
+    }
+    renderer.setVirtualScreen(64, 64);
+    renderer.setPivotCenter();
+    renderer.exec();
+    renderer.exec();
+    if (useCache) {
+      CHECK(node.renderCount() == 1);
+      CHECK(node.cacheBuffer().formatID() == PixelFormatIDs::RGB888);
+      CHECK(node.cacheBuffer().width() == 40);
+    }
+  };
+  ImageBuffer ref(64, 64, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  ImageBuffer dst(64, 64, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  render(ref, false);
+  render(dst, true);
+  CHECK(std::memcmp(ref.data(), dst.data(), 64 * 64 * 4) == 0);
+}
+
+TEST_CASE("CacheNode: combined with incremental prepare") {
+  ImageBuffer bgImg = createPatternImage(48, 48, 31);
+  ImageBuffer spriteImg = createPatternImage(16, 16, 200);
+  ImageBuffer dst(BackgroundScene::kSize, BackgroundScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  BackgroundScene scene(dst, bgImg, spriteImg, true);
+  scene.renderer.setIncrementalPrepareEnabled(true);
+
+  for (int frame = 0; frame < 3; frame++) {
+    CAPTURE(frame);
+    float x = static_cast<float>(frame * 5);
+    scene.sprite.setPosition(x, 4.0f);
+    clearImage(dst);
+    scene.renderer.exec();
+    CHECK(matchesUncached(dst, bgImg, spriteImg, x, 3, 0.0f));
+  }
+  CHECK(scene.cache.renderCount() == 1);
+
+  scene.vblur.setRadius(4);
+  clearImage(dst);
+  scene.renderer.exec();
+  CHECK(scene.cache.renderCount() == 2);
+  CHECK(matchesUncached(dst, bgImg, spriteImg, 10.0f, 4, 0.0f));
+}
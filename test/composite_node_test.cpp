@@ -2,6 +2,8 @@
 // 合成ノードのテスト
 
 #include "doctest.h"
+#include <cstring>
+#include <vector>
 
 #define FLEXIMG_NAMESPACE fleximg
 #include "fleximg/core/common.h"
@@ -494,6 +496,247 @@ TEST_CASE("CompositeNode non-overlapping regions use convertFormat") {
   }
 }
 
+// =============================================================================
+// CompositeNode Active List Tests (many inputs)
+// =============================================================================
+
+// 多数のスプライトを合成し、行ごとにポート順でblendFromした結果と比較
+static void checkManyInputsComposite(int_fast16_t stripHeight) {
+  const int canvasSize = 128;
+  const int spriteSize = 6;
+  const int numSprites = 160;
+
+  std::vector<ImageBuffer> images;
+  std::vector<int> posX, posY;
+  images.reserve(numSprites);
+  uint32_t seed = 12345;
+  auto next = [&seed](int range) {
+    seed = seed * 1103515245u + 12345u;
+    return static_cast<int>((seed >> 16) % static_cast<uint32_t>(range));
+  };
+  for (int i = 0; i < numSprites; i++) {
+    auto c = static_cast<uint8_t>(i * 37);
+    images.push_back(createSolidImage(spriteSize, spriteSize, c,
+                                      static_cast<uint8_t>(255 - c),
+                                      static_cast<uint8_t>(i), (i % 3) ? 140 : 255));
+    posX.push_back(next(canvasSize - spriteSize));
+    posY.push_back(next(canvasSize - spriteSize));
+  }
+
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
+  ViewPort dstView = dstImg.view();
+
+  std::vector<SourceNode> sources(static_cast<size_t>(numSprites));
+  CompositeNode composite(static_cast<int_fast16_t>(numSprites));
+  RendererNode renderer;
+  SinkNode sink(dstView);
+  for (int i = 0; i < numSprites; i++) {
+    auto &src = sources[static_cast<size_t>(i)];
+    src.setSource(images[static_cast<size_t>(i)].view());
+    src.setPosition(static_cast<float>(posX[static_cast<size_t>(i)]),
+                    static_cast<float>(posY[static_cast<size_t>(i)]));
+    src.connectTo(composite, static_cast<int_fast16_t>(i));
+  }
+  composite >> renderer >> sink;
+
+  renderer.setVirtualScreen(canvasSize, canvasSize);
+  renderer.setStripHeight(stripHeight);
+  renderer.exec();
+
+  // 期待値: 各行について、その行に掛かるスプライトをポート順に背面合成
+  int mismatches = 0;
+  for (int y = 0; y < canvasSize; y++) {
+    ImageBuffer expected(canvasSize, 1, PixelFormatIDs::RGBA8_Straight,
+                         InitPolicy::Zero);
+    for (int i = 0; i < numSprites; i++) {
+      int top = posY[static_cast<size_t>(i)];
+      if (y < top || y >= top + spriteSize) continue;
+      ImageBuffer row = createSolidImage(spriteSize, 1, 0, 0, 0, 0);
+      std::memcpy(row.data(),
+                  images[static_cast<size_t>(i)].view().pixelAt(0, y - top),
+                  spriteSize * 4);
+      row.setStartX(static_cast<int16_t>(posX[static_cast<size_t>(i)]));
+      expected.blendFrom(row);
+    }
+    if (std::memcmp(expected.data(), dstView.pixelAt(0, y), canvasSize * 4) != 0)
+      mismatches++;
+  }
+  CHECK(mismatches == 0);
+}
+
+TEST_CASE("CompositeNode many inputs match per-row reference") {
+  SUBCASE("scanline") { checkManyInputsComposite(1); }
+  SUBCASE("strip (multiple buckets per request)") {
+    checkManyInputsComposite(16);
+  }
+}
+
+// getDataRange / process の呼び出し回数を数えるSourceNode
+class CompositeCountingSource : public SourceNode {
+public:
+  mutable int rangeCount = 0;
+  int processCount = 0;
+  int requestedPixels = 0;
+
+  DataRange getDataRange(const RenderRequest &request) const override {
+    ++rangeCount;
+    return SourceNode::getDataRange(request);
+  }
+
+protected:
+  RenderResponse &onPullProcess(const RenderRequest &request) override {
+    ++processCount;
+    requestedPixels += request.width;
+    return SourceNode::onPullProcess(request);
+  }
+};
+
+TEST_CASE("CompositeNode skips inputs outside the scanline") {
+  // 縦に並んだスプライト: 各スプライトは自分の行付近でのみ処理される
+  const int canvasSize = 64;
+  const int numSprites = 32;
+
+  ImageBuffer img = createSolidImage(4, 2, 255, 255, 255, 255);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
+  ViewPort dstView = dstImg.view();
+
+  std::vector<CompositeCountingSource> sources(
+      static_cast<size_t>(numSprites));
+  CompositeNode composite(static_cast<int_fast16_t>(numSprites));
+  RendererNode renderer;
+  SinkNode sink(dstView);
+  for (int i = 0; i < numSprites; i++) {
+    auto &src = sources[static_cast<size_t>(i)];
+    src.setSource(img.view());
+    src.setPosition(static_cast<float>(i),
+                    static_cast<float>(i * 2));
+    src.connectTo(composite, static_cast<int_fast16_t>(i));
+  }
+  composite >> renderer >> sink;
+
+  renderer.setVirtualScreen(canvasSize, canvasSize);
+  renderer.exec();
+
+  // 各スプライトは自身の2行（+上下1行の余裕）以外では参照されない
+  // （全入力を走査すると全64行で getDataRange が呼ばれる）
+  for (auto &src : sources) {
+    CHECK(src.rangeCount <= 4);
+    CHECK(src.processCount > 0);
+    CHECK(src.processCount <= 4);
+  }
+
+  // 各スプライトが正しい位置に描画されていること
+  for (int i = 0; i < numSprites; i++) {
+    uint8_t r, g, b, a;
+    getPixelRGBA8(dstView, i, i * 2, r, g, b, a);
+    CHECK(a == 255);
+    getPixelRGBA8(dstView, i + 3, i * 2 + 1, r, g, b, a);
+    CHECK(a == 255);
+  }
+  // スプライトの無い領域は透明のまま
+  uint8_t r, g, b, a;
+  getPixelRGBA8(dstView, canvasSize - 1, 0, r, g, b, a);
+  CHECK(a == 0);
+}
+
+// =============================================================================
+// CompositeNode Opaque Occlusion Tests
+// =============================================================================
+
+// 前景（ポート0）と全面背景（ポート1）の2入力シーン
+struct OcclusionScene {
+  static constexpr int canvasSize = 64;
+  ImageBuffer fgImg;
+  ImageBuffer bgImg;
+  ImageBuffer dstImg;
+  SourceNode fg;
+  CompositeCountingSource bg;
+  CompositeNode composite{2};
+  RendererNode renderer;
+  SinkNode sink;
+
+  OcclusionScene(int fgWidth, uint8_t fgAlpha)
+      : fgImg(createSolidImage(fgWidth, canvasSize, 0, 0, 255, fgAlpha)),
+        bgImg(createSolidImage(canvasSize, canvasSize, 255, 0, 0, 255)),
+        dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+               InitPolicy::Zero),
+        sink(dstImg.view()) {
+    fg.setSource(fgImg.view());
+    fg.setPosition(static_cast<float>((canvasSize - fgWidth) / 2), 0.0f);
+    bg.setSource(bgImg.view());
+    fg.connectTo(composite, 0);
+    bg.connectTo(composite, 1);
+    composite >> renderer >> sink;
+    renderer.setVirtualScreen(canvasSize, canvasSize);
+  }
+
+  void pixel(int x, int y, uint8_t &r, uint8_t &g, uint8_t &b, uint8_t &a) {
+    getPixelRGBA8(dstImg.view(), x, y, r, g, b, a);
+  }
+};
+
+TEST_CASE("CompositeNode occlusion: opaque full-width foreground hides lower layers") {
+  OcclusionScene scene(OcclusionScene::canvasSize, 255);
+  scene.renderer.exec();
+
+  // 背景は一度も処理されない
+  CHECK(scene.bg.processCount == 0);
+
+  uint8_t r, g, b, a;
+  scene.pixel(10, 10, r, g, b, a);
+  CHECK(b == 255);
+  CHECK(r == 0);
+  CHECK(a == 255);
+}
+
+TEST_CASE("CompositeNode occlusion: opaque panel narrows lower layer requests") {
+  // 中央32pxの不透明パネル: 背景は左右16pxずつのみ要求される
+  OcclusionScene scene(32, 255);
+  scene.renderer.exec();
+
+  CHECK(scene.bg.requestedPixels == 32 * OcclusionScene::canvasSize);
+
+  uint8_t r, g, b, a;
+  scene.pixel(4, 20, r, g, b, a);
+  CHECK(r == 255);
+  CHECK(b == 0);
+  scene.pixel(32, 20, r, g, b, a);
+  CHECK(r == 0);
+  CHECK(b == 255);
+  scene.pixel(60, 20, r, g, b, a);
+  CHECK(r == 255);
+  CHECK(b == 0);
+}
+
+TEST_CASE("CompositeNode occlusion: translucent or narrow layers do not occlude") {
+  SUBCASE("translucent panel") {
+    OcclusionScene scene(32, 128);
+    scene.renderer.exec();
+    CHECK(scene.bg.requestedPixels ==
+          OcclusionScene::canvasSize * OcclusionScene::canvasSize);
+
+    // パネル部分は背景と合成される
+    uint8_t r, g, b, a;
+    scene.pixel(32, 20, r, g, b, a);
+    CHECK(r > 0);
+    CHECK(b > 0);
+    CHECK(a == 255);
+  }
+  SUBCASE("panel narrower than the minimum span") {
+    OcclusionScene scene(8, 255);
+    scene.renderer.exec();
+    CHECK(scene.bg.requestedPixels ==
+          OcclusionScene::canvasSize * OcclusionScene::canvasSize);
+
+    uint8_t r, g, b, a;
+    scene.pixel(30, 20, r, g, b, a);
+    CHECK(b == 255);
+    CHECK(r == 0);
+  }
+}
+
 // =============================================================================
 // CompositeNode Port Management Tests
 // =============================================================================
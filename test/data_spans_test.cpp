@@ -0,0 +1,271 @@
+// fleximg Data Spans Unit Tests
+// 区間列（DataRangeList）とデータ区間分割のテスト
+
+#include "doctest.h"
+#include <cstring>
+#include <vector>
+
+#define FLEXIMG_NAMESPACE fleximg
+#include "fleximg/core/common.h"
+#include "fleximg/core/types.h"
+#include "fleximg/image/data_range.h"
+#include "fleximg/image/image_buffer.h"
+#include "fleximg/nodes/composite_node.h"
+#include "fleximg/nodes/matte_node.h"
+#include "fleximg/nodes/renderer_node.h"
+#include "fleximg/nodes/sink_node.h"
+#include "fleximg/nodes/source_node.h"
+
+using namespace fleximg;
+
+// =============================================================================
+// Helper Functions
+// =============================================================================
+
+static ImageBuffer makeSolid(int width, int height, uint8_t r, uint8_t g,
+                             uint8_t b, uint8_t a) {
+  ImageBuffer img(width, height, PixelFormatIDs::RGBA8_Straight);
+  ViewPort view = img.view();
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      uint8_t *p = static_cast<uint8_t *>(view.pixelAt(x, y));
+      p[0] = r;
+      p[1] = g;
+      p[2] = b;
+      p[3] = a;
+    }
+  }
+  return img;
+}
+
+static const uint8_t *pixelAt(const ImageBuffer &img, int x, int y) {
+  return static_cast<const uint8_t *>(img.view().pixelAt(x, y));
+}
+
+// リクエスト幅を記録するパススルーノード（区間列は上流をそのまま返す）
+class SpanProbeNode : public Node {
+public:
+  int pulls = 0;
+  int requestedPixels = 0;
+
+  SpanProbeNode() { initPorts(1, 1); }
+
+  const char *name() const override { return "SpanProbeNode"; }
+
+  void getDataSpans(const RenderRequest &request,
+                    DataRangeList &out) const override {
+    Node *upstream = upstreamNode(0);
+    if (upstream) upstream->getDataSpans(request, out);
+  }
+
+protected:
+  RenderResponse &onPullProcess(const RenderRequest &request) override {
+    ++pulls;
+    requestedPixels += request.width;
+    return Node::onPullProcess(request);
+  }
+};
+
+// =============================================================================
+// DataRangeList Tests
+// =============================================================================
+
+TEST_CASE("DataRangeList merges overlapping and adjacent ranges") {
+  DataRange storage[4];
+  DataRangeList list(storage, 4);
+
+  list.add(DataRange{10, 20});
+  list.add(DataRange{40, 50});
+  list.add(DataRange{0, 5});
+  REQUIRE(list.count == 3);
+  CHECK(list.spans[0].startX == 0);
+  CHECK(list.spans[1].startX == 10);
+  CHECK(list.spans[2].startX == 40);
+
+  // 隣接（20 == 20）は統合
+  list.add(DataRange{20, 25});
+  REQUIRE(list.count == 3);
+  CHECK(list.spans[1].endX == 25);
+
+  // 複数区間に跨る追加は1区間に統合
+  list.add(DataRange{3, 45});
+  REQUIRE(list.count == 1);
+  CHECK(list.spans[0].startX == 0);
+  CHECK(list.spans[0].endX == 50);
+
+  // 空の区間は無視
+  list.add(DataRange{30, 30});
+  CHECK(list.count == 1);
+}
+
+TEST_CASE("DataRangeList overflow closes the narrowest gap") {
+  DataRange storage[2];
+  DataRangeList list(storage, 2);
+
+  list.add(DataRange{0, 10});
+  list.add(DataRange{100, 110});
+
+  SUBCASE("new range next to an existing one is absorbed") {
+    list.add(DataRange{13, 20});  // 隙間3（既存区間同士の隙間90より狭い）
+    REQUIRE(list.count == 2);
+    CHECK(list.spans[0].startX == 0);
+    CHECK(list.spans[0].endX == 20);
+    CHECK(list.spans[1].startX == 100);
+  }
+
+  SUBCASE("existing ranges merge to make room") {
+    DataRange storage3[3];
+    DataRangeList list3(storage3, 3);
+    list3.add(DataRange{0, 10});
+    list3.add(DataRange{12, 20});   // 隙間2
+    list3.add(DataRange{100, 110});
+    list3.add(DataRange{60, 70});   // 隣との隙間は40・30 → 既存の隙間2を統合
+    REQUIRE(list3.count == 3);
+    CHECK(list3.spans[0].startX == 0);
+    CHECK(list3.spans[0].endX == 20);
+    CHECK(list3.spans[1].startX == 60);
+    CHECK(list3.spans[2].startX == 100);
+  }
+
+  // どの場合も範囲は狭まらない
+  CHECK(list.bounds().startX == 0);
+  CHECK(list.bounds().endX == 110);
+}
+
+TEST_CASE("DataRangeList closeGaps") {
+  DataRange storage[4];
+  DataRangeList list(storage, 4);
+  list.add(DataRange{0, 10});
+  list.add(DataRange{14, 20});
+  list.add(DataRange{60, 70});
+
+  list.closeGaps(8);
+  REQUIRE(list.count == 2);
+  CHECK(list.spans[0].endX == 20);
+  CHECK(list.spans[1].startX == 60);
+}
+
+// =============================================================================
+// RendererNode Span Split Tests
+// =============================================================================
+
+// 画面の両端に2つのスプライト（幅8px）を置いたシーン
+struct EdgeSpritesScene {
+  static constexpr int canvasWidth = 96;
+  static constexpr int canvasHeight = 8;
+  ImageBuffer leftImg;
+  ImageBuffer rightImg;
+  ImageBuffer dstImg;
+  SourceNode left;
+  SourceNode right;
+  CompositeNode composite{2};
+  SpanProbeNode probe;
+  RendererNode renderer;
+  SinkNode sink;
+
+  EdgeSpritesScene()
+      : leftImg(makeSolid(8, canvasHeight, 255, 0, 0, 255)),
+        rightImg(makeSolid(8, canvasHeight, 0, 0, 255, 255)),
+        dstImg(makeSolid(canvasWidth, canvasHeight, 1, 2, 3, 4)),
+        sink(dstImg.view()) {
+    left.setSource(leftImg.view());
+    right.setSource(rightImg.view());
+    right.setPosition(static_cast<float>(canvasWidth - 8), 0.0f);
+    left.connectTo(composite, 0);
+    right.connectTo(composite, 1);
+    composite >> probe >> renderer >> sink;
+    renderer.setVirtualScreen(canvasWidth, canvasHeight);
+  }
+};
+
+TEST_CASE("RendererNode span split: gaps between sprites are not processed") {
+  EdgeSpritesScene scene;
+
+  SUBCASE("disabled: hull width is pulled and the gap is written") {
+    scene.renderer.exec();
+    CHECK(scene.probe.requestedPixels ==
+          EdgeSpritesScene::canvasWidth * EdgeSpritesScene::canvasHeight);
+    CHECK(pixelAt(scene.dstImg, 48, 0)[3] == 0);
+  }
+
+  SUBCASE("enabled: only the sprite spans are pulled and written") {
+    scene.renderer.setSpanSplitEnabled(true);
+    scene.renderer.exec();
+    CHECK(scene.probe.pulls == 2 * EdgeSpritesScene::canvasHeight);
+    CHECK(scene.probe.requestedPixels == 16 * EdgeSpritesScene::canvasHeight);
+
+    // 隙間の出力先は変更されない
+    CHECK(pixelAt(scene.dstImg, 48, 3)[0] == 1);
+    CHECK(pixelAt(scene.dstImg, 48, 3)[3] == 4);
+  }
+
+  // スプライトはどちらでも描画される
+  CHECK(pixelAt(scene.dstImg, 2, 3)[0] == 255);
+  CHECK(pixelAt(scene.dstImg, EdgeSpritesScene::canvasWidth - 2, 3)[2] == 255);
+}
+
+TEST_CASE("RendererNode span split: narrow gaps are not split") {
+  EdgeSpritesScene scene;
+  scene.right.setPosition(12.0f, 0.0f);  // 隙間4px < MIN_SPAN_GAP
+  scene.renderer.setSpanSplitEnabled(true);
+  scene.renderer.exec();
+
+  CHECK(scene.probe.pulls == EdgeSpritesScene::canvasHeight);
+  CHECK(scene.probe.requestedPixels == 20 * EdgeSpritesScene::canvasHeight);
+}
+
+TEST_CASE("RendererNode span split: MatteNode keeps background spans") {
+  // 背景 = 両端のスプライト、前景・マスクなし
+  const int width = 96;
+  ImageBuffer leftImg = makeSolid(8, 4, 255, 0, 0, 255);
+  ImageBuffer rightImg = makeSolid(8, 4, 0, 255, 0, 255);
+  ImageBuffer dstImg(width, 4, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+
+  SourceNode left(leftImg.view());
+  SourceNode right(rightImg.view());
+  right.setPosition(static_cast<float>(width - 8), 0.0f);
+  CompositeNode composite(2);
+  MatteNode matte;
+  SpanProbeNode probe;
+  RendererNode renderer;
+  SinkNode sink(dstImg.view());
+
+  left.connectTo(composite, 0);
+  right.connectTo(composite, 1);
+  composite.connectTo(matte, 1);
+  matte >> probe >> renderer >> sink;
+  renderer.setVirtualScreen(width, 4);
+  renderer.setSpanSplitEnabled(true);
+  renderer.exec();
+
+  CHECK(probe.requestedPixels == 16 * 4);
+  CHECK(pixelAt(dstImg, 3, 1)[0] == 255);
+  CHECK(pixelAt(dstImg, width - 3, 1)[1] == 255);
+}
+
+TEST_CASE("RendererNode span split with damage tracking matches full render") {
+  EdgeSpritesScene scene;
+  scene.renderer.setDamageTrackingEnabled(true);
+  scene.renderer.setSpanSplitEnabled(true);
+  scene.renderer.exec();
+
+  // 右のスプライトを移動（旧位置は透明で消去される）
+  scene.right.setPosition(60.0f, 0.0f);
+  scene.renderer.exec();
+
+  // 参照: 分割なし・全画面描画（出力先は透明で初期化）
+  EdgeSpritesScene reference;
+  reference.right.setPosition(60.0f, 0.0f);
+  std::memset(reference.dstImg.data(), 0,
+              static_cast<size_t>(EdgeSpritesScene::canvasWidth *
+                                  EdgeSpritesScene::canvasHeight * 4));
+  reference.renderer.exec();
+
+  // 差分描画の区間内（旧位置〜新位置）は参照と一致する
+  for (int y = 0; y < EdgeSpritesScene::canvasHeight; y++) {
+    for (int x = 60; x < EdgeSpritesScene::canvasWidth; x++) {
+      CHECK(std::memcmp(pixelAt(scene.dstImg, x, y),
+                        pixelAt(reference.dstImg, x, y), 4) == 0);
+    }
+  }
+}
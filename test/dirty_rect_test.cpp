@@ -0,0 +1,342 @@
+// fleximg Dirty Rectangle Tests
+// 差分描画（ダメージ領域）のテスト
+
+#include "doctest.h"
+
+#define FLEXIMG_NAMESPACE fleximg
+#include "fleximg/core/common.h"
+#include "fleximg/core/types.h"
+#include "fleximg/image/damage_region.h"
+#include "fleximg/image/image_buffer.h"
+#include "fleximg/nodes/composite_node.h"
+#include "fleximg/nodes/horizontal_blur_node.h"
+#include "fleximg/nodes/renderer_node.h"
+#include "fleximg/nodes/sink_node.h"
+#include "fleximg/nodes/source_node.h"
+
+#include <cstring>
+
+using namespace fleximg;
+
+// =============================================================================
+// Helper Functions
+// =============================================================================
+
+static ImageBuffer createPatternImage(int width, int height, uint8_t seed,
+                                      PixelFormatID format) {
+  ImageBuffer rgba(width, height, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = static_cast<uint8_t *>(rgba.pixelAt(0, y));
+    for (int x = 0; x < width; x++) {
+      row[x * 4 + 0] = static_cast<uint8_t>(x * 9 + seed);
+      row[x * 4 + 1] = static_cast<uint8_t>(y * 7 + seed);
+      row[x * 4 + 2] = static_cast<uint8_t>((x ^ y) + seed);
+      row[x * 4 + 3] = static_cast<uint8_t>(160 + ((x * y) & 63));
+    }
+  }
+  if (format == PixelFormatIDs::RGBA8_Straight)
+    return rgba;
+  ImageBuffer img(width, height, format);
+  for (int y = 0; y < height; y++) {
+    convertFormat(rgba.pixelAt(0, y), PixelFormatIDs::RGBA8_Straight,
+                  img.pixelAt(0, y), format, width);
+  }
+  return img;
+}
+
+static bool sameBytes(const ImageBuffer &a, const ImageBuffer &b) {
+  for (int y = 0; y < a.height(); y++) {
+    if (std::memcmp(a.pixelAt(0, y), b.pixelAt(0, y),
+                    static_cast<size_t>(a.width()) * 4) != 0)
+      return false;
+  }
+  return true;
+}
+
+static DamageRect rect(int x0, int y0, int x1, int y1) {
+  return DamageRect{static_cast<int16_t>(x0), static_cast<int16_t>(y0),
+                    static_cast<int16_t>(x1), static_cast<int16_t>(y1)};
+}
+
+// スプライトの配置
+struct SpriteState {
+  float x = 0.0f;
+  float y = 0.0f;
+  float rotation = 0.0f;
+};
+
+// 背景（任意）+ ブラー（任意）付きスプライトの合成シーン
+struct SpriteScene {
+  static constexpr int kSize = 80;
+  SourceNode background;
+  SourceNode sprite;
+  HorizontalBlurNode blur;
+  CompositeNode composite{2};
+  RendererNode renderer;
+  SinkNode sink;
+
+  SpriteScene(ImageBuffer &dst, const ImageBuffer *bg, const ImageBuffer &spr,
+              int blurRadius) {
+    int_fixed center = float_to_fixed(kSize / 2.0f);
+    sprite.setSource(spr.view());
+    sprite.setPivot(float_to_fixed(spr.width() / 2.0f),
+                    float_to_fixed(spr.height() / 2.0f));
+    sink.setTarget(dst.view());
+    sink.setPivot(center, center);
+
+    if (blurRadius > 0) {
+      blur.setRadius(blurRadius);
+      sprite >> blur;
+      blur.connectTo(composite, 1);
+    } else {
+      sprite.connectTo(composite, 1);
+    }
+    if (bg) {
+      background.setSource(bg->view());
+      background.setPivot(float_to_fixed(bg->width() / 2.0f),
+                          float_to_fixed(bg->height() / 2.0f));
+      background.connectTo(composite, 0);
+    }
+    composite >> renderer >> sink;
+    renderer.setVirtualScreen(kSize, kSize);
+    renderer.setPivotCenter();
+  }
+
+  void apply(const SpriteState &s) {
+    sprite.setRotation(s.rotation);
+    sprite.setTranslation(s.x, s.y);
+  }
+};
+
+// 指定状態を空の出力先へ全画面描画した結果
+static ImageBuffer renderFresh(const ImageBuffer *bg, const ImageBuffer &spr,
+                               int blurRadius, const SpriteState &s) {
+  ImageBuffer dst(SpriteScene::kSize, SpriteScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  SpriteScene scene(dst, bg, spr, blurRadius);
+  scene.apply(s);
+  scene.renderer.exec();
+  return dst;
+}
+
+// =============================================================================
+// DamageRegion Tests
+// =============================================================================
+
+TEST_CASE("DamageRegion: overlapping rects are merged") {
+  DamageRegion region;
+  region.add(rect(0, 0, 10, 10));
+  region.add(rect(20, 0, 30, 10));
+  CHECK(region.count() == 2);
+
+  region.add(rect(5, 5, 25, 8)); // 両方と重なる
+  REQUIRE(region.count() == 1);
+  CHECK(region.rect(0).x0 == 0);
+  CHECK(region.rect(0).x1 == 30);
+
+  region.add(rect(2, 2, 4, 4)); // 包含済み
+  CHECK(region.count() == 1);
+  region.add(rect(5, 5, 5, 9)); // 空
+  CHECK(region.count() == 1);
+}
+
+TEST_CASE("DamageRegion: overflow merges without losing coverage") {
+  DamageRegion region;
+  for (int i = 0; i < DamageRegion::MAX_RECTS + 4; i++) {
+    region.add(rect(i * 10, i * 10, i * 10 + 4, i * 10 + 4));
+  }
+  CHECK(region.count() <= DamageRegion::MAX_RECTS);
+
+  // 追加した全矩形がいずれかの矩形に含まれる
+  for (int i = 0; i < DamageRegion::MAX_RECTS + 4; i++) {
+    DamageRect r = rect(i * 10, i * 10, i * 10 + 4, i * 10 + 4);
+    bool covered = false;
+    for (int j = 0; j < region.count(); j++) {
+      covered = covered || region.rect(j).contains(r);
+    }
+    CHECK(covered);
+  }
+}
+
+TEST_CASE("DamageRegion: expand, clip and spans") {
+  DamageRegion region;
+  region.add(rect(10, 0, 20, 10));
+  region.add(rect(40, 5, 50, 15));
+  region.expand(2, 1);
+  region.clip(rect(0, 0, 45, 100));
+  REQUIRE(region.count() == 2);
+  CHECK(region.bounds().x0 == 8);
+  CHECK(region.bounds().x1 == 45);
+
+  DataRange spans[DamageRegion::MAX_RECTS];
+  CHECK(region.spans(0, 1, spans, DamageRegion::MAX_RECTS) == 1);
+  CHECK(spans[0].startX == 8);
+  CHECK(spans[0].endX == 22);
+
+  REQUIRE(region.spans(6, 7, spans, DamageRegion::MAX_RECTS) == 2);
+  CHECK(spans[0].startX == 8);
+  CHECK(spans[1].startX == 38);
+  CHECK(spans[1].endX == 45);
+
+  // 出力先不足: 最後の区間に寄せる
+  REQUIRE(region.spans(6, 7, spans, 1) == 1);
+  CHECK(spans[0].startX == 8);
+  CHECK(spans[0].endX == 45);
+
+  CHECK(region.spans(50, 60, spans, DamageRegion::MAX_RECTS) == 0);
+}
+
+// =============================================================================
+// RendererNode Damage Tracking Tests
+// =============================================================================
+
+TEST_CASE("DamageTracking: first frame is full, unchanged frame is empty") {
+  ImageBuffer bg = createPatternImage(80, 80, 3, PixelFormatIDs::RGB888);
+  ImageBuffer spr = createPatternImage(16, 12, 41, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dst(80, 80, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  SpriteScene scene(dst, &bg, spr, 0);
+  scene.renderer.setDamageTrackingEnabled(true);
+
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  CHECK_FALSE(scene.renderer.lastFrameWasPartial());
+  CHECK(scene.renderer.lastDamage().area() == 80 * 80);
+
+  // 変更なし: 出力先に触れない
+  std::memset(dst.pixelAt(0, 0), 0x5A, 4);
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  CHECK(scene.renderer.lastFrameWasPartial());
+  CHECK(scene.renderer.lastDamage().empty());
+  CHECK(static_cast<uint8_t *>(dst.pixelAt(0, 0))[0] == 0x5A);
+
+  // invalidate() で全画面に戻る
+  scene.renderer.invalidate();
+  scene.renderer.exec();
+  CHECK_FALSE(scene.renderer.lastFrameWasPartial());
+  CHECK(static_cast<uint8_t *>(dst.pixelAt(0, 0))[0] != 0x5A);
+}
+
+TEST_CASE("DamageTracking: moved sprite matches full render") {
+  ImageBuffer bg = createPatternImage(80, 80, 3, PixelFormatIDs::RGB888);
+  ImageBuffer spr = createPatternImage(16, 12, 41, PixelFormatIDs::RGBA8_Straight);
+  const SpriteState frames[] = {
+      {-20.0f, -10.0f, 0.0f}, {-12.5f, -6.25f, 0.0f}, {-12.5f, -6.25f, 0.6f},
+      {15.0f, 18.0f, 1.2f},   {60.0f, 0.0f, 0.0f},    {0.0f, 0.0f, 0.0f}};
+
+  for (const ImageBuffer *background : {&bg, static_cast<ImageBuffer *>(nullptr)}) {
+    CAPTURE(background != nullptr);
+    ImageBuffer dst(80, 80, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+    SpriteScene scene(dst, background, spr, 0);
+    scene.renderer.setDamageTrackingEnabled(true);
+
+    for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+      CAPTURE(i);
+      scene.apply(frames[i]);
+      CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+      if (i > 0) {
+        CHECK(scene.renderer.lastFrameWasPartial());
+        CHECK(scene.renderer.lastDamage().area() < 80 * 80);
+      }
+      ImageBuffer ref = renderFresh(background, spr, 0, frames[i]);
+      CHECK(sameBytes(ref, dst));
+    }
+  }
+}
+
+TEST_CASE("DamageTracking: blur margin widens damage") {
+  ImageBuffer bg = createPatternImage(80, 80, 3, PixelFormatIDs::RGB888);
+  ImageBuffer spr = createPatternImage(16, 12, 41, PixelFormatIDs::RGB888);
+  const SpriteState frames[] = {{-10.0f, 0.0f, 0.3f}, {-4.0f, 0.0f, 0.3f}};
+
+  ImageBuffer dst(80, 80, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  SpriteScene scene(dst, &bg, spr, 5);
+  scene.renderer.setDamageTrackingEnabled(true);
+  scene.apply(frames[0]);
+  scene.renderer.exec();
+  scene.apply(frames[1]);
+  scene.renderer.exec();
+  REQUIRE(scene.renderer.lastFrameWasPartial());
+  CHECK(sameBytes(renderFresh(&bg, spr, 5, frames[1]), dst));
+
+  // ブラー半径の変更もダメージになる
+  scene.blur.setRadius(2);
+  scene.renderer.exec();
+  CHECK_FALSE(scene.renderer.lastDamage().empty());
+  ImageBuffer ref(80, 80, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  {
+    SpriteScene fresh(ref, &bg, spr, 2);
+    fresh.apply(frames[1]);
+    fresh.renderer.exec();
+  }
+  CHECK(sameBytes(ref, dst));
+}
+
+TEST_CASE("DamageTracking: blur halo of off-screen sprite is repainted") {
+  // スプライト本体が画面外でもブラーの裾は画面内に掛かる。
+  // マージン拡張前に画面でクリップすると、裾の旧領域が再描画されない
+  ImageBuffer spr = createPatternImage(16, 12, 41, PixelFormatIDs::RGB888);
+  const SpriteState frames[] = {{-10.0f, 0.0f, 0.0f},
+                                {49.0f, -30.0f, 0.0f},
+                                {60.0f, -30.0f, 0.0f},
+                                {-60.0f, 0.0f, 0.0f},
+                                {-49.0f, 4.0f, 0.0f}};
+
+  ImageBuffer dst(80, 80, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  SpriteScene scene(dst, nullptr, spr, 4);
+  scene.renderer.setDamageTrackingEnabled(true);
+  for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+    CAPTURE(i);
+    scene.apply(frames[i]);
+    scene.renderer.exec();
+    if (i > 0) {
+      CHECK(scene.renderer.lastFrameWasPartial());
+    }
+    CHECK(sameBytes(renderFresh(nullptr, spr, 4, frames[i]), dst));
+  }
+}
+
+TEST_CASE("DamageTracking: graph and sink changes") {
+  ImageBuffer bg = createPatternImage(80, 80, 3, PixelFormatIDs::RGB888);
+  ImageBuffer spr = createPatternImage(16, 12, 41, PixelFormatIDs::RGBA8_Straight);
+  const SpriteState state{8.0f, -6.0f, 0.4f};
+
+  ImageBuffer dst(80, 80, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  SpriteScene scene(dst, &bg, spr, 0);
+  scene.apply(state);
+  scene.renderer.setDamageTrackingEnabled(true);
+  scene.renderer.exec();
+
+  // スプライトを切断: 旧領域が消去される
+  scene.sprite.disconnectAll();
+  scene.renderer.exec();
+  CHECK(scene.renderer.lastFrameWasPartial());
+  CHECK(sameBytes(renderFresh(&bg, spr, 0, SpriteState{200.0f, 0.0f, 0.0f}), dst));
+
+  // 再接続
+  scene.sprite.connectTo(scene.composite, 1);
+  scene.renderer.exec();
+  CHECK(scene.renderer.lastFrameWasPartial());
+  CHECK(sameBytes(renderFresh(&bg, spr, 0, state), dst));
+
+  // 下流の変更は全画面
+  scene.sink.setPivotCenter();
+  scene.renderer.exec();
+  CHECK(scene.renderer.lastDamage().area() == 80 * 80);
+}
+
+TEST_CASE("DamageTracking: strip mode and tiles") {
+  ImageBuffer bg = createPatternImage(80, 80, 3, PixelFormatIDs::RGB888);
+  ImageBuffer spr = createPatternImage(16, 12, 41, PixelFormatIDs::RGBA8_Straight);
+  const SpriteState frames[] = {{-20.0f, 5.0f, 0.0f}, {10.0f, -3.0f, 0.0f}};
+
+  ImageBuffer dst(80, 80, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  SpriteScene scene(dst, &bg, spr, 0);
+  scene.renderer.setDamageTrackingEnabled(true);
+  scene.renderer.setStripHeight(8);
+  scene.renderer.setTileConfig(24, 1);
+  for (const auto &s : frames) {
+    scene.apply(s);
+    scene.renderer.exec();
+    CHECK(sameBytes(renderFresh(&bg, spr, 0, s), dst));
+  }
+  CHECK(scene.renderer.lastFrameWasPartial());
+}
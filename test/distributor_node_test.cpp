@@ -120,7 +120,8 @@ TEST_CASE("DistributorNode single output pipeline") {
   const int canvasSize = 64;
 
   ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 255, 0, 0, 255);
-  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
 
   SourceNode src(srcImg.view(), float_to_fixed(imgSize / 2.0f),
                  float_to_fixed(imgSize / 2.0f));
@@ -153,8 +154,10 @@ TEST_CASE("DistributorNode two outputs receive same image") {
   const int canvasSize = 64;
 
   ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 255, 0, 0, 255);
-  ImageBuffer dstImg1(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
-  ImageBuffer dstImg2(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg1(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
+  ImageBuffer dstImg2(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
 
   SourceNode src(srcImg.view(), float_to_fixed(imgSize / 2.0f),
                  float_to_fixed(imgSize / 2.0f));
@@ -282,9 +285,12 @@ TEST_CASE("DistributorNode three outputs") {
   const int canvasSize = 64;
 
   ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 0, 0, 255, 255);
-  ImageBuffer dstImg1(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
-  ImageBuffer dstImg2(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
-  ImageBuffer dstImg3(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg1(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
+  ImageBuffer dstImg2(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
+  ImageBuffer dstImg3(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
 
   SourceNode src(srcImg.view(), float_to_fixed(imgSize / 2.0f),
                  float_to_fixed(imgSize / 2.0f));
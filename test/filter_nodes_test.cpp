@@ -10,12 +10,17 @@
 #include "fleximg/image/render_types.h"
 #include "fleximg/nodes/alpha_node.h"
 #include "fleximg/nodes/brightness_node.h"
+#include "fleximg/nodes/composite_node.h"
 #include "fleximg/nodes/grayscale_node.h"
 #include "fleximg/nodes/horizontal_blur_node.h"
 #include "fleximg/nodes/renderer_node.h"
 #include "fleximg/nodes/sink_node.h"
 #include "fleximg/nodes/source_node.h"
 #include "fleximg/nodes/vertical_blur_node.h"
+#include "fleximg/operations/filters.h"
+
+#include <cstring>
+#include <vector>
 
 using namespace fleximg;
 
@@ -99,7 +104,8 @@ TEST_CASE("BrightnessNode positive brightness") {
   ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 100, 100, 100, 255);
   ViewPort srcView = srcImg.view();
 
-  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
   ViewPort dstView = dstImg.view();
 
   SourceNode src(srcView, float_to_fixed(imgSize / 2.0f),
@@ -142,7 +148,8 @@ TEST_CASE("GrayscaleNode converts to grayscale") {
   ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 255, 0, 0, 255);
   ViewPort srcView = srcImg.view();
 
-  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
   ViewPort dstView = dstImg.view();
 
   SourceNode src(srcView, float_to_fixed(imgSize / 2.0f),
@@ -195,7 +202,8 @@ TEST_CASE("AlphaNode reduces alpha") {
   ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 255, 0, 0, 255);
   ViewPort srcView = srcImg.view();
 
-  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
   ViewPort dstView = dstImg.view();
 
   SourceNode src(srcView, float_to_fixed(imgSize / 2.0f),
@@ -251,7 +259,8 @@ TEST_CASE("HorizontalBlurNode blurs image horizontally") {
   centerPixel[2] = 255;
   centerPixel[3] = 255;
 
-  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
   ViewPort dstView = dstImg.view();
 
   SourceNode src(srcView, float_to_fixed(imgSize / 2.0f),
@@ -272,6 +281,191 @@ TEST_CASE("HorizontalBlurNode blurs image horizontally") {
   CHECK(true);
 }
 
+// ボックスブラー1パスの参照実装（α加重、整数除算、範囲外は透明扱い）
+static void boxBlurReference(const ViewPort &src, std::vector<uint8_t> &dst,
+                             int radius, bool vertical) {
+  int w = src.width, h = src.height;
+  dst.assign(static_cast<size_t>(w * h * 4), 0);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      uint32_t sum[4] = {0, 0, 0, 0};
+      for (int k = -radius; k <= radius; k++) {
+        int sx = vertical ? x : x + k;
+        int sy = vertical ? y + k : y;
+        if (sx < 0 || sx >= w || sy < 0 || sy >= h) continue;
+        const uint8_t *p = static_cast<const uint8_t *>(src.pixelAt(sx, sy));
+        for (int c = 0; c < 3; c++) sum[c] += p[c] * p[3];
+        sum[3] += p[3];
+      }
+      uint8_t *d = &dst[static_cast<size_t>((y * w + x) * 4)];
+      if (sum[3] == 0) continue;
+      for (int c = 0; c < 3; c++)
+        d[c] = static_cast<uint8_t>(sum[c] / sum[3]);
+      d[3] = static_cast<uint8_t>(sum[3] / static_cast<uint32_t>(radius * 2 + 1));
+    }
+  }
+}
+
+TEST_CASE("Blur nodes match integer-division reference") {
+  // チャンク境界（32ピクセル）・SIMD幅（8ピクセル）の端数を含む幅
+  const int w = 77, h = 10, radius = 3;
+  ImageBuffer srcImg(w, h, PixelFormatIDs::RGBA8_Straight);
+  ViewPort srcView = srcImg.view();
+  uint32_t seed = 12345;
+  for (int y = 0; y < h; y++) {
+    uint8_t *row = static_cast<uint8_t *>(srcView.pixelAt(0, y));
+    for (int i = 0; i < w * 4; i++) {
+      seed = seed * 1103515245u + 12345u;
+      row[i] = static_cast<uint8_t>(seed >> 24);
+    }
+    // 透明な区間（sumA == 0 の出力を含める）
+    for (int x = 40; x < 50; x++) row[x * 4 + 3] = 0;
+  }
+
+  // mode: 0 = 水平, 1 = 垂直（pull型）, 2 = 垂直（push型）
+  for (int mode = 0; mode < 3; mode++) {
+    CAPTURE(mode);
+    bool vertical = (mode != 0);
+    ImageBuffer dstImg(w, h, PixelFormatIDs::RGBA8_Straight,
+                       InitPolicy::Zero);
+    ViewPort dstView = dstImg.view();
+
+    SourceNode src(srcView, float_to_fixed(w / 2.0f), float_to_fixed(h / 2.0f));
+    HorizontalBlurNode hblur;
+    VerticalBlurNode vblur;
+    RendererNode renderer;
+    SinkNode sink(dstView, float_to_fixed(w / 2.0f), float_to_fixed(h / 2.0f));
+    hblur.setRadius(radius);
+    vblur.setRadius(radius);
+    if (mode == 2) {
+      src >> renderer >> vblur >> sink;
+    } else if (vertical) {
+      src >> vblur >> renderer >> sink;
+    } else {
+      src >> hblur >> renderer >> sink;
+    }
+    renderer.setVirtualScreen(w, h);
+    renderer.setPivot(float_to_fixed(w / 2.0f), float_to_fixed(h / 2.0f));
+    renderer.exec();
+
+    std::vector<uint8_t> expected;
+    boxBlurReference(srcView, expected, radius, vertical);
+    int mismatches = 0;
+    for (int y = 0; y < h; y++) {
+      const uint8_t *row = static_cast<const uint8_t *>(dstView.pixelAt(0, y));
+      for (int i = 0; i < w * 4; i++) {
+        if (row[i] != expected[static_cast<size_t>(y * w * 4 + i)]) {
+          mismatches++;
+        }
+      }
+    }
+    CHECK(mismatches == 0);
+  }
+}
+
+TEST_CASE("VerticalBlurNode releases upstream responses (composite input)") {
+  // 複数入力のCompositeを上流に置き、半径を大きくしてResponseプールを
+  // 圧迫する。上流Responseが返却されないとプール枯渇時のフォールバックが
+  // 使用中のResponseを破壊し、出力が崩れる
+  const int w = 48, h = 32, radius = 8, bands = 3;
+  ImageBuffer srcImg(w, h, PixelFormatIDs::RGBA8_Straight);
+  ViewPort srcView = srcImg.view();
+  uint32_t seed = 777;
+  for (int y = 0; y < h; y++) {
+    uint8_t *row = static_cast<uint8_t *>(srcView.pixelAt(0, y));
+    for (int i = 0; i < w * 4; i++) {
+      seed = seed * 1103515245u + 12345u;
+      row[i] = static_cast<uint8_t>(seed >> 24);
+    }
+    for (int x = 0; x < w; x++) row[x * 4 + 3] = 255;
+  }
+
+  ImageBuffer dstImg(w, h, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  ViewPort dstView = dstImg.view();
+
+  // 画像を縦帯に分割し、それぞれ別のSourceNodeとしてCompositeに入力
+  const int bandW = w / bands;
+  std::vector<ViewPort> bandViews;
+  for (int i = 0; i < bands; i++) {
+    bandViews.push_back(view_ops::subView(srcView, i * bandW, 0, bandW, h));
+  }
+  SourceNode src0(bandViews[0], float_to_fixed(w / 2.0f),
+                  float_to_fixed(h / 2.0f));
+  SourceNode src1(bandViews[1], float_to_fixed(w / 2.0f - bandW),
+                  float_to_fixed(h / 2.0f));
+  SourceNode src2(bandViews[2], float_to_fixed(w / 2.0f - bandW * 2),
+                  float_to_fixed(h / 2.0f));
+  CompositeNode composite(bands);
+  VerticalBlurNode vblur;
+  RendererNode renderer;
+  SinkNode sink(dstView, float_to_fixed(w / 2.0f), float_to_fixed(h / 2.0f));
+
+  src0.connectTo(composite, 0);
+  src1.connectTo(composite, 1);
+  src2.connectTo(composite, 2);
+  composite >> vblur >> renderer >> sink;
+  vblur.setRadius(radius);
+  renderer.setVirtualScreen(w, h);
+  renderer.setPivot(float_to_fixed(w / 2.0f), float_to_fixed(h / 2.0f));
+  renderer.exec();
+
+  std::vector<uint8_t> expected;
+  boxBlurReference(srcView, expected, radius, true);
+  int mismatches = 0;
+  for (int y = 0; y < h; y++) {
+    const uint8_t *row = static_cast<const uint8_t *>(dstView.pixelAt(0, y));
+    for (int i = 0; i < w * 4; i++) {
+      if (row[i] != expected[static_cast<size_t>(y * w * 4 + i)]) {
+        mismatches++;
+      }
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+TEST_CASE("boxBlurNormalize matches integer division") {
+  const int_fast16_t kernelSizes[] = {1, 3, 11, 41, 255};
+  uint32_t seed = 1;
+  for (int_fast16_t ks : kernelSizes) {
+    CAPTURE(ks);
+    // sumA = 0 〜 255 * ks の全値、RGBは商の境界（q * a, q * a - 1, 最大値）
+    auto count = static_cast<int_fast16_t>(255 * ks + 1);
+    std::vector<uint32_t> r(static_cast<size_t>(count));
+    std::vector<uint32_t> g(r.size()), b(r.size()), a(r.size());
+    for (int_fast16_t i = 0; i < count; i++) {
+      auto sa = static_cast<uint32_t>(i);
+      seed = seed * 1103515245u + 12345u;
+      uint32_t q = (seed >> 16) & 0xFF;
+      a[static_cast<size_t>(i)] = sa;
+      r[static_cast<size_t>(i)] = q * sa;
+      g[static_cast<size_t>(i)] = (q * sa > 0) ? q * sa - 1 : 0;
+      b[static_cast<size_t>(i)] = 255 * sa;
+    }
+
+    std::vector<uint8_t> out(r.size() * 4), outScalar(r.size() * 4);
+    filters::boxBlurNormalize(out.data(), r.data(), g.data(), b.data(),
+                              a.data(), count, ks);
+    filters::boxBlurNormalizeScalar(outScalar.data(), r.data(), g.data(),
+                                    b.data(), a.data(), count, ks);
+
+    int mismatches = 0;
+    for (size_t i = 0; i < r.size(); i++) {
+      uint8_t expected[4] = {0, 0, 0, 0};
+      if (a[i] > 0) {
+        expected[0] = static_cast<uint8_t>(r[i] / a[i]);
+        expected[1] = static_cast<uint8_t>(g[i] / a[i]);
+        expected[2] = static_cast<uint8_t>(b[i] / a[i]);
+        expected[3] = static_cast<uint8_t>(a[i] / static_cast<uint32_t>(ks));
+      }
+      for (size_t c = 0; c < 4; c++) {
+        if (out[i * 4 + c] != expected[c]) mismatches++;
+        if (outScalar[i * 4 + c] != expected[c]) mismatches++;
+      }
+    }
+    CHECK(mismatches == 0);
+  }
+}
+
 // =============================================================================
 // VerticalBlurNode Tests
 // =============================================================================
@@ -306,7 +500,8 @@ TEST_CASE("VerticalBlurNode blurs image vertically") {
   centerPixel[2] = 255;
   centerPixel[3] = 255;
 
-  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
   ViewPort dstView = dstImg.view();
 
   SourceNode src(srcView, float_to_fixed(imgSize / 2.0f),
@@ -345,7 +540,8 @@ TEST_CASE("HorizontalBlur + VerticalBlur combination") {
   centerPixel[2] = 255;
   centerPixel[3] = 255;
 
-  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
   ViewPort dstView = dstImg.view();
 
   SourceNode src(srcView, float_to_fixed(imgSize / 2.0f),
@@ -380,7 +576,8 @@ TEST_CASE("Filter chain: brightness -> grayscale") {
   ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 100, 50, 150, 255);
   ViewPort srcView = srcImg.view();
 
-  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight);
+  ImageBuffer dstImg(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
   ViewPort dstView = dstImg.view();
 
   SourceNode src(srcView, float_to_fixed(imgSize / 2.0f),
@@ -406,6 +603,85 @@ TEST_CASE("Filter chain: brightness -> grayscale") {
   CHECK(std::abs(g - b) <= 5);
 }
 
+TEST_CASE("Filter chain: fused kernels match per-node execution") {
+  const int canvasSize = 64;
+  ImageBuffer srcImg(40, 40, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < 40; y++) {
+    uint8_t *row = static_cast<uint8_t *>(srcImg.pixelAt(0, y));
+    for (int x = 0; x < 40; x++) {
+      row[x * 4 + 0] = static_cast<uint8_t>(x * 6);
+      row[x * 4 + 1] = static_cast<uint8_t>(y * 6);
+      row[x * 4 + 2] = static_cast<uint8_t>((x ^ y) * 4);
+      row[x * 4 + 3] = static_cast<uint8_t>(100 + x + y);
+    }
+  }
+
+  auto render = [&](ImageBuffer &dst, bool compile) {
+    SourceNode src(srcImg.view(), float_to_fixed(20.0f), float_to_fixed(20.0f));
+    src.setRotation(0.3f);
+    BrightnessNode brightness;
+    brightness.setAmount(0.2f);
+    GrayscaleNode grayscale;
+    AlphaNode alpha;
+    alpha.setScale(0.8f);
+    HorizontalBlurNode hblur; // 融合不可: カーネル列を分断する
+    hblur.setRadius(2);
+    BrightnessNode brightness2;
+    brightness2.setAmount(-0.1f);
+    AlphaNode alpha2;
+    alpha2.setScale(0.9f);
+    RendererNode renderer;
+    SinkNode sink(dst.view(), float_to_fixed(canvasSize / 2.0f),
+                  float_to_fixed(canvasSize / 2.0f));
+
+    src >> brightness >> grayscale >> alpha >> hblur >> brightness2 >> alpha2 >>
+        renderer >> sink;
+
+    renderer.setVirtualScreen(canvasSize, canvasSize);
+    renderer.setFilterFusionEnabled(compile);
+    REQUIRE(renderer.execPrepare() == PrepareStatus::Prepared);
+
+    // カーネル列は各列の末端だけが持つ（hblur で2列に分断）
+    CHECK(alpha.compiledKernelCount() == (compile ? 3u : 0u));
+    CHECK(alpha2.compiledKernelCount() == (compile ? 2u : 0u));
+    CHECK(brightness.compiledKernelCount() == 0);
+    CHECK(grayscale.compiledKernelCount() == 0);
+    CHECK(brightness2.compiledKernelCount() == 0);
+
+    renderer.execProcess();
+    renderer.execFinalize();
+  };
+
+  ImageBuffer ref(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  ImageBuffer dst(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  render(ref, false);
+  render(dst, true);
+  for (int y = 0; y < canvasSize; y++) {
+    CHECK(std::memcmp(ref.pixelAt(0, y), dst.pixelAt(0, y),
+                      canvasSize * 4) == 0);
+  }
+}
+
+TEST_CASE("Filter nodes expose line kernels for compilation") {
+  filters::LineKernel kernel;
+  BrightnessNode brightness;
+  brightness.setAmount(0.5f);
+  REQUIRE(brightness.getLineKernel(kernel));
+  CHECK(kernel.func == &filters::brightness_line);
+  CHECK(kernel.params->value1 == doctest::Approx(0.5f));
+
+  GrayscaleNode grayscale;
+  CHECK(grayscale.getLineKernel(kernel));
+
+  // 範囲を変えるノード・ソースは融合対象外
+  HorizontalBlurNode hblur;
+  CHECK_FALSE(hblur.getLineKernel(kernel));
+  SourceNode src;
+  CHECK_FALSE(src.getLineKernel(kernel));
+}
+
 // =============================================================================
 // getDataRange() Tests
 // =============================================================================
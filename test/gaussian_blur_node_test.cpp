@@ -0,0 +1,328 @@
+// fleximg GaussianBlurNode Tests
+// 2次元ガウスぼかしノードのテスト
+
+#include "doctest.h"
+
+#define FLEXIMG_NAMESPACE fleximg
+#include "fleximg/core/common.h"
+#include "fleximg/core/types.h"
+#include "fleximg/image/image_buffer.h"
+#include "fleximg/nodes/composite_node.h"
+#include "fleximg/nodes/gaussian_blur_node.h"
+#include "fleximg/nodes/renderer_node.h"
+#include "fleximg/nodes/sink_node.h"
+#include "fleximg/nodes/source_node.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace fleximg;
+
+// =============================================================================
+// Helper Functions
+// =============================================================================
+
+// 乱数の模様 + 透明な区間（合計アルファが 0 になる出力を含める）
+static ImageBuffer createNoiseImage(int width, int height, uint32_t seed) {
+  ImageBuffer img(width, height, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int i = 0; i < width * 4; i++) {
+      seed = seed * 1103515245u + 12345u;
+      row[i] = static_cast<uint8_t>(seed >> 24);
+    }
+  }
+  for (int y = 0; y < height / 2; y++) {
+    uint8_t *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int x = 0; x < width / 3; x++) row[x * 4 + 3] = 0;
+  }
+  return img;
+}
+
+// ボックス（幅 2r+1）3回の1次元重み（合計 (2r+1)^3）
+static std::vector<uint64_t> boxCubedWeights(int radius) {
+  std::vector<uint64_t> w(1, 1);
+  for (int pass = 0; pass < 3; pass++) {
+    std::vector<uint64_t> next(w.size() + static_cast<size_t>(radius * 2), 0);
+    for (size_t i = 0; i < w.size(); i++) {
+      for (int k = 0; k <= radius * 2; k++)
+        next[i + static_cast<size_t>(k)] += w[i];
+    }
+    w = next;
+  }
+  return w;
+}
+
+// 2次元の直接畳み込み（範囲外はゼロ、α加重合計を整数除算で正規化）
+static void gaussianBlurReference(const ViewPort &src,
+                                  std::vector<uint8_t> &dst, int radius) {
+  int w = src.width, h = src.height, m = radius * 3;
+  std::vector<uint64_t> weights = boxCubedWeights(radius);
+  uint64_t k = static_cast<uint64_t>(radius * 2 + 1);
+  uint64_t area = k * k * k * k * k * k;
+  dst.assign(static_cast<size_t>(w * h * 4), 0);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      uint64_t sum[4] = {0, 0, 0, 0};
+      for (int dy = -m; dy <= m; dy++) {
+        for (int dx = -m; dx <= m; dx++) {
+          int sx = x + dx, sy = y + dy;
+          if (sx < 0 || sx >= w || sy < 0 || sy >= h) continue;
+          const auto *p = static_cast<const uint8_t *>(src.pixelAt(sx, sy));
+          uint64_t wt = weights[static_cast<size_t>(dx + m)] *
+                        weights[static_cast<size_t>(dy + m)];
+          for (int c = 0; c < 3; c++) sum[c] += wt * p[c] * p[3];
+          sum[3] += wt * p[3];
+        }
+      }
+      uint8_t *d = &dst[static_cast<size_t>((y * w + x) * 4)];
+      if (sum[3] == 0) continue;
+      for (int c = 0; c < 3; c++)
+        d[c] = static_cast<uint8_t>(sum[c] / sum[3]);
+      d[3] = static_cast<uint8_t>(sum[3] / area);
+    }
+  }
+}
+
+// push = false: src >> gblur >> renderer >> sink
+// push = true:  src >> renderer >> gblur >> sink
+static void renderGaussian(const ViewPort &srcView, ImageBuffer &dst,
+                           float sigma, bool push) {
+  int w = srcView.width, h = srcView.height;
+  int_fixed cx = float_to_fixed(static_cast<float>(w) / 2.0f);
+  int_fixed cy = float_to_fixed(static_cast<float>(h) / 2.0f);
+  SourceNode src(srcView, cx, cy);
+  GaussianBlurNode gblur;
+  RendererNode renderer;
+  SinkNode sink(dst.view(), cx, cy);
+  gblur.setSigma(sigma);
+  if (push) {
+    src >> renderer >> gblur >> sink;
+  } else {
+    src >> gblur >> renderer >> sink;
+  }
+  renderer.setVirtualScreen(w, h);
+  renderer.setPivot(cx, cy);
+  renderer.exec();
+}
+
+static int countMismatches(const ImageBuffer &img,
+                           const std::vector<uint8_t> &expected) {
+  int mismatches = 0;
+  for (int y = 0; y < img.height(); y++) {
+    const uint8_t *row = static_cast<const uint8_t *>(img.pixelAt(0, y));
+    for (int i = 0; i < img.width() * 4; i++) {
+      if (row[i] != expected[static_cast<size_t>(y * img.width() * 4 + i)])
+        mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+// =============================================================================
+// GaussianBlurNode Tests
+// =============================================================================
+
+TEST_CASE("GaussianBlurNode setSigma selects box radius") {
+  GaussianBlurNode node;
+  CHECK(node.boxRadius() == 0); // デフォルトはパススルー
+
+  // ボックス3回の標準偏差は sqrt(r^2 + r)
+  node.setSigma(std::sqrt(12.0f));
+  CHECK(node.boxRadius() == 3);
+  CHECK(node.kernelSize() == 7);
+  CHECK(node.margin() == 9);
+
+  node.setSigma(10.0f);
+  CHECK(node.boxRadius() == 10); // sqrt(110) = 10.49
+
+  node.setSigma(-1.0f);
+  CHECK(node.boxRadius() == 0);
+  CHECK(node.sigma() == 0.0f);
+
+  node.setSigma(1000.0f);
+  CHECK(node.boxRadius() == GaussianBlurNode::kMaxRadius);
+  CHECK(node.sigma() == GaussianBlurNode::kMaxSigma);
+}
+
+TEST_CASE("GaussianBlurNode matches box-cubed reference") {
+  // 高さは偶数（SourceNode/SinkNode の基準点が画素境界に来るように）
+  const int w = 45, h = 30;
+  ImageBuffer srcImg = createNoiseImage(w, h, 777);
+  ViewPort srcView = srcImg.view();
+
+  const float sigmas[] = {1.0f, std::sqrt(6.0f), std::sqrt(20.0f)};
+  for (float sigma : sigmas) {
+    GaussianBlurNode probe;
+    probe.setSigma(sigma);
+    CAPTURE(probe.boxRadius());
+    std::vector<uint8_t> expected;
+    gaussianBlurReference(srcView, expected, probe.boxRadius());
+
+    // pull型（出力は上下左右に拡張されるが、画像内の領域を比較）
+    ImageBuffer pulled(w, h, PixelFormatIDs::RGBA8_Straight,
+                       InitPolicy::Zero);
+    renderGaussian(srcView, pulled, sigma, false);
+    CHECK(countMismatches(pulled, expected) == 0);
+
+    // push型（出力サイズ = 入力サイズ、エッジはゼロパディング）
+    ImageBuffer pushed(w, h, PixelFormatIDs::RGBA8_Straight,
+                       InitPolicy::Zero);
+    renderGaussian(srcView, pushed, sigma, true);
+    CHECK(countMismatches(pushed, expected) == 0);
+  }
+}
+
+TEST_CASE("GaussianBlurNode keeps uniform opaque interior") {
+  const int w = 40, h = 40;
+  ImageBuffer srcImg(w, h, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < h; y++) {
+    uint8_t *row = static_cast<uint8_t *>(srcImg.pixelAt(0, y));
+    for (int x = 0; x < w; x++) {
+      row[x * 4 + 0] = 200;
+      row[x * 4 + 1] = 100;
+      row[x * 4 + 2] = 50;
+      row[x * 4 + 3] = 255;
+    }
+  }
+
+  ImageBuffer dst(w, h, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  renderGaussian(srcImg.view(), dst, 5.0f, false); // r = 5, margin = 15
+
+  const uint8_t *center = static_cast<const uint8_t *>(dst.pixelAt(20, 20));
+  CHECK(center[0] == 200);
+  CHECK(center[1] == 100);
+  CHECK(center[2] == 50);
+  CHECK(center[3] == 255);
+
+  // 端はアルファのみ減衰し、色は保たれる
+  const uint8_t *corner = static_cast<const uint8_t *>(dst.pixelAt(0, 0));
+  CHECK(corner[0] == 200);
+  CHECK(corner[3] < 255);
+  CHECK(corner[3] > 0);
+}
+
+// 2枚のスプライトの合成 -> GaussianBlur の差分描画シーン
+struct GaussianSpriteScene {
+  static constexpr int kSize = 64;
+  SourceNode spriteA;
+  SourceNode spriteB;
+  CompositeNode composite{2};
+  GaussianBlurNode gblur;
+  RendererNode renderer;
+  SinkNode sink;
+
+  GaussianSpriteScene(ImageBuffer &dst, const ImageBuffer &a,
+                      const ImageBuffer &b, float sigma) {
+    spriteA.setSource(a.view());
+    spriteA.setPivot(float_to_fixed(a.width() / 2.0f),
+                     float_to_fixed(a.height() / 2.0f));
+    spriteB.setSource(b.view());
+    spriteB.setPivot(float_to_fixed(b.width() / 2.0f),
+                     float_to_fixed(b.height() / 2.0f));
+    sink.setTarget(dst.view());
+    sink.setPivotCenter();
+    spriteA.connectTo(composite, 0);
+    spriteB.connectTo(composite, 1);
+    composite >> gblur >> renderer >> sink;
+    gblur.setSigma(sigma);
+    renderer.setVirtualScreen(kSize, kSize);
+    renderer.setPivotCenter();
+  }
+
+  void apply(float ax, float ay, float bx, float by) {
+    spriteA.setTranslation(ax, ay);
+    spriteB.setTranslation(bx, by);
+  }
+};
+
+TEST_CASE("GaussianBlurNode damage tracking matches full render") {
+  // 小数座標のスプライト（AABBの原点が画素境界に乗らない）を移動させ、
+  // 差分描画の結果が全画面描画と一致することを確認する。
+  // 複数入力のCompositeを上流に置き、上流Responseの返却漏れも検出する
+  ImageBuffer a = createNoiseImage(13, 9, 11);
+  ImageBuffer b = createNoiseImage(7, 12, 23);
+  const float sigma = 4.0f;  // r = 4, margin = 12
+  const int size = GaussianSpriteScene::kSize;
+
+  ImageBuffer dst(size, size, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  GaussianSpriteScene scene(dst, a, b, sigma);
+  scene.renderer.setDamageTrackingEnabled(true);
+
+  uint32_t seed = 99;
+  auto next = [&seed](float range) {
+    seed = seed * 1103515245u + 12345u;
+    return (static_cast<float>((seed >> 8) & 0xFFFF) / 65536.0f - 0.5f) *
+           range;
+  };
+  for (int frame = 0; frame < 24; frame++) {
+    CAPTURE(frame);
+    float ax = next(60.0f), ay = next(60.0f);
+    float bx = next(60.0f), by = next(60.0f);
+    scene.apply(ax, ay, bx, by);
+    scene.renderer.exec();
+
+    ImageBuffer ref(size, size, PixelFormatIDs::RGBA8_Straight,
+                    InitPolicy::Zero);
+    {
+      GaussianSpriteScene fresh(ref, a, b, sigma);
+      fresh.apply(ax, ay, bx, by);
+      fresh.renderer.exec();
+    }
+    int mismatches = 0;
+    for (int y = 0; y < size; y++) {
+      if (std::memcmp(ref.pixelAt(0, y), dst.pixelAt(0, y),
+                      static_cast<size_t>(size) * 4) != 0)
+        mismatches++;
+    }
+    CHECK(mismatches == 0);
+  }
+}
+
+TEST_CASE("GaussianBlurNode getDataRange expands both axes") {
+  const int imgSize = 32;
+  const int canvasSize = 100;
+
+  // 画像範囲（ワールド座標）: [-16, 16) x [-16, 16)
+  ImageBuffer srcImg = createNoiseImage(imgSize, imgSize, 5);
+  SourceNode src(srcImg.view(), float_to_fixed(16.0f), float_to_fixed(16.0f));
+  GaussianBlurNode gblur;
+  RendererNode renderer;
+  src >> gblur >> renderer;
+
+  gblur.setSigma(std::sqrt(12.0f)); // r = 3, margin = 9
+  const int m = 9;
+
+  PrepareRequest prepReq;
+  prepReq.width = static_cast<int16_t>(canvasSize);
+  prepReq.height = static_cast<int16_t>(canvasSize);
+  prepReq.origin.x = float_to_fixed(-50.0f);
+  prepReq.origin.y = float_to_fixed(-50.0f);
+
+  PrepareResponse prepResult = gblur.pullPrepare(prepReq);
+  CHECK(prepResult.ok());
+  CHECK(prepResult.width == imgSize + m * 2);
+  CHECK(prepResult.height == imgSize + m * 2);
+
+  RenderRequest renderReq;
+  renderReq.width = static_cast<int16_t>(canvasSize);
+  renderReq.height = 1;
+  renderReq.origin.x = prepReq.origin.x;
+
+  // 画像内の行: request座標系で [34, 66) を両側に margin 拡張
+  renderReq.origin.y = 0;
+  DataRange range = gblur.getDataRange(renderReq);
+  CHECK(range.hasData());
+  CHECK(range.startX == 34 - m);
+  CHECK(range.endX == 66 + m);
+
+  // 画像の下端（Y=16）から margin 行以内は有効、それより下は空
+  renderReq.origin.y = float_to_fixed(16.0f + m - 1);
+  CHECK(gblur.getDataRange(renderReq).hasData());
+  renderReq.origin.y = float_to_fixed(16.0f + m);
+  CHECK_FALSE(gblur.getDataRange(renderReq).hasData());
+
+  gblur.pullFinalize();
+}
@@ -0,0 +1,395 @@
+// fleximg Band-Parallel Rendering Tests
+// バンド並列実行のテスト
+
+#include "doctest.h"
+
+#define FLEXIMG_NAMESPACE fleximg
+#include "fleximg/core/common.h"
+#include "fleximg/core/thread_pool_executor.h"
+#include "fleximg/core/types.h"
+#include "fleximg/image/image_buffer.h"
+#include "fleximg/nodes/composite_node.h"
+#include "fleximg/nodes/gaussian_blur_node.h"
+#include "fleximg/nodes/horizontal_blur_node.h"
+#include "fleximg/nodes/matte_node.h"
+#include "fleximg/nodes/renderer_node.h"
+#include "fleximg/nodes/sink_node.h"
+#include "fleximg/nodes/source_node.h"
+#include "fleximg/nodes/vertical_blur_node.h"
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+using namespace fleximg;
+
+// =============================================================================
+// Helper Functions
+// =============================================================================
+
+// テスト用画像を作成（座標依存の模様 + 半透明）
+static ImageBuffer createPatternImage(int width, int height, uint8_t seed) {
+  ImageBuffer img(width, height, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int x = 0; x < width; x++) {
+      row[x * 4 + 0] = static_cast<uint8_t>(x * 7 + seed);
+      row[x * 4 + 1] = static_cast<uint8_t>(y * 5 + seed);
+      row[x * 4 + 2] = static_cast<uint8_t>((x ^ y) + seed);
+      row[x * 4 + 3] = static_cast<uint8_t>(128 + ((x + y) & 127));
+    }
+  }
+  return img;
+}
+
+static bool sameBytes(const ImageBuffer &a, const ImageBuffer &b) {
+  if (a.width() != b.width() || a.height() != b.height())
+    return false;
+  for (int y = 0; y < a.height(); y++) {
+    if (std::memcmp(a.pixelAt(0, y), b.pixelAt(0, y),
+                    static_cast<size_t>(a.width()) * 4) != 0)
+      return false;
+  }
+  return true;
+}
+
+// 呼び出し元スレッドで逆順にタスクを実行する実行器（バンド分割の検証用）
+class ReverseOrderExecutor : public IParallelExecutor {
+public:
+  void parallelFor(int_fast16_t count, TaskFunc func,
+                   void *userData) override {
+    for (int_fast16_t i = count - 1; i >= 0; --i) {
+      func(i, userData);
+    }
+  }
+  int_fast16_t concurrency() const override { return 3; }
+};
+
+// 回転ソース2枚をCompositeで合成するシーンを描画
+static int_fast16_t renderCompositeScene(ImageBuffer &dst,
+                                         IParallelExecutor *executor) {
+  const int canvasW = 160;
+  const int canvasH = 120;
+  ImageBuffer img1 = createPatternImage(64, 48, 11);
+  ImageBuffer img2 = createPatternImage(40, 40, 97);
+
+  SourceNode src1(img1.view(), float_to_fixed(32.0f), float_to_fixed(24.0f));
+  src1.setRotation(0.4f);
+  SourceNode src2(img2.view(), float_to_fixed(20.0f), float_to_fixed(20.0f));
+  src2.setInterpolationMode(InterpolationMode::Bilinear);
+  src2.setRotationScale(-0.7f, 1.5f, 1.2f);
+  src2.setPosition(15.0f, -10.0f);
+
+  CompositeNode composite(2);
+  RendererNode renderer;
+  SinkNode sink(dst.view(), float_to_fixed(canvasW / 2.0f),
+                float_to_fixed(canvasH / 2.0f));
+
+  src1 >> composite;
+  src2.connectTo(composite, 1);
+  composite >> renderer >> sink;
+
+  renderer.setVirtualScreen(canvasW, canvasH);
+  renderer.setPivotCenter();
+  renderer.setParallelExecutor(executor);
+  renderer.exec();
+  return renderer.lastBandCount();
+}
+
+// =============================================================================
+// ThreadPoolExecutor Tests
+// =============================================================================
+
+TEST_CASE("ThreadPoolExecutor runs every index exactly once") {
+  ThreadPoolExecutor executor(4);
+  CHECK(executor.concurrency() == 4);
+
+  std::vector<std::atomic<int>> hits(37);
+  for (auto &h : hits)
+    h.store(0);
+
+  // 複数回呼び出してジョブの再利用も確認
+  for (int round = 0; round < 5; round++) {
+    executor.parallelFor(
+        static_cast<int_fast16_t>(hits.size()),
+        [](int_fast16_t index, void *userData) {
+          auto *v = static_cast<std::vector<std::atomic<int>> *>(userData);
+          (*v)[static_cast<size_t>(index)].fetch_add(1);
+        },
+        &hits);
+  }
+  for (auto &h : hits) {
+    CHECK(h.load() == 5);
+  }
+}
+
+TEST_CASE("ThreadPoolExecutor with single thread runs inline") {
+  ThreadPoolExecutor executor(1);
+  int sum = 0;
+  executor.parallelFor(
+      4,
+      [](int_fast16_t index, void *userData) {
+        *static_cast<int *>(userData) += static_cast<int>(index);
+      },
+      &sum);
+  CHECK(sum == 6);
+}
+
+// =============================================================================
+// Band-Parallel RendererNode Tests
+// =============================================================================
+
+TEST_CASE("Parallel: band split matches sequential output") {
+  ImageBuffer seq(160, 120, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  ImageBuffer par(160, 120, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+
+  CHECK(renderCompositeScene(seq, nullptr) == 1);
+
+  ReverseOrderExecutor executor;
+  CHECK(renderCompositeScene(par, &executor) == 3);
+  CHECK(sameBytes(seq, par));
+}
+
+TEST_CASE("Parallel: thread pool matches sequential output") {
+  ImageBuffer seq(160, 120, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  renderCompositeScene(seq, nullptr);
+
+  ThreadPoolExecutor executor(4);
+  // 繰り返し実行してスレッド間の干渉がないことを確認
+  for (int i = 0; i < 4; i++) {
+    ImageBuffer par(160, 120, PixelFormatIDs::RGBA8_Straight,
+                    InitPolicy::Zero);
+    CHECK(renderCompositeScene(par, &executor) == 4);
+    CHECK(sameBytes(seq, par));
+  }
+}
+
+TEST_CASE("Parallel: matte and horizontal blur match sequential output") {
+  const int size = 96;
+  ImageBuffer fgImg = createPatternImage(size, size, 3);
+  ImageBuffer bgImg = createPatternImage(size, size, 200);
+  ImageBuffer maskImg(size, size, PixelFormatIDs::Alpha8);
+  for (int y = 0; y < size; y++) {
+    uint8_t *row = static_cast<uint8_t *>(maskImg.pixelAt(0, y));
+    for (int x = 0; x < size; x++) {
+      row[x] = static_cast<uint8_t>((x * 3 + y * 2) & 0xFF);
+    }
+  }
+
+  auto render = [&](ImageBuffer &dst, IParallelExecutor *executor) {
+    int_fixed center = float_to_fixed(size / 2.0f);
+    SourceNode fg(fgImg.view(), center, center);
+    SourceNode bg(bgImg.view(), center, center);
+    SourceNode mask(maskImg.view(), center, center);
+    mask.setRotation(0.2f);
+    MatteNode matte;
+    HorizontalBlurNode hblur;
+    hblur.setRadius(3);
+    RendererNode renderer;
+    SinkNode sink(dst.view(), center, center);
+
+    fg.connectTo(matte, 0);
+    bg.connectTo(matte, 1);
+    mask.connectTo(matte, 2);
+    matte >> hblur >> renderer >> sink;
+
+    renderer.setVirtualScreen(size, size);
+    renderer.setPivotCenter();
+    renderer.setParallelExecutor(executor);
+    renderer.exec();
+    return renderer.lastBandCount();
+  };
+
+  ImageBuffer seq(size, size, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  ImageBuffer par(size, size, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  render(seq, nullptr);
+
+  ThreadPoolExecutor executor(3);
+  CHECK(render(par, &executor) == 3);
+  CHECK(sameBytes(seq, par));
+}
+
+TEST_CASE("Parallel: worker count is clamped by setWorkerCount") {
+  ImageBuffer dst(160, 120, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  ImageBuffer img = createPatternImage(32, 32, 5);
+
+  SourceNode src(img.view(), float_to_fixed(16.0f), float_to_fixed(16.0f));
+  RendererNode renderer;
+  SinkNode sink(dst.view(), float_to_fixed(80.0f), float_to_fixed(60.0f));
+  src >> renderer >> sink;
+
+  ThreadPoolExecutor executor(4);
+  renderer.setVirtualScreen(160, 120);
+  renderer.setPivotCenter();
+  renderer.setParallelExecutor(&executor);
+  renderer.setWorkerCount(2);
+  renderer.exec();
+  CHECK(renderer.lastBandCount() == 2);
+}
+
+TEST_CASE("Parallel: VerticalBlurNode bands warm from halo rows") {
+  const int size = 64;
+  ImageBuffer img = createPatternImage(size, size, 42);
+  int_fixed center = float_to_fixed(size / 2.0f);
+
+  auto render = [&](ImageBuffer &dst, IParallelExecutor *executor,
+                    int passes) {
+    SourceNode src(img.view(), center, center);
+    src.setRotation(0.3f);
+    VerticalBlurNode vblur;
+    vblur.setRadius(4);
+    vblur.setPasses(passes);
+    RendererNode renderer;
+    SinkNode sink(dst.view(), center, center);
+    src >> vblur >> renderer >> sink;
+
+    renderer.setVirtualScreen(size, size);
+    renderer.setPivotCenter();
+    renderer.setParallelExecutor(executor);
+    renderer.exec();
+    return renderer.lastBandCount();
+  };
+
+  for (int passes = 1; passes <= 3; passes++) {
+    CAPTURE(passes);
+    ImageBuffer seq(size, size, PixelFormatIDs::RGBA8_Straight,
+                    InitPolicy::Zero);
+    render(seq, nullptr, passes);
+
+    // 逆順実行: 各バンドが前のバンドの状態なしで開始できること
+    ImageBuffer rev(size, size, PixelFormatIDs::RGBA8_Straight,
+                    InitPolicy::Zero);
+    ReverseOrderExecutor reverse;
+    CHECK(render(rev, &reverse, passes) == 3);
+    CHECK(sameBytes(seq, rev));
+
+    ImageBuffer par(size, size, PixelFormatIDs::RGBA8_Straight,
+                    InitPolicy::Zero);
+    ThreadPoolExecutor executor(4);
+    CHECK(render(par, &executor, passes) == 4);
+    CHECK(sameBytes(seq, par));
+  }
+}
+
+TEST_CASE("Parallel: GaussianBlurNode bands match sequential output") {
+  const int size = 64;
+  ImageBuffer img = createPatternImage(size, size, 42);
+  int_fixed center = float_to_fixed(size / 2.0f);
+
+  auto render = [&](ImageBuffer &dst, IParallelExecutor *executor) {
+    SourceNode src(img.view(), center, center);
+    src.setRotation(0.3f);
+    GaussianBlurNode gblur;
+    gblur.setSigma(3.0f);
+    RendererNode renderer;
+    SinkNode sink(dst.view(), center, center);
+    src >> gblur >> renderer >> sink;
+
+    renderer.setVirtualScreen(size, size);
+    renderer.setPivotCenter();
+    renderer.setParallelExecutor(executor);
+    renderer.exec();
+    return renderer.lastBandCount();
+  };
+
+  ImageBuffer seq(size, size, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  render(seq, nullptr);
+
+  // 逆順実行: 各バンドが前のバンドの累積状態なしで開始できること
+  ImageBuffer rev(size, size, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  ReverseOrderExecutor reverse;
+  CHECK(render(rev, &reverse) == 3);
+  CHECK(sameBytes(seq, rev));
+
+  ImageBuffer par(size, size, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  ThreadPoolExecutor executor(4);
+  CHECK(render(par, &executor) == 4);
+  CHECK(sameBytes(seq, par));
+}
+
+TEST_CASE("Parallel: GaussianBlurNode over CompositeNode matches sequential") {
+  // 途中から始まるバンドの先頭行は多数の上流行を再累積するため、
+  // 上流Responseの返却漏れがあるとプールが枯渇しComposite出力が欠ける
+  const int width = 200;
+  const int height = 160;
+  ImageBuffer imgA = createPatternImage(48, 40, 17);
+  ImageBuffer imgB = createPatternImage(36, 52, 91);
+
+  auto render = [&](ImageBuffer &dst, IParallelExecutor *executor) {
+    SourceNode srcA(imgA.view(), float_to_fixed(24.0f), float_to_fixed(20.0f));
+    srcA.setTranslation(-30.0f, -10.0f);
+    SourceNode srcB(imgB.view(), float_to_fixed(18.0f), float_to_fixed(26.0f));
+    srcB.setTranslation(25.0f, 15.0f);
+    srcB.setRotation(0.4f);
+    CompositeNode composite(2);
+    GaussianBlurNode gblur;
+    gblur.setSigma(2.5f);
+    RendererNode renderer;
+    SinkNode sink(dst.view(), float_to_fixed(width / 2.0f),
+                  float_to_fixed(height / 2.0f));
+    srcA.connectTo(composite, 0);
+    srcB.connectTo(composite, 1);
+    composite >> gblur >> renderer >> sink;
+
+    renderer.setVirtualScreen(width, height);
+    renderer.setPivotCenter();
+    renderer.setParallelExecutor(executor);
+    renderer.exec();
+    return renderer.lastBandCount();
+  };
+
+  ImageBuffer seq(width, height, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  render(seq, nullptr);
+
+  ImageBuffer rev(width, height, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  ReverseOrderExecutor reverse;
+  CHECK(render(rev, &reverse) > 1);
+  CHECK(sameBytes(seq, rev));
+
+  ImageBuffer par(width, height, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  ThreadPoolExecutor executor(4);
+  CHECK(render(par, &executor) > 1);
+  CHECK(sameBytes(seq, par));
+}
+
+TEST_CASE("Parallel: push-side VerticalBlurNode falls back to sequential") {
+  const int size = 64;
+  ImageBuffer img = createPatternImage(size, size, 42);
+  int_fixed center = float_to_fixed(size / 2.0f);
+
+  auto render = [&](ImageBuffer &dst, IParallelExecutor *executor) {
+    SourceNode src(img.view(), center, center);
+    VerticalBlurNode vblur;
+    vblur.setRadius(4);
+    RendererNode renderer;
+    SinkNode sink(dst.view(), center, center);
+    src >> renderer >> vblur >> sink;
+
+    renderer.setVirtualScreen(size, size);
+    renderer.setPivotCenter();
+    renderer.setParallelExecutor(executor);
+    renderer.exec();
+    return renderer.lastBandCount();
+  };
+
+  ImageBuffer seq(size, size, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  ImageBuffer par(size, size, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  render(seq, nullptr);
+
+  ThreadPoolExecutor executor(4);
+  CHECK(render(par, &executor) == 1);
+  CHECK(sameBytes(seq, par));
+}
@@ -9,13 +9,17 @@
 #include "fleximg/image/image_buffer.h"
 #include "fleximg/image/render_types.h"
 #include "fleximg/nodes/affine_node.h"
+#include "fleximg/nodes/brightness_node.h"
 #include "fleximg/nodes/composite_node.h"
 #include "fleximg/nodes/grayscale_node.h"
+#include "fleximg/nodes/horizontal_blur_node.h"
 #include "fleximg/nodes/renderer_node.h"
 #include "fleximg/nodes/sink_node.h"
 #include "fleximg/nodes/source_node.h"
+#include "fleximg/nodes/vertical_blur_node.h"
 
 #include <cmath>
+#include <cstring>
 
 using namespace fleximg;
 
@@ -385,3 +389,230 @@ TEST_CASE("Pipeline: complex with tiled rendering") {
   // タイル処理でも結果が一致することを確認（許容誤差あり）
   CHECK(comparePixels(dstImg1.view(), dstImg2.view(), 5));
 }
+
+// =============================================================================
+// Strip Pipeline Tests
+// =============================================================================
+
+// ストリップ高さを指定して source -> brightness -> grayscale -> sink を描画
+// 戻り値: 実際に使われたストリップ高さ
+static int_fast16_t renderStripScene(ImageBuffer &dst, const ImageBuffer &src,
+                                     int_fast16_t stripHeight,
+                                     bool withBlur = false) {
+  SourceNode source(src.view(), float_to_fixed(20.5f), float_to_fixed(13.0f));
+  source.setPosition(3.0f, -5.0f);
+  BrightnessNode brightness;
+  brightness.setAmount(0.1f);
+  GrayscaleNode grayscale;
+  HorizontalBlurNode hblur;
+  hblur.setRadius(1);
+  RendererNode renderer;
+  SinkNode sink(dst.view(), float_to_fixed(dst.width() / 2.0f),
+                float_to_fixed(dst.height() / 2.0f));
+
+  if (withBlur) {
+    source >> brightness >> hblur >> grayscale >> renderer >> sink;
+  } else {
+    source >> brightness >> grayscale >> renderer >> sink;
+  }
+  renderer.setVirtualScreen(dst.width(), dst.height());
+  renderer.setPivotCenter();
+  renderer.setStripHeight(stripHeight);
+  renderer.exec();
+  return renderer.activeStripHeight();
+}
+
+TEST_CASE("Pipeline: strip mode matches scanline output") {
+  // RGB888ソース: フィルタ前に必ず変換されるためソース画像は変更されない
+  ImageBuffer srcImg(41, 27, PixelFormatIDs::RGB888);
+  for (int y = 0; y < 27; y++) {
+    uint8_t *row = static_cast<uint8_t *>(srcImg.pixelAt(0, y));
+    for (int x = 0; x < 41 * 3; x++) {
+      row[x] = static_cast<uint8_t>(x * 5 + y * 9);
+    }
+  }
+
+  ImageBuffer ref(70, 50, PixelFormatIDs::RGB565_LE, InitPolicy::Zero);
+  CHECK(renderStripScene(ref, srcImg, 1) == 1);
+
+  // 画面高さで割り切れないストリップ高さも含める
+  for (int_fast16_t rows : {4, 16, 64}) {
+    CAPTURE(rows);
+    ImageBuffer dst(70, 50, PixelFormatIDs::RGB565_LE, InitPolicy::Zero);
+    CHECK(renderStripScene(dst, srcImg, rows) == rows);
+    CHECK(std::memcmp(ref.data(), dst.data(), 70 * 50 * 2) == 0);
+  }
+}
+
+TEST_CASE("Pipeline: strip mode falls back for scanline-only nodes") {
+  ImageBuffer srcImg(41, 27, PixelFormatIDs::RGB888);
+  for (int y = 0; y < 27; y++) {
+    uint8_t *row = static_cast<uint8_t *>(srcImg.pixelAt(0, y));
+    for (int x = 0; x < 41 * 3; x++) {
+      row[x] = static_cast<uint8_t>(x * 3 + y * 7);
+    }
+  }
+
+  ImageBuffer ref(64, 48, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  ImageBuffer dst(64, 48, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  renderStripScene(ref, srcImg, 1, true);
+
+  // HorizontalBlurNodeは行ごとに範囲が変わるためストリップ非対応
+  CHECK(renderStripScene(dst, srcImg, 16, true) == 1);
+  CHECK(comparePixels(ref.view(), dst.view()));
+}
+
+TEST_CASE("Pipeline: strip mode is disabled by affine transforms") {
+  ImageBuffer srcImg = createGradientImage(32, 32);
+  ImageBuffer dst(64, 64, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+
+  SourceNode src(srcImg.view(), float_to_fixed(16.0f), float_to_fixed(16.0f));
+  src.setRotation(0.5f);
+  RendererNode renderer;
+  SinkNode sink(dst.view(), float_to_fixed(32.0f), float_to_fixed(32.0f));
+  src >> renderer >> sink;
+  renderer.setVirtualScreen(64, 64);
+  renderer.setStripHeight(8);
+  renderer.exec();
+  CHECK(renderer.stripHeight() == 8);
+  CHECK(renderer.activeStripHeight() == 1);
+  CHECK(hasNonZeroPixels(dst.view()));
+
+  renderer.setStripHeight(1000);
+  CHECK(renderer.stripHeight() == RendererNode::MAX_STRIP_HEIGHT);
+}
+
+// =============================================================================
+// Incremental Prepare Tests
+// =============================================================================
+
+// onPullPrepare() の実行回数を数えるソース
+class CountingSourceNode : public SourceNode {
+public:
+  int prepareCount = 0;
+
+  PrepareResponse onPullPrepare(const PrepareRequest &request) override {
+    prepareCount++;
+    return SourceNode::onPullPrepare(request);
+  }
+};
+
+// 3ソース -> 合成 -> アフィン -> 垂直ブラー のシーン
+struct IncrementalScene {
+  static constexpr int kSize = 80;
+  CountingSourceNode src[3];
+  CompositeNode composite{3};
+  AffineNode affine;
+  VerticalBlurNode vblur;
+  RendererNode renderer;
+  SinkNode sink;
+
+  IncrementalScene(ImageBuffer &dst, const ImageBuffer &img,
+                   bool incremental) {
+    int_fixed center = float_to_fixed(kSize / 2.0f);
+    for (int i = 0; i < 3; i++) {
+      src[i].setSource(img.view());
+      src[i].setPivot(float_to_fixed(16.0f), float_to_fixed(16.0f));
+      src[i].setPosition(static_cast<float>(i * 12 - 12),
+                         static_cast<float>(i * 5 - 5));
+      src[i].connectTo(composite, i);
+    }
+    src[1].setRotation(0.3f);
+    affine.setRotation(0.1f);
+    vblur.setRadius(2);
+    sink.setTarget(dst.view());
+    sink.setPivot(center, center);
+
+    composite >> affine >> vblur >> renderer >> sink;
+    renderer.setVirtualScreen(kSize, kSize);
+    renderer.setPivotCenter();
+    renderer.setIncrementalPrepareEnabled(incremental);
+  }
+};
+
+// 指定フレームの状態を差分prepareなしで描画し、比較する
+static bool matchesFreshRender(const ImageBuffer &dst, const ImageBuffer &img,
+                               float src2X, float radius) {
+  ImageBuffer ref(IncrementalScene::kSize, IncrementalScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  IncrementalScene scene(ref, img, false);
+  scene.src[2].setPosition(src2X, 5.0f);
+  scene.vblur.setRadius(static_cast<int>(radius));
+  scene.renderer.exec();
+  return std::memcmp(ref.data(), dst.data(),
+                     IncrementalScene::kSize * IncrementalScene::kSize * 4) == 0;
+}
+
+TEST_CASE("Pipeline: incremental prepare skips unchanged subtrees") {
+  ImageBuffer img = createGradientImage(32, 32);
+  ImageBuffer dst(IncrementalScene::kSize, IncrementalScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  IncrementalScene scene(dst, img, true);
+
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  CHECK(scene.src[0].prepareCount == 1);
+  CHECK(matchesFreshRender(dst, img, 12.0f, 2));
+
+  // 変更なし: どのソースも再準備しない
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  for (auto &s : scene.src) {
+    CHECK(s.prepareCount == 1);
+  }
+  CHECK(matchesFreshRender(dst, img, 12.0f, 2));
+
+  // 1ソースのみ移動: そのソースのみ再準備し、結果は全体の再準備と一致
+  for (int frame = 1; frame <= 3; frame++) {
+    float x = 12.0f + static_cast<float>(frame * 3);
+    scene.src[2].setPosition(x, 5.0f);
+    std::memset(dst.data(), 0, IncrementalScene::kSize * IncrementalScene::kSize * 4);
+    CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+    CHECK(scene.src[0].prepareCount == 1);
+    CHECK(scene.src[1].prepareCount == 1);
+    CHECK(scene.src[2].prepareCount == 1 + frame);
+    CHECK(matchesFreshRender(dst, img, x, 2));
+  }
+
+  // 下流ノードの設定変更: 上流のソースは再準備しない
+  scene.vblur.setRadius(3);
+  std::memset(dst.data(), 0, IncrementalScene::kSize * IncrementalScene::kSize * 4);
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  CHECK(scene.src[0].prepareCount == 1);
+  CHECK(matchesFreshRender(dst, img, 21.0f, 3));
+}
+
+TEST_CASE("Pipeline: incremental prepare handles reconnection and settings") {
+  ImageBuffer img = createGradientImage(32, 32);
+  ImageBuffer dst(IncrementalScene::kSize, IncrementalScene::kSize,
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  IncrementalScene scene(dst, img, true);
+  scene.renderer.exec();
+
+  // 入力の付け替え: 新しい入力を準備する
+  CountingSourceNode extra;
+  extra.setSource(img.view());
+  scene.src[1].disconnectAll();
+  extra.connectTo(scene.composite, 1);
+  scene.renderer.exec();
+  CHECK(extra.prepareCount == 1);
+  CHECK(scene.src[0].prepareCount == 1);
+
+  // 元に戻す: 切断中に変更のなかったソースは前回の準備結果を再利用する
+  extra.disconnectAll();
+  scene.src[1].connectTo(scene.composite, 1);
+  std::memset(dst.data(), 0, IncrementalScene::kSize * IncrementalScene::kSize * 4);
+  scene.renderer.exec();
+  CHECK(scene.src[0].prepareCount == 1);
+  CHECK(scene.src[1].prepareCount == 1);
+  CHECK(matchesFreshRender(dst, img, 12.0f, 2));
+
+  // レンダラー設定の変更は全ノードを再準備
+  scene.renderer.setFilterFusionEnabled(false);
+  scene.renderer.exec();
+  CHECK(scene.src[0].prepareCount == 2);
+
+  // 無効時は毎回準備する
+  IncrementalScene plain(dst, img, false);
+  plain.renderer.exec();
+  plain.renderer.exec();
+  CHECK(plain.src[0].prepareCount == 2);
+}
@@ -2,6 +2,7 @@
 // ピクセルフォーマットDescriptor、変換のテスト
 
 #include "doctest.h"
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -1177,3 +1178,129 @@ TEST_CASE("resolveConverter: large pixel count") {
 
 // NOTE: "resolveConverter: custom allocator" テストは削除
 // 内部チャンク処理によりアロケータ引数が不要になったため
+
+// =============================================================================
+// Row Conversion Tests (SIMD vs per-pixel)
+// =============================================================================
+//
+// 行単位の変換（SIMD版: 8〜32ピクセル単位 + 端数）が
+// 1ピクセルずつの変換と一致することを検証
+
+namespace {
+
+// srcの [offset, offset + count) を行変換し、1ピクセルずつの変換結果と比較
+bool rowConvertMatchesPerPixel(PixelFormatDescriptor::ConvertFunc func,
+                               const std::vector<uint8_t> &src, size_t srcBpp,
+                               size_t dstBpp, size_t offset, size_t count) {
+  std::vector<uint8_t> row(count * dstBpp + 1, 0xAA);
+  std::vector<uint8_t> ref(count * dstBpp + 1, 0xAA);
+  func(row.data(), src.data() + offset * srcBpp, count, nullptr);
+  for (size_t i = 0; i < count; i++) {
+    func(ref.data() + i * dstBpp, src.data() + (offset + i) * srcBpp, 1,
+         nullptr);
+  }
+  // 末尾の次のバイトは書き換えない
+  return row == ref;
+}
+
+void checkRowConversion(PixelFormatID format, const std::vector<uint8_t> &raw,
+                        const std::vector<uint8_t> &rgba) {
+  size_t bpp = format->bytesPerPixel;
+  size_t rawPixels = raw.size() / bpp;
+  size_t rgbaPixels = rgba.size() / 4;
+  for (size_t offset = 0; offset < 4; offset++) {
+    for (size_t count = 0; count <= 80; count++) {
+      CHECK_MESSAGE(rowConvertMatchesPerPixel(format->toStraight, raw, bpp, 4,
+                                              offset, count),
+                    format->name, " toStraight offset=", offset,
+                    " count=", count);
+      CHECK_MESSAGE(rowConvertMatchesPerPixel(format->fromStraight, rgba, 4,
+                                              bpp, offset, count),
+                    format->name, " fromStraight offset=", offset,
+                    " count=", count);
+    }
+  }
+  CHECK(rowConvertMatchesPerPixel(format->toStraight, raw, bpp, 4, 0,
+                                  rawPixels));
+  CHECK(rowConvertMatchesPerPixel(format->fromStraight, rgba, 4, bpp, 0,
+                                  rgbaPixels));
+}
+
+// in-place変換（ViewPortの末尾詰め展開・前方詰め縮小）が
+// 別バッファへの変換と一致するか
+// - toStraight: src を dst の末尾に置く（dst == src - count * (4 - bpp)）
+// - fromStraight: dst == src
+void checkInPlaceConversion(PixelFormatID format,
+                            const std::vector<uint8_t> &raw,
+                            const std::vector<uint8_t> &rgba) {
+  size_t bpp = format->bytesPerPixel;
+  for (size_t count = 0; count <= 200; count++) {
+    std::vector<uint8_t> expected(count * 4 + 1, 0xAA);
+    format->toStraight(expected.data(), raw.data(), count, nullptr);
+    std::vector<uint8_t> buf(count * 4 + 1, 0xAA);
+    std::memcpy(buf.data() + count * (4 - bpp), raw.data(), count * bpp);
+    format->toStraight(buf.data(), buf.data() + count * (4 - bpp), count,
+                       nullptr);
+    CHECK_MESSAGE(buf == expected, std::string(format->name),
+                  " in-place toStraight count=", count);
+
+    expected.assign(count * bpp, 0);
+    format->fromStraight(expected.data(), rgba.data(), count, nullptr);
+    buf.assign(rgba.begin(),
+               rgba.begin() + static_cast<std::ptrdiff_t>(count * 4));
+    format->fromStraight(buf.data(), buf.data(), count, nullptr);
+    buf.resize(count * bpp);
+    CHECK_MESSAGE(buf == expected, std::string(format->name),
+                  " in-place fromStraight count=", count);
+  }
+}
+
+} // anonymous namespace
+
+TEST_CASE("toStraight/fromStraight in-place match out-of-place") {
+  std::vector<uint8_t> rgba(256 * 4);
+  uint32_t seed = 7;
+  for (auto &v : rgba) {
+    seed = seed * 1103515245u + 12345u;
+    v = static_cast<uint8_t>(seed >> 16);
+  }
+  std::vector<uint8_t> raw(rgba.begin(), rgba.begin() + 256 * 3);
+
+  checkInPlaceConversion(PixelFormatIDs::RGB332, raw, rgba);
+  checkInPlaceConversion(PixelFormatIDs::RGB565_LE, raw, rgba);
+  checkInPlaceConversion(PixelFormatIDs::RGB565_BE, raw, rgba);
+  checkInPlaceConversion(PixelFormatIDs::RGB888, raw, rgba);
+  checkInPlaceConversion(PixelFormatIDs::BGR888, raw, rgba);
+}
+
+TEST_CASE("toStraight/fromStraight rows match per-pixel conversion") {
+  // RGBA8入力: 疑似乱数（全チャンネル・全ビットを網羅）
+  std::vector<uint8_t> rgba(4096 * 4);
+  uint32_t seed = 1;
+  for (auto &v : rgba) {
+    seed = seed * 1103515245u + 12345u;
+    v = static_cast<uint8_t>(seed >> 16);
+  }
+
+  SUBCASE("RGB332 (all values)") {
+    std::vector<uint8_t> raw(256);
+    for (size_t i = 0; i < raw.size(); i++) raw[i] = static_cast<uint8_t>(i);
+    checkRowConversion(PixelFormatIDs::RGB332, raw, rgba);
+  }
+
+  SUBCASE("RGB565 (all values)") {
+    std::vector<uint8_t> raw(65536 * 2);
+    for (size_t i = 0; i < 65536; i++) {
+      raw[i * 2] = static_cast<uint8_t>(i);
+      raw[i * 2 + 1] = static_cast<uint8_t>(i >> 8);
+    }
+    checkRowConversion(PixelFormatIDs::RGB565_LE, raw, rgba);
+    checkRowConversion(PixelFormatIDs::RGB565_BE, raw, rgba);
+  }
+
+  SUBCASE("RGB888 / BGR888") {
+    std::vector<uint8_t> raw(rgba.begin(), rgba.begin() + 4096 * 3);
+    checkRowConversion(PixelFormatIDs::RGB888, raw, rgba);
+    checkRowConversion(PixelFormatIDs::BGR888, raw, rgba);
+  }
+}
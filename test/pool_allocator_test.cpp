@@ -0,0 +1,222 @@
+// fleximg Pool Allocator Tests
+// プールアロケータのテスト
+
+#include "doctest.h"
+
+#define FLEXIMG_NAMESPACE fleximg
+#include "fleximg/core/common.h"
+#include "fleximg/core/memory/pool_allocator.h"
+#include "fleximg/image/image_buffer.h"
+#include "fleximg/nodes/renderer_node.h"
+#include "fleximg/nodes/sink_node.h"
+#include "fleximg/nodes/source_node.h"
+
+#include <cstring>
+#include <set>
+#include <vector>
+
+using namespace fleximg;
+using core::memory::PoolAllocator;
+using core::memory::PoolAllocatorAdapter;
+using core::memory::SizeClassPoolAllocator;
+
+using SizeClassConfig = SizeClassPoolAllocator::SizeClassConfig;
+
+// =============================================================================
+// PoolAllocator Tests
+// =============================================================================
+
+TEST_CASE("PoolAllocator: single and multi-block allocation") {
+  alignas(16) static uint8_t memory[64 * 8];
+  PoolAllocator pool;
+  REQUIRE(pool.initialize(memory, 64, 8));
+  CHECK_FALSE(pool.initialize(memory, 64, 8)); // 二重初期化
+
+  void *a = pool.allocate(10);
+  void *b = pool.allocate(200); // 4ブロック連続
+  REQUIRE(a != nullptr);
+  REQUIRE(b != nullptr);
+  CHECK(pool.usedBlockCount() == 5);
+
+  CHECK(pool.deallocate(b));
+  CHECK_FALSE(pool.deallocate(b)); // 二重解放
+  CHECK(pool.deallocate(a));
+  CHECK(pool.usedBlockCount() == 0);
+
+  PoolAllocator tooMany;
+  CHECK_FALSE(tooMany.initialize(memory, 8, 33)); // 32ブロック上限
+}
+
+// =============================================================================
+// SizeClassPoolAllocator Tests
+// =============================================================================
+
+TEST_CASE("SizeClassPoolAllocator: initialize validates configuration") {
+  alignas(16) static uint8_t memory[4096];
+  SizeClassPoolAllocator pool;
+
+  const SizeClassConfig unsorted[] = {{256, 4}, {64, 4}};
+  CHECK_FALSE(pool.initialize(memory, unsorted, 2));
+
+  const SizeClassConfig tooMany[] = {
+      {16, SizeClassPoolAllocator::kMaxBlocksPerClass + 1}};
+  CHECK_FALSE(pool.initialize(memory, tooMany, 1));
+
+  // ブロックサイズはkBlockAlignに切り上げ
+  const SizeClassConfig classes[] = {{10, 4}, {100, 4}};
+  CHECK(SizeClassPoolAllocator::requiredMemory(classes, 2) == 16 * 4 + 112 * 4);
+  REQUIRE(pool.initialize(memory, classes, 2));
+  CHECK(pool.sizeClassCount() == 2);
+  CHECK(pool.blockSize(0) == 16);
+  CHECK(pool.blockSize(1) == 112);
+  CHECK(pool.blockCount() == 8);
+  CHECK_FALSE(pool.initialize(memory, classes, 2)); // 二重初期化
+}
+
+TEST_CASE("SizeClassPoolAllocator: picks smallest fitting class and spills") {
+  const SizeClassConfig classes[] = {{64, 2}, {256, 2}, {1024, 1}};
+  std::vector<uint8_t> memory(
+      SizeClassPoolAllocator::requiredMemory(classes, 3) + 16);
+  void *aligned = reinterpret_cast<void *>(
+      (reinterpret_cast<uintptr_t>(memory.data()) + 15) & ~uintptr_t(15));
+
+  SizeClassPoolAllocator pool;
+  REQUIRE(pool.initialize(aligned, classes, 3));
+  auto *base = static_cast<uint8_t *>(aligned);
+  uint8_t *class1 = base + 64 * 2;
+  uint8_t *class2 = class1 + 256 * 2;
+
+  void *a = pool.allocate(40);
+  void *b = pool.allocate(64);
+  CHECK(a == base);
+  CHECK(b == base + 64);
+
+  // 最小クラスが満杯: 次のクラスへ
+  void *c = pool.allocate(8);
+  CHECK(c == class1);
+  void *d = pool.allocate(200);
+  CHECK(d == class1 + 256);
+  void *e = pool.allocate(100);
+  CHECK(e == class2);
+
+  CHECK(pool.allocate(1) == nullptr); // 全クラス満杯
+  CHECK(pool.usedBlockCount() == 5);
+
+  CHECK(pool.deallocate(b));
+  CHECK(pool.allocate(1) == b); // 解放したブロックを再利用
+
+  CHECK(pool.allocate(2000) == nullptr); // 最大クラス超過
+
+  // プール外・ブロック途中・二重解放は拒否
+  int outside = 0;
+  CHECK_FALSE(pool.deallocate(&outside));
+  CHECK_FALSE(pool.deallocate(class1 + 1));
+  CHECK(pool.deallocate(e));
+  CHECK_FALSE(pool.deallocate(e));
+}
+
+TEST_CASE("SizeClassPoolAllocator: many blocks beyond 32-bit bitmap") {
+  const size_t count = 1000;
+  const SizeClassConfig classes[] = {{32, count}};
+  std::vector<uint8_t> memory(
+      SizeClassPoolAllocator::requiredMemory(classes, 1) + 16);
+  void *aligned = reinterpret_cast<void *>(
+      (reinterpret_cast<uintptr_t>(memory.data()) + 15) & ~uintptr_t(15));
+
+  SizeClassPoolAllocator pool;
+  REQUIRE(pool.initialize(aligned, classes, 1));
+
+  std::vector<void *> ptrs;
+  std::set<void *> unique;
+  for (size_t i = 0; i < count; ++i) {
+    void *p = pool.allocate(32);
+    REQUIRE(p != nullptr);
+    CHECK(reinterpret_cast<uintptr_t>(p) % 16 == 0);
+    ptrs.push_back(p);
+    unique.insert(p);
+  }
+  CHECK(unique.size() == count);
+  CHECK(pool.allocate(32) == nullptr);
+  CHECK(pool.freeBlockCount() == 0);
+
+  // 飛び飛びに解放し、同じブロックが再取得できること
+  for (size_t i = 0; i < count; i += 7) {
+    CHECK(pool.deallocate(ptrs[i]));
+  }
+  std::set<void *> reacquired;
+  for (size_t i = 0; i < count; i += 7) {
+    reacquired.insert(pool.allocate(1));
+  }
+  for (size_t i = 0; i < count; i += 7) {
+    CHECK(reacquired.count(ptrs[i]) == 1);
+  }
+  CHECK(pool.freeBlockCount() == 0);
+}
+
+// =============================================================================
+// PoolAllocatorAdapter Tests
+// =============================================================================
+
+TEST_CASE("PoolAllocatorAdapter: size-class pool with fallback") {
+  const SizeClassConfig classes[] = {{128, 4}, {1024, 4}};
+  alignas(16) static uint8_t memory[128 * 4 + 1024 * 4];
+  SizeClassPoolAllocator pool;
+  REQUIRE(pool.initialize(memory, classes, 2));
+
+  PoolAllocatorAdapter adapter(pool);
+  void *small = adapter.allocate(100);
+  void *large = adapter.allocate(8192); // フォールバック
+  REQUIRE(small != nullptr);
+  REQUIRE(large != nullptr);
+  CHECK(small == memory);
+  CHECK(pool.usedBlockCount() == 1);
+  adapter.deallocate(small);
+  adapter.deallocate(large);
+  CHECK(pool.usedBlockCount() == 0);
+
+  PoolAllocatorAdapter strict(pool, false);
+  CHECK(strict.allocate(8192) == nullptr);
+}
+
+TEST_CASE("PoolAllocatorAdapter: rendering through size-class pool") {
+  const int size = 80;
+  ImageBuffer img(48, 48, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < 48; y++) {
+    auto *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int x = 0; x < 48; x++) {
+      row[x * 4 + 0] = static_cast<uint8_t>(x * 5);
+      row[x * 4 + 1] = static_cast<uint8_t>(y * 5);
+      row[x * 4 + 2] = static_cast<uint8_t>(x ^ y);
+      row[x * 4 + 3] = 255;
+    }
+  }
+
+  auto render = [&](ImageBuffer &dst, core::memory::IAllocator *alloc) {
+    int_fixed center = float_to_fixed(size / 2.0f);
+    SourceNode src(img.view(), float_to_fixed(24.0f), float_to_fixed(24.0f));
+    src.setRotation(0.5f);
+    RendererNode renderer;
+    SinkNode sink(dst.view(), center, center);
+    src >> renderer >> sink;
+    renderer.setVirtualScreen(size, size);
+    renderer.setPivotCenter();
+    renderer.setAllocator(alloc);
+    renderer.exec();
+  };
+
+  ImageBuffer ref(size, size, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  render(ref, nullptr);
+
+  const SizeClassConfig classes[] = {{256, 64}, {1024, 64}};
+  alignas(16) static uint8_t memory[256 * 64 + 1024 * 64];
+  SizeClassPoolAllocator pool;
+  REQUIRE(pool.initialize(memory, classes, 2));
+  PoolAllocatorAdapter adapter(pool, false);
+
+  ImageBuffer dst(size, size, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  render(dst, &adapter);
+  CHECK(pool.usedBlockCount() == 0);
+  for (int y = 0; y < size; y++) {
+    CHECK(std::memcmp(ref.pixelAt(0, y), dst.pixelAt(0, y), size * 4) == 0);
+  }
+}
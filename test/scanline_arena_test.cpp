@@ -0,0 +1,281 @@
+// fleximg ScanlineArenaAllocator Tests
+// スキャンラインアリーナのテスト
+
+#include "doctest.h"
+
+#define FLEXIMG_NAMESPACE fleximg
+#include "fleximg/core/common.h"
+#include "fleximg/core/memory/scanline_arena.h"
+#include "fleximg/core/thread_pool_executor.h"
+#include "fleximg/core/types.h"
+#include "fleximg/image/image_buffer.h"
+#include "fleximg/nodes/composite_node.h"
+#include "fleximg/nodes/gaussian_blur_node.h"
+#include "fleximg/nodes/horizontal_blur_node.h"
+#include "fleximg/nodes/renderer_node.h"
+#include "fleximg/nodes/sink_node.h"
+#include "fleximg/nodes/source_node.h"
+#include "fleximg/nodes/vertical_blur_node.h"
+
+#include <cstring>
+
+using namespace fleximg;
+using core::memory::DefaultAllocator;
+using core::memory::IAllocator;
+using core::memory::ScanlineArenaAllocator;
+
+// =============================================================================
+// Helper Functions
+// =============================================================================
+
+// 確保回数を数えるアロケータ（DefaultAllocatorへ委譲）
+class CountingAllocator : public IAllocator {
+public:
+  int allocations = 0;
+  int deallocations = 0;
+
+  void *allocate(size_t bytes, size_t alignment = 16) override {
+    allocations++;
+    return DefaultAllocator::instance().allocate(bytes, alignment);
+  }
+  void deallocate(void *ptr) override {
+    if (ptr)
+      deallocations++;
+    DefaultAllocator::instance().deallocate(ptr);
+  }
+  const char *name() const override { return "CountingAllocator"; }
+};
+
+static ImageBuffer createPatternImage(int width, int height, uint8_t seed) {
+  ImageBuffer img(width, height, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int x = 0; x < width; x++) {
+      row[x * 4 + 0] = static_cast<uint8_t>(x * 7 + seed);
+      row[x * 4 + 1] = static_cast<uint8_t>(y * 5 + seed);
+      row[x * 4 + 2] = static_cast<uint8_t>((x ^ y) + seed);
+      row[x * 4 + 3] = static_cast<uint8_t>(128 + ((x + y) & 127));
+    }
+  }
+  return img;
+}
+
+static bool sameBytes(const ImageBuffer &a, const ImageBuffer &b) {
+  if (a.width() != b.width() || a.height() != b.height())
+    return false;
+  for (int y = 0; y < a.height(); y++) {
+    if (std::memcmp(a.pixelAt(0, y), b.pixelAt(0, y),
+                    static_cast<size_t>(a.width()) * 4) != 0)
+      return false;
+  }
+  return true;
+}
+
+// =============================================================================
+// ScanlineArenaAllocator Tests
+// =============================================================================
+
+TEST_CASE("ScanlineArenaAllocator: bump allocation and alignment") {
+  CountingAllocator backing;
+  ScanlineArenaAllocator arena(&backing);
+
+  void *a = arena.allocate(3, 1);
+  void *b = arena.allocate(100, 16);
+  void *c = arena.allocate(8, 64);
+  REQUIRE(a != nullptr);
+  REQUIRE(b != nullptr);
+  REQUIRE(c != nullptr);
+  CHECK(reinterpret_cast<uintptr_t>(b) % 16 == 0);
+  CHECK(reinterpret_cast<uintptr_t>(c) % 64 == 0);
+  CHECK(static_cast<uint8_t *>(b) >= static_cast<uint8_t *>(a) + 3);
+  CHECK(arena.liveCount() == 3);
+  CHECK(backing.allocations == 1);
+
+  CHECK(arena.allocate(0) == nullptr);
+
+  arena.deallocate(a);
+  arena.deallocate(b);
+  arena.deallocate(c);
+  CHECK(arena.liveCount() == 0);
+  CHECK(arena.reset());
+  CHECK(arena.used() == 0);
+
+  // 巻き戻し後は同じ領域を再利用
+  CHECK(arena.allocate(3, 1) == a);
+  arena.deallocate(a);
+  arena.reset();
+  CHECK(backing.allocations == 1);
+}
+
+TEST_CASE("ScanlineArenaAllocator: overflow chunks are merged on reset") {
+  CountingAllocator backing;
+  ScanlineArenaAllocator arena(&backing);
+
+  // 初期チャンクを超える確保で追加チャンクが発生
+  void *ptrs[8];
+  for (auto &p : ptrs) {
+    p = arena.allocate(3000);
+    REQUIRE(p != nullptr);
+    std::memset(p, 0xAB, 3000);
+  }
+  CHECK(backing.allocations > 1);
+  size_t highWater = arena.highWater();
+  CHECK(highWater >= 8 * 3000);
+
+  for (auto &p : ptrs)
+    arena.deallocate(p);
+  CHECK(arena.reset());
+  CHECK(arena.capacity() >= highWater);
+
+  // 統合後は同じ使用パターンで上位アロケータを呼ばない
+  int before = backing.allocations;
+  for (int round = 0; round < 3; round++) {
+    for (auto &p : ptrs)
+      p = arena.allocate(3000);
+    for (auto &p : ptrs)
+      arena.deallocate(p);
+    CHECK(arena.reset());
+  }
+  CHECK(backing.allocations == before);
+
+  arena.release();
+  CHECK(arena.capacity() == 0);
+  CHECK(backing.allocations == backing.deallocations);
+}
+
+TEST_CASE("ScanlineArenaAllocator: reset keeps live allocations intact") {
+  ScanlineArenaAllocator arena;
+  auto *p = static_cast<uint8_t *>(arena.allocate(64));
+  REQUIRE(p != nullptr);
+  std::memset(p, 0x5A, 64);
+
+  // 使用中の確保が残っている場合は巻き戻さない
+  CHECK_FALSE(arena.reset());
+  auto *q = static_cast<uint8_t *>(arena.allocate(64));
+  REQUIRE(q != nullptr);
+  std::memset(q, 0x00, 64);
+  CHECK(p[0] == 0x5A);
+  CHECK(p[63] == 0x5A);
+
+  arena.deallocate(p);
+  arena.deallocate(q);
+  CHECK(arena.reset());
+}
+
+// =============================================================================
+// RendererNode Integration Tests
+// =============================================================================
+
+// 回転ソース + ブラー（水平・ガウス・垂直）+ 合成のシーン
+struct BlurCompositeScene {
+  static constexpr int kSize = 96;
+  SourceNode src1;
+  SourceNode src2;
+  HorizontalBlurNode hblur;
+  GaussianBlurNode gblur;
+  VerticalBlurNode vblur;
+  CompositeNode composite{2};
+  RendererNode renderer;
+  SinkNode sink;
+
+  BlurCompositeScene(ImageBuffer &dst, const ImageBuffer &img1,
+                     const ImageBuffer &img2) {
+    int_fixed center = float_to_fixed(kSize / 2.0f);
+    src1.setSource(img1.view());
+    src1.setPivot(center, center);
+    src1.setRotation(0.4f);
+    src2.setSource(img2.view());
+    src2.setPivot(float_to_fixed(20.0f), float_to_fixed(20.0f));
+    src2.setInterpolationMode(InterpolationMode::Bilinear);
+    src2.setRotationScale(-0.7f, 1.5f, 1.2f);
+    hblur.setRadius(2);
+    gblur.setSigma(1.5f);
+    vblur.setRadius(3);
+    vblur.setPasses(2);
+    sink.setTarget(dst.view());
+    sink.setPivot(center, center);
+
+    src1 >> hblur >> gblur >> composite;
+    src2 >> vblur;
+    vblur.connectTo(composite, 1);
+    composite >> renderer >> sink;
+
+    renderer.setVirtualScreen(kSize, kSize);
+    renderer.setPivotCenter();
+  }
+};
+
+TEST_CASE("ScanlineArena: rendering matches default allocator") {
+  ImageBuffer img1 = createPatternImage(64, 64, 11);
+  ImageBuffer img2 = createPatternImage(40, 40, 97);
+
+  ImageBuffer ref(96, 96, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  {
+    BlurCompositeScene scene(ref, img1, img2);
+    CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  }
+
+  ImageBuffer dst(96, 96, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  BlurCompositeScene scene(dst, img1, img2);
+  scene.renderer.setScanlineArenaEnabled(true);
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  CHECK(sameBytes(ref, dst));
+  CHECK(scene.renderer.scanlineArena().highWater() > 0);
+  CHECK(scene.renderer.scanlineArena().liveCount() == 0);
+}
+
+TEST_CASE("ScanlineArena: steady-state exec makes no scanline allocations") {
+  ImageBuffer img1 = createPatternImage(64, 64, 11);
+  ImageBuffer img2 = createPatternImage(40, 40, 97);
+  ImageBuffer dst(96, 96, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  // アロケータはシーン（アリーナ・行キャッシュ）より長く生存させる
+  CountingAllocator withoutArena;
+  CountingAllocator backing;
+  BlurCompositeScene scene(dst, img1, img2);
+
+  // アリーナなし: スキャンラインごとにアロケータを呼ぶ
+  scene.renderer.setAllocator(&withoutArena);
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  CHECK(withoutArena.allocations > BlurCompositeScene::kSize);
+
+  scene.renderer.setAllocator(&backing);
+  scene.renderer.setScanlineArenaEnabled(true);
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);  // ウォームアップ
+  CHECK(scene.renderer.scanlineArena().chunkAllocations() >= 1);
+
+  // 定常状態で残るのはスキャンラインを跨ぐバッファ（VerticalBlurNodeの行キャッシュ）のみ
+  backing.allocations = 0;
+#ifdef FLEXIMG_TRAP_DEFAULT_ALLOCATOR
+  // 指定アロケータを迂回した DefaultAllocator の使用もない
+  // （CountingAllocator は DefaultAllocator に委譲するため、その分だけ計数される）
+  DefaultAllocator::allocationCount() = 0;
+#endif
+  CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+  CHECK(backing.allocations == scene.vblur.passes() * scene.vblur.kernelSize());
+#ifdef FLEXIMG_TRAP_DEFAULT_ALLOCATOR
+  CHECK(DefaultAllocator::allocationCount().load() ==
+        static_cast<uint32_t>(backing.allocations));
+#endif
+}
+
+TEST_CASE("ScanlineArena: each band worker uses its own arena") {
+  ImageBuffer img1 = createPatternImage(64, 64, 11);
+  ImageBuffer img2 = createPatternImage(40, 40, 97);
+
+  ImageBuffer ref(96, 96, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  {
+    BlurCompositeScene scene(ref, img1, img2);
+    scene.renderer.exec();
+  }
+
+  ThreadPoolExecutor executor(3);
+  ImageBuffer dst(96, 96, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  BlurCompositeScene scene(dst, img1, img2);
+  scene.renderer.setScanlineArenaEnabled(true);
+  scene.renderer.setParallelExecutor(&executor);
+  for (int i = 0; i < 3; i++) {
+    CHECK(scene.renderer.exec() == PrepareStatus::Prepared);
+    CHECK(scene.renderer.lastBandCount() == 3);
+    CHECK(sameBytes(ref, dst));
+  }
+}
@@ -9,11 +9,13 @@
 #include "fleximg/image/image_buffer.h"
 #include "fleximg/image/render_types.h"
 #include "fleximg/nodes/affine_node.h"
+#include "fleximg/nodes/composite_node.h"
 #include "fleximg/nodes/renderer_node.h"
 #include "fleximg/nodes/sink_node.h"
 #include "fleximg/nodes/source_node.h"
 
 #include <cmath>
+#include <cstring>
 #include <vector>
 
 using namespace fleximg;
@@ -172,6 +174,325 @@ TEST_CASE("Scanline: tiled vs non-tiled consistency") {
   CHECK(hasNonZeroPixels(dstImg2.view()));
 }
 
+// =============================================================================
+// Row Span Table Tests
+// =============================================================================
+
+// 行範囲テーブルの参照結果が直接計算と一致することを検証
+TEST_CASE("Scanline: row span table matches direct range calculation") {
+  const int imgSize = 37;
+  const int canvasSize = 120;
+  ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 10, 20, 30);
+
+  const float angles[] = {0.0f, 17.0f, 45.0f, 90.0f, 135.0f, 200.0f, 301.0f};
+  const float scales[] = {0.7f, 1.0f, 2.3f};
+  for (float angleDeg : angles) {
+    for (float scale : scales) {
+      for (int bilinear = 0; bilinear < 2; ++bilinear) {
+        SourceNode withTable(srcImg.view(), float_to_fixed(15.25f),
+                             float_to_fixed(20.5f));
+        SourceNode direct(srcImg.view(), float_to_fixed(15.25f),
+                          float_to_fixed(20.5f));
+        direct.setRowSpanTableEnabled(false);
+        for (SourceNode *src : {&withTable, &direct}) {
+          src->setRotation(angleDeg * static_cast<float>(M_PI) / 180.0f);
+          src->setScale(scale, scale * 0.8f);
+          src->setTranslation(3.5f, -2.25f);
+          if (bilinear) {
+            src->setInterpolationMode(InterpolationMode::Bilinear);
+          }
+
+          PrepareRequest prepReq;
+          prepReq.width = static_cast<int16_t>(canvasSize);
+          prepReq.height = static_cast<int16_t>(canvasSize);
+          prepReq.origin.x = float_to_fixed(-60.0f);
+          prepReq.origin.y = float_to_fixed(-60.0f);
+          CHECK(src->pullPrepare(prepReq).ok());
+        }
+
+        // スクリーン外の行・タイル位置（deltaX）・幅を変えて比較
+        int mismatchCount = 0;
+        for (int y = -8; y < canvasSize + 8; y++) {
+          for (int x : {-13, 0, 7, 40, 101}) {
+            for (int width : {canvasSize, 16, 1}) {
+              RenderRequest req;
+              req.width = static_cast<int16_t>(width);
+              req.height = 1;
+              req.origin.x = float_to_fixed(-60.0f) + to_fixed(x);
+              req.origin.y = float_to_fixed(-60.0f) + to_fixed(y);
+              DataRange a = withTable.getDataRange(req);
+              DataRange b = direct.getDataRange(req);
+              if (a.hasData() != b.hasData() ||
+                  (a.hasData() &&
+                   (a.startX != b.startX || a.endX != b.endX))) {
+                mismatchCount++;
+              }
+            }
+          }
+        }
+        CAPTURE(angleDeg);
+        CAPTURE(scale);
+        CAPTURE(bilinear);
+        CHECK(mismatchCount == 0);
+      }
+    }
+  }
+}
+
+// 行範囲テーブルの有無で描画結果が一致することを検証（タイル分割あり）
+TEST_CASE("Scanline: row span table does not change rendering") {
+  const int imgSize = 40;
+  const int canvasSize = 100;
+  ImageBuffer srcImg = createSolidImage(imgSize, imgSize, 200, 100, 50);
+
+  ImageBuffer dst[2] = {
+      ImageBuffer(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero),
+      ImageBuffer(canvasSize, canvasSize, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero)};
+  for (int i = 0; i < 2; i++) {
+    SourceNode src(srcImg.view(), float_to_fixed(imgSize / 2.0f),
+                   float_to_fixed(imgSize / 2.0f));
+    src.setRowSpanTableEnabled(i == 0);
+    src.setRotation(33.0f * static_cast<float>(M_PI) / 180.0f);
+    src.setScale(1.7f, 1.7f);
+    RendererNode renderer;
+    SinkNode sink(dst[i].view(), float_to_fixed(canvasSize / 2.0f),
+                  float_to_fixed(canvasSize / 2.0f));
+    src >> renderer >> sink;
+    renderer.setVirtualScreen(canvasSize, canvasSize);
+    renderer.setPivotCenter();
+    renderer.setTileConfig(23, 17);
+    renderer.exec();
+  }
+
+  CHECK(hasNonZeroPixels(dst[0].view()));
+  CHECK(std::memcmp(dst[0].data(), dst[1].data(),
+                    static_cast<size_t>(canvasSize * canvasSize * 4)) == 0);
+}
+
+// =============================================================================
+// Alpha Trim Tests
+// =============================================================================
+
+// 円形スプライト（円の外は透明、内側は位置で色と半透明が変わる）
+static ImageBuffer createCircleImage(int size) {
+  ImageBuffer img(size, size, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  float r = static_cast<float>(size) * 0.4f;
+  float c = static_cast<float>(size) * 0.5f;
+  for (int y = 0; y < size; y++) {
+    uint8_t *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int x = 0; x < size; x++) {
+      float dx = static_cast<float>(x) + 0.5f - c;
+      float dy = static_cast<float>(y) + 0.5f - c;
+      if (dx * dx + dy * dy < r * r) {
+        row[x * 4 + 0] = static_cast<uint8_t>(x * 7);
+        row[x * 4 + 1] = static_cast<uint8_t>(y * 5);
+        row[x * 4 + 2] = 90;
+        row[x * 4 + 3] = ((x + y) & 3) ? 255 : 120;
+      }
+    }
+  }
+  return img;
+}
+
+// 背景の上にスプライトを合成した結果（トリミング有無の比較用）
+struct TrimScene {
+  int canvasSize;
+  ImageBuffer bgImg;
+  ImageBuffer dstImg;
+  SourceNode background;
+  SourceNode sprite;
+  CompositeNode composite{2};
+  RendererNode renderer;
+  SinkNode sink;
+
+  TrimScene(const ImageBuffer &spriteImg, int canvas, bool trim)
+      : canvasSize(canvas),
+        bgImg(createSolidImage(canvas, canvas, 30, 60, 90)),
+        dstImg(canvas, canvas, PixelFormatIDs::RGBA8_Straight,
+               InitPolicy::Zero),
+        sink(dstImg.view()) {
+    background.setSource(bgImg.view());
+    sprite.setSource(spriteImg.view());
+    sprite.setPivot(float_to_fixed(spriteImg.width() / 2.0f),
+                    float_to_fixed(spriteImg.height() / 2.0f));
+    sprite.setAlphaTrimEnabled(trim);
+    sprite.connectTo(composite, 0);  // 最前面
+    background.connectTo(composite, 1);
+    composite >> renderer >> sink;
+    renderer.setVirtualScreen(canvas, canvas);
+  }
+};
+
+TEST_CASE("Scanline: alpha trim keeps rendering identical") {
+  const int canvasSize = 96;
+  ImageBuffer spriteImg = createCircleImage(40);
+
+  struct Transform {
+    const char *name;
+    float angleDeg;
+    float scaleX;
+    float scaleY;
+  };
+  const Transform transforms[] = {
+      {"translation", 0.0f, 1.0f, 1.0f},  {"scale", 0.0f, 1.7f, 0.6f},
+      {"flip", 0.0f, -1.0f, 1.3f},        {"rotation", 30.0f, 1.0f, 1.0f},
+      {"rotation+scale", 200.0f, 1.4f, 0.8f},
+  };
+  for (const Transform &t : transforms) {
+    for (int tiled = 0; tiled < 2; ++tiled) {
+      TrimScene trimmed(spriteImg, canvasSize, true);
+      TrimScene trimmedNoTable(spriteImg, canvasSize, true);
+      TrimScene reference(spriteImg, canvasSize, false);
+      trimmedNoTable.sprite.setRowSpanTableEnabled(false);
+      for (TrimScene *scene : {&trimmed, &trimmedNoTable, &reference}) {
+        scene->sprite.setRotation(t.angleDeg * static_cast<float>(M_PI) /
+                                  180.0f);
+        scene->sprite.setScale(t.scaleX, t.scaleY);
+        scene->sprite.setTranslation(47.25f, 45.5f);
+        if (tiled) {
+          scene->renderer.setTileConfig(19, 13);
+        }
+        scene->renderer.exec();
+      }
+      CAPTURE(t.name);
+      CAPTURE(tiled);
+      const size_t bytes = static_cast<size_t>(canvasSize * canvasSize * 4);
+      CHECK(std::memcmp(trimmed.dstImg.data(), reference.dstImg.data(),
+                        bytes) == 0);
+      CHECK(std::memcmp(trimmedNoTable.dstImg.data(), reference.dstImg.data(),
+                        bytes) == 0);
+    }
+  }
+}
+
+TEST_CASE("Scanline: alpha trim narrows data range") {
+  ImageBuffer spriteImg = createCircleImage(40);
+  const int canvasSize = 96;
+
+  SUBCASE("translation: per-row range") {
+    TrimScene scene(spriteImg, canvasSize, true);
+    scene.sprite.setTranslation(20.0f, 20.0f);
+    scene.renderer.exec();
+
+    // 円の中心行（ソース行20）と上端付近（ソース行5）
+    RenderRequest req;
+    req.width = static_cast<int16_t>(canvasSize);
+    req.height = 1;
+    req.origin.y = to_fixed(20);
+    DataRange center = scene.sprite.getDataRange(req);
+    req.origin.y = to_fixed(5);
+    DataRange top = scene.sprite.getDataRange(req);
+    CHECK(center.hasData());
+    CHECK(top.hasData());
+    CHECK(center.width() < 40);
+    CHECK(top.width() < center.width());
+
+    // 円の外の行（ソース行0）はデータなし
+    req.origin.y = to_fixed(0);
+    CHECK_FALSE(scene.sprite.getDataRange(req).hasData());
+  }
+
+  SUBCASE("scale: per-row range") {
+    TrimScene scene(spriteImg, canvasSize, true);
+    scene.sprite.setScale(2.0f, 2.0f);
+    scene.sprite.setTranslation(48.0f, 48.0f);
+    scene.renderer.exec();
+
+    RenderRequest req;
+    req.width = static_cast<int16_t>(canvasSize);
+    req.height = 1;
+    req.origin.y = to_fixed(48);
+    DataRange center = scene.sprite.getDataRange(req);
+    req.origin.y = to_fixed(48 - 30);
+    DataRange upper = scene.sprite.getDataRange(req);
+    CHECK(center.width() <= 66);
+    CHECK(upper.hasData());
+    CHECK(upper.width() < center.width());
+  }
+
+  SUBCASE("fully transparent image has no data") {
+    ImageBuffer emptyImg(16, 16, PixelFormatIDs::RGBA8_Straight,
+                         InitPolicy::Zero);
+    TrimScene scene(emptyImg, canvasSize, true);
+    scene.sprite.setTranslation(20.0f, 20.0f);
+    scene.renderer.exec();
+
+    RenderRequest req;
+    req.width = static_cast<int16_t>(canvasSize);
+    req.height = 1;
+    req.origin.y = to_fixed(20);
+    CHECK_FALSE(scene.sprite.getDataRange(req).hasData());
+  }
+}
+
+TEST_CASE("Scanline: alpha trim leaves margins untouched in strip mode") {
+  // シンクへ直接出力: トリミングされた余白の既存ピクセルは書き換えない
+  ImageBuffer spriteImg = createCircleImage(40);
+  const int canvasSize = 64;
+
+  auto render = [&](ImageBuffer &dst, bool trim, int stripHeight) {
+    SourceNode sprite(spriteImg.view(), float_to_fixed(20.0f),
+                      float_to_fixed(20.0f));
+    sprite.setAlphaTrimEnabled(trim);
+    sprite.setTranslation(32.0f, 32.0f);
+    RendererNode renderer;
+    SinkNode sink(dst.view());
+    sprite >> renderer >> sink;
+    renderer.setVirtualScreen(canvasSize, canvasSize);
+    renderer.setStripHeight(static_cast<int_fast16_t>(stripHeight));
+    renderer.exec();
+    return renderer.activeStripHeight();
+  };
+  auto makeCanvas = [&]() {
+    return createSolidImage(canvasSize, canvasSize, 30, 60, 90);
+  };
+
+  ImageBuffer ref = makeCanvas();
+  CHECK(render(ref, true, 1) == 1);
+  ImageBuffer strip = makeCanvas();
+  CHECK(render(strip, true, 8) == 1);
+  CHECK(std::memcmp(ref.data(), strip.data(), ref.totalBytes()) == 0);
+
+  // 余白には背景が残る（トリミングなしは透明ピクセルを書き込む）
+  ImageBuffer untrimmed = makeCanvas();
+  CHECK(render(untrimmed, false, 8) == 8);
+  CHECK(std::memcmp(ref.data(), untrimmed.data(), ref.totalBytes()) != 0);
+}
+
+TEST_CASE("Scanline: alpha trim uses palette alpha") {
+  // Index8: 0 = 透明、1 = 不透明赤（左右2列ずつ透明）
+  const uint8_t palette[2 * 4] = {0, 0, 0, 0, 255, 0, 0, 255};
+  ImageBuffer indexImg(8, 4, PixelFormatIDs::Index8, InitPolicy::Zero);
+  for (int y = 0; y < 4; y++) {
+    uint8_t *row = static_cast<uint8_t *>(indexImg.pixelAt(0, y));
+    for (int x = 2; x < 6; x++) {
+      row[x] = 1;
+    }
+  }
+
+  SourceNode src;
+  src.setSource(indexImg.view(),
+                PaletteData(palette, PixelFormatIDs::RGBA8_Straight, 2));
+  src.setAlphaTrimEnabled(true);
+
+  PrepareRequest prepReq;
+  prepReq.width = 32;
+  prepReq.height = 32;
+  PrepareResponse prepResult = src.pullPrepare(prepReq);
+  CHECK(prepResult.ok());
+  CHECK(prepResult.width == 4);
+
+  RenderRequest req;
+  req.width = 32;
+  req.height = 1;
+  req.origin.y = to_fixed(1);
+  DataRange range = src.getDataRange(req);
+  CHECK(range.startX == 2);
+  CHECK(range.endX == 6);
+}
+
 // =============================================================================
 // Non-affine / Affine Path Consistency Tests（ピクセル中心モデル検証）
 // =============================================================================
@@ -389,3 +710,793 @@ TEST_CASE("Scanline: position smoothness consistency") {
     CHECK(mismatchCount == 0);
   }
 }
+
+// =============================================================================
+// Area Interpolation Tests
+// =============================================================================
+
+// 乱数の模様 + 左上の透明な区間
+static ImageBuffer createAreaTestImage(int width, int height, uint32_t seed) {
+  ImageBuffer img(width, height, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int i = 0; i < width * 4; i++) {
+      seed = seed * 1103515245u + 12345u;
+      row[i] = static_cast<uint8_t>(seed >> 24);
+    }
+    if (y < height / 3) {
+      for (int x = 0; x < width / 4; x++) row[x * 4 + 3] = 0;
+    }
+  }
+  return img;
+}
+
+// 面積平均の参照実装（ソース座標の矩形 [x0, x0 + sx) x [y0, y0 + sy)、
+// 重なり面積で重み付けしたα加重平均。ソース外は透明）
+static void areaReference(const ViewPort &src, double x0, double y0,
+                          double sx, double sy, double out[4]) {
+  double sum[4] = {0, 0, 0, 0};
+  for (int y = 0; y < src.height; y++) {
+    double wy = std::min(y + 1.0, y0 + sy) - std::max<double>(y, y0);
+    if (wy <= 0) continue;
+    for (int x = 0; x < src.width; x++) {
+      double wx = std::min(x + 1.0, x0 + sx) - std::max<double>(x, x0);
+      if (wx <= 0) continue;
+      const auto *p = static_cast<const uint8_t *>(src.pixelAt(x, y));
+      double w = wx * wy * p[3];
+      for (int c = 0; c < 3; c++) sum[c] += w * p[c];
+      sum[3] += w;
+    }
+  }
+  for (int c = 0; c < 3; c++) out[c] = sum[3] > 0 ? sum[c] / sum[3] : 0;
+  out[3] = sum[3] / (sx * sy);
+}
+
+// src（中心基準）を scale で縮小し、dst（中心基準）に描画
+static void renderArea(const ViewPort &srcView, ImageBuffer &dst, float scale,
+                       int tileSize, bool *usedArea = nullptr) {
+  SourceNode src(srcView, float_to_fixed(srcView.width / 2.0f),
+                 float_to_fixed(srcView.height / 2.0f));
+  src.setInterpolationMode(InterpolationMode::Area);
+  src.setScale(scale, scale);
+  RendererNode renderer;
+  SinkNode sink(dst.view(), float_to_fixed(dst.width() / 2.0f),
+                float_to_fixed(dst.height() / 2.0f));
+  src >> renderer >> sink;
+  renderer.setVirtualScreen(dst.width(), dst.height());
+  renderer.setPivotCenter();
+  if (tileSize > 0) renderer.setTileConfig(tileSize, tileSize);
+  renderer.exec();
+  if (usedArea) *usedArea = src.isAreaAveraging();
+}
+
+TEST_CASE("Scanline: area mode averages 2x2 blocks exactly") {
+  const int imgSize = 16;
+  ImageBuffer srcImg = createAreaTestImage(imgSize, imgSize, 11);
+  ViewPort srcView = srcImg.view();
+
+  ImageBuffer dst(8, 8, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  bool usedArea = false;
+  renderArea(srcView, dst, 0.5f, 0, &usedArea);
+  CHECK(usedArea);
+
+  // 整数倍の縮小は重みが均等（各ピクセル 128 x 128）なので整数演算と一致
+  int mismatches = 0;
+  for (int y = 0; y < 8; y++) {
+    for (int x = 0; x < 8; x++) {
+      uint32_t sum[4] = {0, 0, 0, 0};
+      for (int k = 0; k < 4; k++) {
+        const auto *p = static_cast<const uint8_t *>(
+            srcView.pixelAt(x * 2 + (k & 1), y * 2 + (k >> 1)));
+        for (int c = 0; c < 3; c++) sum[c] += static_cast<uint32_t>(p[c] * p[3]);
+        sum[3] += p[3];
+      }
+      const auto *d = static_cast<const uint8_t *>(dst.pixelAt(x, y));
+      uint8_t expected[4] = {0, 0, 0, 0};
+      if (sum[3] > 0) {
+        for (int c = 0; c < 3; c++)
+          expected[c] = static_cast<uint8_t>(sum[c] / sum[3]);
+        expected[3] = static_cast<uint8_t>(sum[3] / 4);
+      }
+      for (int c = 0; c < 4; c++) {
+        if (d[c] != expected[c]) mismatches++;
+      }
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+TEST_CASE("Scanline: area mode matches footprint reference") {
+  const int imgSize = 30;
+  ImageBuffer srcImg = createAreaTestImage(imgSize, imgSize, 29);
+  ViewPort srcView = srcImg.view();
+
+  // 縮小率 2.5（出力ピクセルの境界がソースピクセルの途中に来る）
+  const int dstSize = 12;
+  const double ratio = 2.5;
+  ImageBuffer dst(dstSize, dstSize, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  renderArea(srcView, dst, 0.4f, 0);
+
+  int maxDiff = 0;
+  for (int y = 0; y < dstSize; y++) {
+    for (int x = 0; x < dstSize; x++) {
+      double ref[4];
+      areaReference(srcView, x * ratio, y * ratio, ratio, ratio, ref);
+      const auto *d = static_cast<const uint8_t *>(dst.pixelAt(x, y));
+      for (int c = 0; c < 4; c++) {
+        if (c < 3 && ref[3] < 1.0) continue;  // ほぼ透明な色は比較しない
+        int diff = static_cast<int>(std::lround(std::fabs(d[c] - ref[c])));
+        maxDiff = std::max(maxDiff, diff);
+      }
+    }
+  }
+  CHECK(maxDiff <= 2);
+}
+
+TEST_CASE("Scanline: area mode is identical with tiles and formats") {
+  const int imgSize = 40;
+  ImageBuffer srcImg = createAreaTestImage(imgSize, imgSize, 3);
+  ImageBuffer dst1(13, 13, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  ImageBuffer dst2(13, 13, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  renderArea(srcImg.view(), dst1, 0.3f, 0);
+  renderArea(srcImg.view(), dst2, 0.3f, 5);  // 列テーブルの作り直し・行の再利用
+  CHECK(std::memcmp(dst1.data(), dst2.data(), dst1.totalBytes()) == 0);
+
+  // アルファなしフォーマット（RGBA8へ変換して平均）
+  ImageBuffer rgb(imgSize, imgSize, PixelFormatIDs::RGB888);
+  ImageBuffer rgba(imgSize, imgSize, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < imgSize; y++) {
+    auto *s = static_cast<const uint8_t *>(srcImg.pixelAt(0, y));
+    auto *d = static_cast<uint8_t *>(rgb.pixelAt(0, y));
+    auto *e = static_cast<uint8_t *>(rgba.pixelAt(0, y));
+    for (int x = 0; x < imgSize; x++) {
+      for (int c = 0; c < 3; c++) d[x * 3 + c] = e[x * 4 + c] = s[x * 4 + c];
+      e[x * 4 + 3] = 255;
+    }
+  }
+  ImageBuffer dstRgb(13, 13, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  ImageBuffer dstRgba(13, 13, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
+  renderArea(rgb.view(), dstRgb, 0.3f, 0);
+  renderArea(rgba.view(), dstRgba, 0.3f, 0);
+  CHECK(std::memcmp(dstRgb.data(), dstRgba.data(), dstRgb.totalBytes()) == 0);
+}
+
+TEST_CASE("Scanline: area mode falls back outside axis-aligned downscale") {
+  ImageBuffer srcImg = createAreaTestImage(16, 16, 7);
+  ImageBuffer dst(32, 32, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  bool usedArea = true;
+  renderArea(srcImg.view(), dst, 2.0f, 0, &usedArea);  // 拡大
+  CHECK_FALSE(usedArea);
+
+  // 回転はバイリニアと同じ結果
+  ImageBuffer dstArea(24, 24, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
+  ImageBuffer dstBilinear(24, 24, PixelFormatIDs::RGBA8_Straight,
+                          InitPolicy::Zero);
+  const InterpolationMode modes[] = {InterpolationMode::Area,
+                                     InterpolationMode::Bilinear};
+  ImageBuffer *outputs[] = {&dstArea, &dstBilinear};
+  for (int i = 0; i < 2; i++) {
+    SourceNode src(srcImg.view(), float_to_fixed(8.0f), float_to_fixed(8.0f));
+    src.setInterpolationMode(modes[i]);
+    src.setRotationScale(0.5f, 0.5f, 0.5f);
+    RendererNode renderer;
+    SinkNode sink(outputs[i]->view(), float_to_fixed(12.0f),
+                  float_to_fixed(12.0f));
+    src >> renderer >> sink;
+    renderer.setVirtualScreen(24, 24);
+    renderer.setPivotCenter();
+    renderer.exec();
+    CHECK_FALSE(src.isAreaAveraging());
+  }
+  CHECK(std::memcmp(dstArea.data(), dstBilinear.data(),
+                    dstArea.totalBytes()) == 0);
+}
+
+// =============================================================================
+// Mipmap Tests
+// =============================================================================
+
+// 2x2 のα加重平均で 1/2 に縮小（SourceNode のミップレベルと同じ整数演算）
+static ImageBuffer halveReference(const ImageBuffer &src) {
+  int w = (src.width() + 1) / 2, h = (src.height() + 1) / 2;
+  ImageBuffer dst(w, h, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      uint32_t sum[4] = {0, 0, 0, 0};
+      for (int k = 0; k < 4; k++) {
+        int sx = x * 2 + (k & 1), sy = y * 2 + (k >> 1);
+        if (sx >= src.width() || sy >= src.height()) continue;
+        const auto *p = static_cast<const uint8_t *>(src.pixelAt(sx, sy));
+        for (int c = 0; c < 3; c++) sum[c] += static_cast<uint32_t>(p[c] * p[3]);
+        sum[3] += p[3];
+      }
+      auto *d = static_cast<uint8_t *>(dst.pixelAt(x, y));
+      for (int c = 0; c < 3; c++)
+        d[c] = static_cast<uint8_t>(sum[3] ? sum[c] / sum[3] : 0);
+      d[3] = static_cast<uint8_t>(sum[3] / 4);
+    }
+  }
+  return dst;
+}
+
+struct MipScene {
+  SourceNode src;
+  RendererNode renderer;
+  SinkNode sink;
+
+  MipScene(const ViewPort &srcView, ImageBuffer &dst, MipmapMode mipmap,
+           InterpolationMode interp)
+      : src(srcView, float_to_fixed(srcView.width / 2.0f),
+            float_to_fixed(srcView.height / 2.0f)),
+        sink(dst.view(), float_to_fixed(dst.width() / 2.0f),
+             float_to_fixed(dst.height() / 2.0f)) {
+    src.setMipmapMode(mipmap);
+    src.setInterpolationMode(interp);
+    src >> renderer >> sink;
+    renderer.setVirtualScreen(dst.width(), dst.height());
+    renderer.setPivotCenter();
+  }
+};
+
+TEST_CASE("Scanline: mipmap selects level from inverse scale") {
+  ImageBuffer srcImg = createAreaTestImage(64, 64, 5);
+  ImageBuffer dst(32, 32, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  MipScene scene(srcImg.view(), dst, MipmapMode::Nearest,
+                 InterpolationMode::Nearest);
+
+  scene.src.setScale(1.0f, 1.0f);
+  scene.renderer.exec();
+  CHECK(scene.src.mipLevel() == 0);
+  CHECK(scene.src.mipLevelCount() == 0);  // 縮小しない間は作成しない
+
+  scene.src.setScale(0.25f, 0.25f);
+  scene.renderer.exec();
+  CHECK(scene.src.mipLevel() == 2);
+  CHECK(scene.src.mipLevelCount() == 2);
+
+  // 回転しても縮小率（列ベクトルの長さ）は変わらない
+  scene.src.setRotationScale(0.7f, 0.25f, 0.25f);
+  scene.renderer.exec();
+  CHECK(scene.src.mipLevel() == 2);
+
+  scene.src.setScale(0.3f, 0.3f);  // log2(3.33) = 1.74
+  scene.renderer.exec();
+  CHECK(scene.src.mipLevel() == 2);
+
+  // Linear（トリリニア）は端数側の次のレベルも作成
+  scene.src.setMipmapMode(MipmapMode::Linear);
+  scene.src.setInterpolationMode(InterpolationMode::Bilinear);
+  scene.src.setScale(0.1f, 0.1f);  // log2(10) = 3.32
+  scene.renderer.exec();
+  CHECK(scene.src.mipLevel() == 3);
+  CHECK(scene.src.mipLevelCount() == 4);
+
+  // 1x1 まで（64 -> 6 レベル）
+  scene.src.setScale(0.001f, 0.001f);
+  scene.renderer.exec();
+  CHECK(scene.src.mipLevel() == 6);
+  CHECK(scene.src.mipLevelCount() == 6);
+
+  scene.src.setMipmapMode(MipmapMode::None);
+  scene.renderer.exec();
+  CHECK(scene.src.mipLevel() == 0);
+  CHECK(scene.src.mipLevelCount() == 0);
+}
+
+TEST_CASE("Scanline: mipmap level is a 2x2 box pyramid") {
+  // 奇数サイズ（端のはみ出し分は透明）
+  ImageBuffer srcImg = createAreaTestImage(37, 29, 17);
+  ImageBuffer level1 = halveReference(srcImg);
+  ImageBuffer level2 = halveReference(level1);
+
+  // 1/4 縮小・最近傍では レベル2 を等倍で参照する
+  ImageBuffer dst(level2.width(), level2.height(),
+                  PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  MipScene scene(srcImg.view(), dst, MipmapMode::Nearest,
+                 InterpolationMode::Nearest);
+  scene.src.setScale(0.25f, 0.25f);
+  scene.renderer.exec();
+  REQUIRE(scene.src.mipLevel() == 2);
+
+  int mismatches = 0;
+  for (int y = 0; y < dst.height(); y++) {
+    const auto *a = static_cast<const uint8_t *>(dst.pixelAt(0, y));
+    const auto *b = static_cast<const uint8_t *>(level2.pixelAt(0, y));
+    for (int i = 0; i < dst.width() * 4; i++) {
+      if (a[i] != b[i]) mismatches++;
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+TEST_CASE("Scanline: trilinear mipmap keeps uniform color") {
+  ImageBuffer srcImg = createSolidImage(96, 96, 200, 100, 50);
+  ImageBuffer dst(48, 48, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  MipScene scene(srcImg.view(), dst, MipmapMode::Linear,
+                 InterpolationMode::Bilinear);
+  scene.src.setRotationScale(0.5f, 0.3f, 0.3f);
+  scene.renderer.exec();
+  CHECK(scene.src.mipLevel() == 1);
+
+  const auto *center = static_cast<const uint8_t *>(dst.pixelAt(24, 24));
+  CHECK(center[0] == 200);
+  CHECK(center[1] == 100);
+  CHECK(center[2] == 50);
+  CHECK(center[3] == 255);
+
+  // 端（フェードアウト）でも色は保たれ、アルファのみ変化する
+  int colorErrors = 0;
+  for (int y = 0; y < dst.height(); y++) {
+    for (int x = 0; x < dst.width(); x++) {
+      const auto *p = static_cast<const uint8_t *>(dst.pixelAt(x, y));
+      if (p[3] < 32) continue;
+      if (std::abs(p[0] - 200) > 1 || std::abs(p[1] - 100) > 1 ||
+          std::abs(p[2] - 50) > 1)
+        colorErrors++;
+    }
+  }
+  CHECK(colorErrors == 0);
+}
+
+TEST_CASE("Scanline: mipmap is rebuilt after setSource") {
+  ImageBuffer red = createSolidImage(32, 32, 255, 0, 0);
+  ImageBuffer blue = createSolidImage(32, 32, 0, 0, 255);
+  ImageBuffer dst(8, 8, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  MipScene scene(red.view(), dst, MipmapMode::Nearest,
+                 InterpolationMode::Bilinear);
+  scene.src.setScale(0.25f, 0.25f);
+  scene.renderer.exec();
+  CHECK(static_cast<const uint8_t *>(dst.pixelAt(4, 4))[0] == 255);
+
+  scene.src.setSource(blue.view());
+  scene.renderer.exec();
+  const auto *p = static_cast<const uint8_t *>(dst.pixelAt(4, 4));
+  CHECK(p[0] == 0);
+  CHECK(p[2] == 255);
+}
+
+// =============================================================================
+// Column Map Tests
+// =============================================================================
+
+// 任意フォーマットの乱数画像（全バイトが有効値のフォーマット用）
+static ImageBuffer createRandomImage(int width, int height, PixelFormatID format,
+                                     uint32_t seed) {
+  ImageBuffer img(width, height, format);
+  for (int y = 0; y < height; y++) {
+    auto *row = static_cast<uint8_t *>(img.pixelAt(0, y));
+    for (int i = 0; i < width * format->bytesPerPixel; i++) {
+      seed = seed * 1103515245u + 12345u;
+      row[i] = static_cast<uint8_t>(seed >> 24);
+    }
+  }
+  return img;
+}
+
+struct ColumnMapCase {
+  float scaleX;
+  float scaleY;
+  float rotation;
+  InterpolationMode interp;
+  uint8_t edgeFade;
+  int tileW;
+  int tileH;
+};
+
+// enabled: 列テーブル・転置キャッシュの有効/無効
+// 戻り値: 使用された高速パス（bit0: 列テーブル、bit1: 転置キャッシュ）
+static int renderFastPath(const ViewPort &srcView, ImageBuffer &dst,
+                          const ColumnMapCase &c, bool enabled) {
+  SourceNode src(srcView, float_to_fixed(srcView.width / 2.0f),
+                 float_to_fixed(srcView.height / 2.0f));
+  src.setColumnMapEnabled(enabled);
+  src.setTransposeCacheEnabled(enabled);
+  src.setInterpolationMode(c.interp);
+  src.setEdgeFade(c.edgeFade);
+  src.setRotationScale(c.rotation, c.scaleX, c.scaleY);
+  RendererNode renderer;
+  SinkNode sink(dst.view(), float_to_fixed(dst.width() / 2.0f),
+                float_to_fixed(dst.height() / 2.0f));
+  src >> renderer >> sink;
+  renderer.setVirtualScreen(dst.width(), dst.height());
+  renderer.setPivotCenter();
+  if (c.tileW > 0) renderer.setTileConfig(c.tileW, c.tileH);
+  renderer.exec();
+  return (src.isColumnMapActive() ? 1 : 0) |
+         (src.isTransposeCacheActive() ? 2 : 0);
+}
+
+// 高速パスの有無で出力が一致すること（使用されたパスも確認）
+static void checkFastPathIdentical(const ViewPort &srcView,
+                                   const ColumnMapCase &c, int expectPath) {
+  ImageBuffer with(61, 47, PixelFormatIDs::RGBA8_Straight, InitPolicy::Zero);
+  ImageBuffer without(61, 47, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
+  CHECK(renderFastPath(srcView, with, c, true) == expectPath);
+  CHECK(renderFastPath(srcView, without, c, false) == 0);
+  CHECK(hasNonZeroPixels(with.view()));
+  CHECK(std::memcmp(with.data(), without.data(), with.totalBytes()) == 0);
+}
+
+TEST_CASE("Scanline: column map nearest matches DDA") {
+  const PixelFormatID formats[] = {
+      PixelFormatIDs::RGBA8_Straight, PixelFormatIDs::RGB888,
+      PixelFormatIDs::RGB565_LE, PixelFormatIDs::Grayscale8};
+  const ColumnMapCase cases[] = {
+      {3.0f, 3.0f, 0.0f, InterpolationMode::Nearest, 0, 0, 0},
+      {2.5f, 4.25f, 0.0f, InterpolationMode::Nearest, 0, 7, 5},
+      {-1.7f, 0.6f, 0.0f, InterpolationMode::Nearest, 0, 0, 0},
+      {0.45f, -2.0f, 0.0f, InterpolationMode::Nearest, 0, 16, 3},
+  };
+  uint32_t seed = 1;
+  for (PixelFormatID format : formats) {
+    ImageBuffer srcImg = createRandomImage(23, 17, format, seed++);
+    for (const auto &c : cases) {
+      CAPTURE(format->name);
+      CAPTURE(c.scaleX);
+      CAPTURE(c.scaleY);
+      checkFastPathIdentical(srcImg.view(), c, 1);
+    }
+  }
+}
+
+TEST_CASE("Scanline: column map bilinear matches DDA") {
+  ImageBuffer srcImg = createAreaTestImage(23, 17, 9);
+  const uint8_t fades[] = {EdgeFade_None, EdgeFade_All};
+  const ColumnMapCase cases[] = {
+      {3.3f, 2.2f, 0.0f, InterpolationMode::Bilinear, 0, 0, 0},
+      {-0.8f, 1.6f, 0.0f, InterpolationMode::Bilinear, 0, 9, 4},
+      {2.0f, -2.0f, 0.0f, InterpolationMode::Bilinear, 0, 0, 0},
+  };
+  for (uint8_t fade : fades) {
+    for (auto c : cases) {
+      c.edgeFade = fade;
+      CAPTURE(fade);
+      CAPTURE(c.scaleX);
+      checkFastPathIdentical(srcImg.view(), c, 1);
+    }
+  }
+}
+
+TEST_CASE("Scanline: column map is used only without rotation") {
+  ImageBuffer rgba = createAreaTestImage(23, 17, 4);
+  ImageBuffer rgb565 =
+      createRandomImage(23, 17, PixelFormatIDs::RGB565_LE, 5);
+
+  // 回転あり
+  checkFastPathIdentical(
+      rgba.view(), {2.0f, 2.0f, 0.3f, InterpolationMode::Nearest, 0, 0, 0},
+      0);
+  // バイリニアは RGBA8_Straight のみ
+  checkFastPathIdentical(
+      rgb565.view(), {2.0f, 2.0f, 0.0f, InterpolationMode::Bilinear, 0, 0, 0},
+      0);
+}
+
+// =============================================================================
+// Transpose Cache Tests
+// =============================================================================
+
+TEST_CASE("Scanline: transpose cache matches DDA for right angles") {
+  const float quarter = static_cast<float>(M_PI) / 2.0f;
+  const PixelFormatID formats[] = {
+      PixelFormatIDs::RGBA8_Straight, PixelFormatIDs::RGB888,
+      PixelFormatIDs::RGB565_LE, PixelFormatIDs::Grayscale8};
+  const ColumnMapCase cases[] = {
+      {1.0f, 1.0f, quarter, InterpolationMode::Nearest, 0, 0, 0},
+      {1.0f, 1.0f, -quarter, InterpolationMode::Nearest, 0, 11, 6},
+      {-1.0f, 1.0f, quarter, InterpolationMode::Nearest, 0, 0, 0},  // 転置
+      {2.5f, 0.7f, quarter, InterpolationMode::Nearest, 0, 8, 40},
+  };
+  uint32_t seed = 11;
+  for (PixelFormatID format : formats) {
+    // 帯（32列）を複数使う幅、32行単位に揃わない高さ
+    ImageBuffer srcImg = createRandomImage(70, 45, format, seed++);
+    for (const auto &c : cases) {
+      CAPTURE(format->name);
+      CAPTURE(c.rotation);
+      CAPTURE(c.scaleX);
+      checkFastPathIdentical(srcImg.view(), c, 2);
+    }
+  }
+}
+
+TEST_CASE("Scanline: 180 degree rotation uses column map") {
+  ImageBuffer srcImg = createRandomImage(23, 17, PixelFormatIDs::RGB565_LE, 3);
+  checkFastPathIdentical(srcImg.view(),
+                         {1.0f, 1.0f, static_cast<float>(M_PI),
+                          InterpolationMode::Nearest, 0, 0, 0},
+                         1);
+
+  // バイリニアの90度回転は DDA のまま
+  ImageBuffer rgba = createAreaTestImage(23, 17, 8);
+  checkFastPathIdentical(rgba.view(),
+                         {1.0f, 1.0f, static_cast<float>(M_PI) / 2.0f,
+                          InterpolationMode::Bilinear, 0, 0, 0},
+                         0);
+}
+
+// =============================================================================
+// Perspective Tests
+// =============================================================================
+
+// perspective: nullptr なら射影変換なし（列テーブル・転置キャッシュは無効）
+static void renderPerspective(const ViewPort &srcView, ImageBuffer &dst,
+                              const ColumnMapCase &c,
+                              const PerspectiveMatrix *perspective) {
+  SourceNode src(srcView, float_to_fixed(srcView.width / 2.0f),
+                 float_to_fixed(srcView.height / 2.0f));
+  src.setColumnMapEnabled(false);
+  src.setTransposeCacheEnabled(false);
+  src.setInterpolationMode(c.interp);
+  src.setEdgeFade(c.edgeFade);
+  src.setRotationScale(c.rotation, c.scaleX, c.scaleY);
+  if (perspective) src.setPerspective(*perspective);
+  RendererNode renderer;
+  SinkNode sink(dst.view(), float_to_fixed(dst.width() / 2.0f),
+                float_to_fixed(dst.height() / 2.0f));
+  src >> renderer >> sink;
+  renderer.setVirtualScreen(dst.width(), dst.height());
+  renderer.setPivotCenter();
+  if (c.tileW > 0) renderer.setTileConfig(c.tileW, c.tileH);
+  renderer.exec();
+}
+
+// 3x3 行列の逆行列（double、参照計算用）
+static void invert3x3(const double m[9], double out[9]) {
+  double det = m[0] * (m[4] * m[8] - m[5] * m[7]) -
+               m[1] * (m[3] * m[8] - m[5] * m[6]) +
+               m[2] * (m[3] * m[7] - m[4] * m[6]);
+  out[0] = (m[4] * m[8] - m[5] * m[7]) / det;
+  out[1] = (m[2] * m[7] - m[1] * m[8]) / det;
+  out[2] = (m[1] * m[5] - m[2] * m[4]) / det;
+  out[3] = (m[5] * m[6] - m[3] * m[8]) / det;
+  out[4] = (m[0] * m[8] - m[2] * m[6]) / det;
+  out[5] = (m[2] * m[3] - m[0] * m[5]) / det;
+  out[6] = (m[3] * m[7] - m[4] * m[6]) / det;
+  out[7] = (m[1] * m[6] - m[0] * m[7]) / det;
+  out[8] = (m[0] * m[4] - m[1] * m[3]) / det;
+}
+
+// 各出力ピクセルが、ピクセル中心を射影したソース座標のピクセルであること
+// ソースは R = x * 5, G = y * 7 の不透明画像
+// tolerance: 許容する座標の誤差（スクリーンのピクセル単位、ソース上ではスクリーン
+// 1ピクセルあたりの移動量を掛けた値）。境界から許容誤差以内のピクセルは判定しない
+static void checkPerspectiveSampling(const ColumnMapCase &c,
+                                     const PerspectiveMatrix &perspective,
+                                     double tolerance) {
+  const int srcW = 48, srcH = 32, dstW = 96, dstH = 64;
+  ImageBuffer srcImg(srcW, srcH, PixelFormatIDs::RGBA8_Straight);
+  for (int y = 0; y < srcH; y++) {
+    auto *row = static_cast<uint8_t *>(srcImg.pixelAt(0, y));
+    for (int x = 0; x < srcW; x++) {
+      row[x * 4 + 0] = static_cast<uint8_t>(x * 5);
+      row[x * 4 + 1] = static_cast<uint8_t>(y * 7);
+      row[x * 4 + 2] = 0;
+      row[x * 4 + 3] = 255;
+    }
+  }
+  ImageBuffer dst(dstW, dstH, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  renderPerspective(srcImg.view(), dst, c, &perspective);
+
+  // ワールド座標 = アフィン × perspective × (ソース座標 - pivot)
+  SourceNode probe;
+  probe.setRotationScale(c.rotation, c.scaleX, c.scaleY);
+  const AffineMatrix &a = probe.matrix();
+  const PerspectiveMatrix &p = perspective;
+  const double forward[9] = {
+      a.a * p.a + a.b * p.c,  a.a * p.b + a.b * p.d,  a.a * p.tx + a.b * p.ty,
+      a.c * p.a + a.d * p.c,  a.c * p.b + a.d * p.d,  a.c * p.tx + a.d * p.ty,
+      p.px,                   p.py,                   p.pw};
+  double inv[9];
+  invert3x3(forward, inv);
+
+  int inside = 0, mismatches = 0;
+  for (int j = 0; j < dstH; j++) {
+    const auto *row = static_cast<const uint8_t *>(dst.pixelAt(0, j));
+    for (int i = 0; i < dstW; i++) {
+      const double wx = i + 0.5 - dstW / 2, wy = j + 0.5 - dstH / 2;
+      const double w = inv[6] * wx + inv[7] * wy + inv[8];
+      const double u = (inv[0] * wx + inv[1] * wy + inv[2]) / w + srcW / 2;
+      const double v = (inv[3] * wx + inv[4] * wy + inv[5]) / w + srcH / 2;
+      const uint8_t *px = row + i * 4;
+      if (std::fabs(w) < 1e-3) continue;
+      const double du = (inv[0] - inv[6] * (u - srcW / 2)) / w;
+      const double dv = (inv[3] - inv[6] * (v - srcH / 2)) / w;
+      const double tol =
+          tolerance * std::max(std::fabs(du), std::fabs(dv)) + 1e-3;
+      const double margin = std::min({u, srcW - u, v, srcH - v});
+      if (w < 0 || margin < -tol) {
+        if (px[3] != 0) mismatches++;
+        continue;
+      }
+      if (margin < tol) continue;
+      inside++;
+      const double sx = px[0] / 5 + 0.5, sy = px[1] / 7 + 0.5;
+      if (px[3] != 255 || std::fabs(sx - u) > 0.5 + tol ||
+          std::fabs(sy - v) > 0.5 + tol)
+        mismatches++;
+    }
+  }
+  CHECK(inside > 200);
+  CHECK(mismatches == 0);
+}
+
+TEST_CASE("Scanline: identity perspective matches affine DDA") {
+  const PerspectiveMatrix identity;
+  const PixelFormatID formats[] = {PixelFormatIDs::RGBA8_Straight,
+                                   PixelFormatIDs::RGB565_LE,
+                                   PixelFormatIDs::Grayscale8};
+  const ColumnMapCase cases[] = {
+      {2.0f, 2.0f, 0.0f, InterpolationMode::Nearest, 0, 0, 0},
+      {0.5f, -4.0f, 0.0f, InterpolationMode::Nearest, 0, 7, 5},
+      {-0.25f, 2.0f, 0.0f, InterpolationMode::Nearest, 0, 0, 0},
+  };
+  uint32_t seed = 21;
+  for (PixelFormatID format : formats) {
+    ImageBuffer srcImg = createRandomImage(23, 17, format, seed++);
+    for (const auto &c : cases) {
+      CAPTURE(format->name);
+      CAPTURE(c.scaleX);
+      ImageBuffer with(61, 47, PixelFormatIDs::RGBA8_Straight,
+                       InitPolicy::Zero);
+      ImageBuffer without(61, 47, PixelFormatIDs::RGBA8_Straight,
+                          InitPolicy::Zero);
+      renderPerspective(srcImg.view(), with, c, &identity);
+      renderPerspective(srcImg.view(), without, c, nullptr);
+      CHECK(hasNonZeroPixels(with.view()));
+      CHECK(std::memcmp(with.data(), without.data(), with.totalBytes()) == 0);
+    }
+  }
+
+  // バイリニア（フェードの有無）
+  ImageBuffer rgba = createAreaTestImage(23, 17, 4);
+  const uint8_t fades[] = {EdgeFade_None, EdgeFade_All};
+  for (uint8_t fade : fades) {
+    CAPTURE(fade);
+    const ColumnMapCase c = {2.0f, 0.5f, 0.0f, InterpolationMode::Bilinear,
+                             fade, 16, 3};
+    ImageBuffer with(61, 47, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
+    ImageBuffer without(61, 47, PixelFormatIDs::RGBA8_Straight,
+                        InitPolicy::Zero);
+    renderPerspective(rgba.view(), with, c, &identity);
+    renderPerspective(rgba.view(), without, c, nullptr);
+    CHECK(hasNonZeroPixels(with.view()));
+    CHECK(std::memcmp(with.data(), without.data(), with.totalBytes()) == 0);
+  }
+}
+
+TEST_CASE("Scanline: perspective card flip samples projected pixels") {
+  // Y軸回りのカードめくり（アフィンの回転・拡大と合成、タイル分割あり）
+  checkPerspectiveSampling(
+      {1.5f, 1.5f, 0.3f, InterpolationMode::Nearest, 0, 0, 0},
+      PerspectiveMatrix::rotateY(0.9f, 80.0f), 0.13);
+  checkPerspectiveSampling(
+      {1.0f, 1.2f, 0.0f, InterpolationMode::Nearest, 0, 13, 7},
+      PerspectiveMatrix::rotateX(-0.7f, 60.0f), 0.13);
+}
+
+TEST_CASE("Scanline: perspective clips rows behind the viewer") {
+  // x < -20 / sin(1.2) のソース列は視点の後ろ（w <= 0）
+  checkPerspectiveSampling(
+      {1.0f, 1.0f, 0.0f, InterpolationMode::Nearest, 0, 0, 0},
+      PerspectiveMatrix::rotateY(1.2f, 20.0f), 0.13);
+}
+
+TEST_CASE("Scanline: perspective output does not depend on request split") {
+  // 区間・除算位置はスクリーン列に揃えるため、タイル分割の有無で結果が変わらない
+  ImageBuffer srcImg =
+      createRandomImage(48, 40, PixelFormatIDs::RGBA8_Straight, 7);
+  const PerspectiveMatrix perspective = PerspectiveMatrix::rotateY(0.9f, 70.0f);
+  for (auto interp : {InterpolationMode::Nearest, InterpolationMode::Bilinear}) {
+    CAPTURE(static_cast<int>(interp));
+    ImageBuffer full(200, 160, PixelFormatIDs::RGBA8_Straight,
+                     InitPolicy::Zero);
+    ImageBuffer tiled(200, 160, PixelFormatIDs::RGBA8_Straight,
+                      InitPolicy::Zero);
+    renderPerspective(srcImg.view(), full, {2.5f, 2.5f, 0.2f, interp, 0, 0, 0},
+                      &perspective);
+    renderPerspective(srcImg.view(), tiled,
+                      {2.5f, 2.5f, 0.2f, interp, 0, 32, 32}, &perspective);
+    CHECK(std::memcmp(full.data(), tiled.data(), full.totalBytes()) == 0);
+  }
+}
+
+TEST_CASE("Scanline: perspective damage-tracked frames match full render") {
+  // 静止した射影スプライトの上を小さいスプライトが移動する（差分領域が射影スプライトを横切る）
+  ImageBuffer backImg =
+      createRandomImage(48, 40, PixelFormatIDs::RGBA8_Straight, 11);
+  ImageBuffer spriteImg = createSolidImage(12, 10, 200, 100, 50);
+  const int width = 200;
+  const int height = 160;
+
+  struct Scene {
+    SourceNode back;
+    SourceNode sprite;
+    CompositeNode composite{2};
+    RendererNode renderer;
+    SinkNode sink;
+    Scene(const ViewPort &backView, const ViewPort &spriteView,
+          ImageBuffer &dst)
+        : back(backView, float_to_fixed(backView.width / 2.0f),
+               float_to_fixed(backView.height / 2.0f)),
+          sprite(spriteView, float_to_fixed(spriteView.width / 2.0f),
+                 float_to_fixed(spriteView.height / 2.0f)),
+          sink(dst.view(), float_to_fixed(dst.width() / 2.0f),
+               float_to_fixed(dst.height() / 2.0f)) {
+      back.setInterpolationMode(InterpolationMode::Bilinear);
+      back.setRotationScale(0.2f, 2.5f, 2.5f);
+      back.setPerspective(PerspectiveMatrix::rotateY(0.8f, 70.0f));
+      back.connectTo(composite, 0);
+      sprite.connectTo(composite, 1);
+      composite >> renderer >> sink;
+      renderer.setVirtualScreen(dst.width(), dst.height());
+      renderer.setPivotCenter();
+    }
+    void apply(int frame) {
+      sprite.setTranslation(static_cast<float>(frame * 11 - 60),
+                            static_cast<float>(frame * 5 - 30));
+    }
+  };
+
+  ImageBuffer dst(width, height, PixelFormatIDs::RGBA8_Straight,
+                  InitPolicy::Zero);
+  Scene scene(backImg.view(), spriteImg.view(), dst);
+  scene.renderer.setDamageTrackingEnabled(true);
+  for (int frame = 0; frame < 12; frame++) {
+    CAPTURE(frame);
+    scene.apply(frame);
+    scene.renderer.exec();
+
+    ImageBuffer ref(width, height, PixelFormatIDs::RGBA8_Straight,
+                    InitPolicy::Zero);
+    Scene fresh(backImg.view(), spriteImg.view(), ref);
+    fresh.apply(frame);
+    fresh.renderer.exec();
+    CHECK(std::memcmp(dst.data(), ref.data(), dst.totalBytes()) == 0);
+  }
+}
+
+TEST_CASE("Scanline: perspective AABB covers projected corners") {
+  ImageBuffer srcImg = createSolidImage(40, 20, 10, 20, 30);
+  SourceNode src(srcImg.view(), float_to_fixed(20.0f), float_to_fixed(10.0f));
+  PrepareRequest req;
+  req.width = 200;
+  req.height = 100;
+  req.origin.x = float_to_fixed(-100.0f);
+  req.origin.y = float_to_fixed(-50.0f);
+
+  // 右端（x = 20）は奥で w = 1.096、左端（x = -20）は手前で w = 0.904
+  // X: [-20 cos / 0.904, 20 cos / 1.096] = [-19.41, 16.02]、Y: ±10 / 0.904
+  src.setPerspective(PerspectiveMatrix::rotateY(0.5f, 100.0f));
+  PrepareResponse r = src.pullPrepare(req);
+  CHECK(r.ok());
+  CHECK(from_fixed_floor(r.origin.x) == -20);
+  CHECK(from_fixed_floor(r.origin.y) == -12);
+  CHECK(r.width == 36);
+  CHECK(r.height == 23);
+  src.pullFinalize();
+
+  // 左側が視点の後ろに回り込む（w <= 0）場合はスクリーン全体
+  src.setPerspective(PerspectiveMatrix::rotateY(1.2f, 10.0f));
+  r = src.pullPrepare(req);
+  CHECK(r.ok());
+  CHECK(r.origin.x == req.origin.x);
+  CHECK(r.origin.y == req.origin.y);
+  CHECK(r.width == 200);
+  CHECK(r.height == 100);
+  src.pullFinalize();
+
+  // 解除後はアフィン変換の AABB
+  src.clearPerspective();
+  CHECK_FALSE(src.hasPerspective());
+  r = src.pullPrepare(req);
+  CHECK(r.width == 40);
+  CHECK(r.height == 20);
+  src.pullFinalize();
+}
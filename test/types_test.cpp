@@ -59,3 +59,53 @@ TEST_CASE("Point structure") {
     CHECK(from_fixed(c.y) == 5);
   }
 }
+
+// =============================================================================
+// PerspectiveMatrix Tests
+// =============================================================================
+
+TEST_CASE("PerspectiveMatrix composition and inverse") {
+  SUBCASE("affine embedding") {
+    AffineMatrix a(2, 1, -1, 3, 5, 7);
+    PerspectiveMatrix p(a);
+    CHECK(p.tx == 5.0f);
+    CHECK(p.ty == 7.0f);
+    CHECK(p.px == 0.0f);
+    CHECK(p.pw == 1.0f);
+  }
+
+  SUBCASE("inverse times matrix is identity") {
+    PerspectiveMatrix m = PerspectiveMatrix(AffineMatrix(1.5f, 0.2f, -0.3f,
+                                                         0.8f, 12, -4)) *
+                          PerspectiveMatrix::rotateY(0.7f, 90.0f) *
+                          PerspectiveMatrix::rotateX(-0.4f, 150.0f);
+    PerspectiveMatrix inv;
+    REQUIRE(m.inverse(inv));
+    PerspectiveMatrix id = inv * m;
+    CHECK(id.a == doctest::Approx(1.0f).epsilon(1e-5));
+    CHECK(id.b == doctest::Approx(0.0f).epsilon(1e-5));
+    CHECK(id.tx == doctest::Approx(0.0f).epsilon(1e-4));
+    CHECK(id.c == doctest::Approx(0.0f).epsilon(1e-5));
+    CHECK(id.d == doctest::Approx(1.0f).epsilon(1e-5));
+    CHECK(id.ty == doctest::Approx(0.0f).epsilon(1e-4));
+    CHECK(id.px == doctest::Approx(0.0f).epsilon(1e-5));
+    CHECK(id.py == doctest::Approx(0.0f).epsilon(1e-5));
+    CHECK(id.pw == doctest::Approx(1.0f).epsilon(1e-5));
+  }
+
+  SUBCASE("singular matrix") {
+    PerspectiveMatrix m(1, 2, 3, 2, 4, 6, 0, 0, 1);
+    PerspectiveMatrix inv;
+    CHECK_FALSE(m.inverse(inv));
+  }
+
+  SUBCASE("rotateY shrinks the far side") {
+    // x = +50 は奥（w > 1）、x = -50 は手前（w < 1）
+    PerspectiveMatrix m = PerspectiveMatrix::rotateY(0.5f, 200.0f);
+    float wFar = m.px * 50.0f + m.pw;
+    float wNear = m.px * -50.0f + m.pw;
+    CHECK(wFar > 1.0f);
+    CHECK(wNear < 1.0f);
+    CHECK(m.a * 50.0f / wFar < 50.0f * std::cos(0.5f));
+  }
+}
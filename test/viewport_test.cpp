@@ -5,6 +5,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <vector>
 
 #define FLEXIMG_NAMESPACE fleximg
 #include "fleximg/image/image_buffer.h"
@@ -595,6 +596,123 @@ TEST_CASE("copyRowDDA: relaxed ConstX condition (small incrX, same column)") {
   }
 }
 
+TEST_CASE("copyRowDDA: long rows match reference (1/2/4 bytes per pixel)") {
+  // 8ピクセル単位のSIMD版（窓ロード・ギャザー）と端数処理を含む長さで検証
+  constexpr int SRC_W = 48;
+  constexpr int SRC_H = 40;
+  constexpr int MAX_COUNT = 77;
+  struct Format {
+    PixelFormatID id;
+    int bpp;
+  };
+  const Format formats[] = {{PixelFormatIDs::RGB332, 1},
+                            {PixelFormatIDs::RGB565_LE, 2},
+                            {PixelFormatIDs::RGBA8_Straight, 4}};
+  // 拡大縮小・反転・回転（incrX, incrY）
+  const int_fixed incrs[][2] = {
+      {INT_FIXED_ONE, 0},          {INT_FIXED_ONE / 3, 0},
+      {INT_FIXED_ONE * 5 / 7, 0},  {-INT_FIXED_ONE / 2, 0},
+      {-INT_FIXED_ONE, 0},         {INT_FIXED_ONE * 3 / 2, 0},
+      {-INT_FIXED_ONE * 2, 0},     {INT_FIXED_ONE / 2, 300},
+      {0, INT_FIXED_ONE / 2},      {0, -INT_FIXED_ONE},
+      {46341, 46341},              {-23170, 23170},
+      {56756, -32768},             {11585, -11585},
+  };
+  uint32_t seed = 12345;
+  for (const auto &fmt : formats) {
+    // 先頭を4バイト境界からずらしたソース（2バイトは偶数境界）
+    const int offset = fmt.bpp == 1 ? 3 : (fmt.bpp == 2 ? 2 : 0);
+    const int stride = SRC_W * fmt.bpp + (fmt.bpp == 4 ? 0 : fmt.bpp);
+    std::vector<uint8_t> buf(static_cast<size_t>(offset + stride * SRC_H));
+    for (auto &b : buf) {
+      seed = seed * 1103515245u + 12345u;
+      b = static_cast<uint8_t>(seed >> 16);
+    }
+    ViewPort src(buf.data() + offset, fmt.id, stride, SRC_W, SRC_H);
+
+    for (const auto &incr : incrs) {
+      for (int start = 0; start < 6; start++) {
+        const int_fixed srcX = to_fixed(start * 7 + 4) + start * 9001;
+        const int_fixed srcY = to_fixed(start * 5 + 6) + start * 7919;
+        // 全ピクセルがソース範囲内に収まる長さ
+        int count = 0;
+        while (count < MAX_COUNT) {
+          int64_t x = srcX + static_cast<int64_t>(incr[0]) * count;
+          int64_t y = srcY + static_cast<int64_t>(incr[1]) * count;
+          if (x < 0 || y < 0 || (x >> 16) >= SRC_W || (y >> 16) >= SRC_H)
+            break;
+          count++;
+        }
+        if (count == 0)
+          continue;
+        CAPTURE(fmt.bpp);
+        CAPTURE(incr[0]);
+        CAPTURE(incr[1]);
+        CAPTURE(start);
+        CAPTURE(count);
+
+        uint8_t actual[MAX_COUNT * 4 + 4];
+        uint8_t expected[MAX_COUNT * 4 + 4];
+        std::memset(actual, 0xCD, sizeof(actual));
+        std::memset(expected, 0xCD, sizeof(expected));
+        testCopyRowDDA(actual, src, count, srcX, srcY, incr[0], incr[1]);
+        copyRowDDA_Reference(expected, static_cast<const uint8_t *>(src.data),
+                             stride, fmt.bpp, srcX, srcY, incr[0], incr[1],
+                             count);
+        CHECK(std::memcmp(actual, expected, sizeof(actual)) == 0);
+      }
+    }
+  }
+}
+
+TEST_CASE("copyRowDDA: window load stays inside the referenced source") {
+  // ソース行を過不足なく確保し（前後に余白なし）、行内の範囲だけを参照する
+  // 平行移動・拡大・反転で転写する。SIMD版の窓ロードが確保領域外を読むと
+  // AddressSanitizer で検出される
+  struct Format {
+    PixelFormatID id;
+    int bpp;
+  };
+  const Format formats[] = {{PixelFormatIDs::Grayscale8, 1},
+                            {PixelFormatIDs::RGB332, 1},
+                            {PixelFormatIDs::RGB565_LE, 2}};
+  const int_fixed incrs[] = {INT_FIXED_ONE, INT_FIXED_ONE / 3,
+                             -INT_FIXED_ONE / 2, -INT_FIXED_ONE};
+  uint32_t seed = 4321;
+  for (const auto &fmt : formats) {
+    for (int width = 1; width <= 40; width++) {
+      std::vector<uint8_t> row(static_cast<size_t>(width * fmt.bpp));
+      for (auto &b : row) {
+        seed = seed * 1103515245u + 12345u;
+        b = static_cast<uint8_t>(seed >> 16);
+      }
+      ViewPort src(row.data(), fmt.id, width * fmt.bpp, width, 1);
+      for (int_fixed incr : incrs) {
+        // 順方向は左端から、逆方向は右端から、行内に収まる最大の長さ
+        const int_fixed srcX = incr > 0 ? 0 : to_fixed(width) - 1;
+        int count = 0;
+        while (count < 64) {
+          int64_t x = srcX + static_cast<int64_t>(incr) * count;
+          if (x < 0 || (x >> 16) >= width)
+            break;
+          count++;
+        }
+        CAPTURE(fmt.bpp);
+        CAPTURE(width);
+        CAPTURE(incr);
+        CAPTURE(count);
+
+        std::vector<uint8_t> actual(static_cast<size_t>(count * fmt.bpp));
+        std::vector<uint8_t> expected(actual.size());
+        testCopyRowDDA(actual.data(), src, count, srcX, 0, incr, 0);
+        copyRowDDA_Reference(expected.data(), row.data(), width * fmt.bpp,
+                             fmt.bpp, srcX, 0, incr, 0, count);
+        CHECK(actual == expected);
+      }
+    }
+  }
+}
+
 // =============================================================================
 // canUseSingleChannelBilinear Tests
 // =============================================================================
@@ -846,3 +964,115 @@ TEST_CASE("copyRowDDABilinear: RGBA8 path unchanged (regression)") {
     CHECK(pixel[3] == 255);
   }
 }
+
+// copyQuadDDA + edgeFlags + bilinearBlend_RGBA8888 と同じ処理をピクセル単位で行う
+static uint32_t bilinearRGBA8_Reference(const uint8_t *srcData, int32_t stride,
+                                        int width, int height, int_fixed srcX,
+                                        int_fixed srcY, uint8_t edgeFadeMask) {
+  int32_t sx = srcX >> INT_FIXED_SHIFT;
+  int32_t sy = srcY >> INT_FIXED_SHIFT;
+  uint32_t fx = (static_cast<uint32_t>(srcX) >> 8) & 0xFF;
+  uint32_t fy = (static_cast<uint32_t>(srcY) >> 8) & 0xFF;
+  bool xSub = static_cast<uint32_t>(sx) < static_cast<uint32_t>(width - 1);
+  bool ySub = static_cast<uint32_t>(sy) < static_cast<uint32_t>(height - 1);
+
+  // 4近傍（境界ではクランプ、範囲外側の近傍にフラグ）
+  uint8_t flagX = 0;
+  uint8_t flagY = 0;
+  int32_t x0 = sx, x1 = sx + 1, y0 = sy, y1 = sy + 1;
+  if (!xSub) {
+    flagX = sx < 0 ? EdgeFade_Left : EdgeFade_Right;
+    x0 = x1 = sx < 0 ? 0 : sx;
+  }
+  if (!ySub) {
+    flagY = sy < 0 ? EdgeFade_Top : EdgeFade_Bottom;
+    y0 = y1 = sy < 0 ? 0 : sy;
+  }
+  const int32_t xs[4] = {x0, x1, x0, x1};
+  const int32_t ys[4] = {y0, y0, y1, y1};
+  const uint8_t fadeBits[4] = {EdgeFade_Left | EdgeFade_Top,
+                               EdgeFade_Right | EdgeFade_Top,
+                               EdgeFade_Left | EdgeFade_Bottom,
+                               EdgeFade_Right | EdgeFade_Bottom};
+  uint8_t flags = static_cast<uint8_t>((flagX | flagY) & edgeFadeMask);
+
+  uint32_t w10 = (fx * (256 - fy)) >> 8;
+  uint32_t w11 = (fx * fy) >> 8;
+  uint32_t w01 = ((256 - fx) * fy) >> 8;
+  const uint32_t weights[4] = {256 - (w10 + w11 + w01), w10, w01, w11};
+
+  uint32_t sum[4] = {};
+  for (int k = 0; k < 4; k++) {
+    const uint8_t *p = srcData + ys[k] * stride + xs[k] * 4;
+    for (int c = 0; c < 4; c++) {
+      uint32_t v = p[c];
+      if (c == 3 && (flags & fadeBits[k]))
+        v = 0;
+      sum[c] += weights[k] * v;
+    }
+  }
+  return (sum[0] >> 8) | ((sum[1] >> 8) << 8) | ((sum[2] >> 8) << 16) |
+         ((sum[3] >> 8) << 24);
+}
+
+TEST_CASE("copyRowDDABilinear: RGBA8 rows match per-pixel reference") {
+  // 内部ピクセルの1パス処理（SIMD版）と境界のチャンク処理の混在を検証
+  constexpr int SRC_W = 37;
+  constexpr int SRC_H = 29;
+  constexpr int MAX_COUNT = 90;
+  std::vector<uint8_t> buf(SRC_W * SRC_H * 4);
+  uint32_t seed = 777;
+  for (auto &b : buf) {
+    seed = seed * 1103515245u + 12345u;
+    b = static_cast<uint8_t>(seed >> 16);
+  }
+  ViewPort src(buf.data(), SRC_W, SRC_H, PixelFormatIDs::RGBA8_Straight);
+
+  const int_fixed incrs[][2] = {
+      {INT_FIXED_ONE, 0},     {INT_FIXED_ONE / 3, 0},   {-INT_FIXED_ONE / 2, 0},
+      {INT_FIXED_ONE / 2, 1000}, {0, INT_FIXED_ONE / 2}, {46341, 46341},
+      {-23170, 23170},        {56756, -32768},          {11585, -11585},
+  };
+  const uint8_t masks[] = {EdgeFade_None, EdgeFade_All,
+                           EdgeFade_Left | EdgeFade_Bottom};
+  for (const auto &incr : incrs) {
+    for (int start = 0; start < 6; start++) {
+      // ソースの外側（-0.5〜）から開始し、境界フェード領域を含める
+      const int_fixed srcX = to_fixed(start * 6) - INT_FIXED_ONE / 2 +
+                             start * 4099;
+      const int_fixed srcY = to_fixed(start * 4) - INT_FIXED_ONE / 2 +
+                             start * 6007;
+      // 全ピクセルが [-1, W) x [-1, H) に収まる長さ
+      int count = 0;
+      while (count < MAX_COUNT) {
+        int64_t x = srcX + static_cast<int64_t>(incr[0]) * count;
+        int64_t y = srcY + static_cast<int64_t>(incr[1]) * count;
+        if (x < -INT_FIXED_ONE || y < -INT_FIXED_ONE ||
+            (x >> 16) >= SRC_W || (y >> 16) >= SRC_H)
+          break;
+        count++;
+      }
+      if (count == 0)
+        continue;
+      for (uint8_t mask : masks) {
+        CAPTURE(incr[0]);
+        CAPTURE(incr[1]);
+        CAPTURE(start);
+        CAPTURE(static_cast<int>(mask));
+
+        uint32_t actual[MAX_COUNT] = {};
+        view_ops::copyRowDDABilinear(actual, src, count, srcX, srcY, incr[0],
+                                     incr[1], mask, nullptr);
+        int mismatches = 0;
+        for (int i = 0; i < count; i++) {
+          uint32_t expected = bilinearRGBA8_Reference(
+              buf.data(), src.stride, SRC_W, SRC_H, srcX + incr[0] * i,
+              srcY + incr[1] * i, mask);
+          if (actual[i] != expected)
+            mismatches++;
+        }
+        CHECK(mismatches == 0);
+      }
+    }
+  }
+}